@@ -494,6 +494,14 @@ XGB_EXTERN_C typedef void DataIterResetCallback(DataIterHandle handle); // NOLIN
  *   - missing:      Which value to represent missing value
  *   - cache_prefix: The path of cache file, caller must initialize all the directories in this path.
  *   - nthread (optional): Number of threads used for initializing DMatrix.
+ *   - compress_cache (optional): Bit-pack the gradient index in the CPU cache. Trades
+ *       some CPU time for smaller pages. Available since 3.1.0.
+ *   - io_backend (optional): How the CPU cache is read, `mmap` (default) or `pread`. The
+ *       latter loads pages with large reads and adapts the prefetch depth to the I/O
+ *       stall. Available since 3.1.0.
+ *   - resident_cache_bytes (optional): Host memory budget in bytes for keeping CPU cache
+ *       pages in memory, for each type of page. Pages beyond the budget are read from
+ *       disk. Available since 3.1.0.
  * \param[out] out      The created external memory DMatrix
  *
  * \return 0 when success, -1 when failure happens
@@ -528,6 +536,17 @@ XGB_DLL int XGDMatrixCreateFromCallback(DataIterHandle iter, DMatrixHandle proxy
  *   - nthread (optional): Number of threads used for initializing DMatrix.
  *   - max_bin (optional): Maximum number of bins for building histogram. Must be consistent with
  *                         the corresponding booster training parameter.
+ *   - single_pass (optional): Call the `next` callback only once for each batch. The batches
+ *       are buffered in host memory during the first iteration, then all subsequent passes
+ *       read from the buffer. This is useful for slow data sources, at the cost of holding
+ *       a copy of the input until the construction finishes. Batches without missing values
+ *       take 4 bytes per element, other batches are stored as CSR matrices of the valid
+ *       elements with 5 to 8 bytes per element, depending on the number of features, plus
+ *       8 bytes per row. Only CPU inputs without string categories are supported. Default to
+ *       false.
+ *   - single_pass_max_bytes (optional): Budget for the single-pass buffer in bytes. Once
+ *       exceeded, the buffer is released and the `next` callback is called for every pass
+ *       as if `single_pass` is false. Default to 4GiB.
  *   - max_quantile_blocks (optional): For GPU-based inputs, XGBoost handles incoming
  *       batches with multiple growing substreams. This parameter sets the maximum number
  *       of batches before XGBoost can cut the sub-stream and create a new one. This can
@@ -575,6 +594,18 @@ XGB_DLL int XGQuantileDMatrixCreateFromCallback(DataIterHandle iter, DMatrixHand
  *      host and device portitions to reduce the data transfer overhead. This parameter
  *      specifies the size of host cache compared to the size of the entire cache:
  *      `host / (host + device)`.
+ * - compress_cache (optional): For CPU-based inputs, bit-pack the gradient index in the
+ *      cache using the smallest number of bits for the bins in each page. The pages are
+ *      unpacked by the prefetch threads. Available since 3.1.0.
+ * - io_backend (optional): For CPU-based inputs, how the cache is read. Either `mmap`
+ *      (default) or `pread`. The `pread` backend loads each page with large reads into
+ *      memory buffers and deepens the prefetch queue when the training is stalled by I/O.
+ *      Available since 3.1.0.
+ * - resident_cache_bytes (optional): For CPU-based inputs, the host memory budget in bytes
+ *      for keeping cache pages in memory to avoid reading them from disk in every
+ *      iteration. Pages are kept in their serialized form, which is bit-packed if
+ *      `compress_cache` is set. Pages beyond the budget are read from disk. Available
+ *      since 3.1.0.
  * @param out The created Quantile DMatrix.
  *
  * @return 0 when success, -1 when failure happens
@@ -585,6 +616,51 @@ XGB_DLL int XGExtMemQuantileDMatrixCreateFromCallback(DataIterHandle iter, DMatr
                                                       XGDMatrixCallbackNext *next,
                                                       char const *config, DMatrixHandle *out);
 
+/**
+ * @brief Create an empty Quantile DMatrix from the quantile cuts stored in a booster.
+ *
+ * The booster must be trained by the `hist` tree method with the `save_cuts` parameter
+ * set to true. The returned DMatrix can be used as the `ref` for @ref
+ * XGQuantileDMatrixCreateFromCallback and @ref XGExtMemQuantileDMatrixCreateFromCallback
+ * to skip sketching when the new data shares the quantiles of the training data. Feature
+ * types are obtained from the booster.
+ *
+ * @since 3.1.0
+ *
+ * @param handle Booster handle.
+ * @param config JSON encoded parameters, currently unused.
+ * @param out    The created Quantile DMatrix.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGQuantileDMatrixCreateFromBooster(BoosterHandle handle, char const *config,
+                                               DMatrixHandle *out);
+
+/**
+ * @brief Create a Quantile DMatrix from an Arrow IPC (Feather V2) file.
+ *
+ * The file is memory mapped and each record batch is passed to the DMatrix as columnar
+ * data without copying, including the validity bitmaps and the dictionaries of
+ * categorical columns. Supported column types are integers, floating points, and
+ * dictionary-encoded integers or strings. Compressed files are not supported.
+ *
+ * @since 3.1.0
+ *
+ * @param path   Path to the Arrow IPC file.
+ * @param config JSON encoded parameters for DMatrix construction.  Accepted fields are:
+ *   - label (optional):  Name of the label column.
+ *   - weight (optional): Name of the sample weight column.
+ *   - cache_prefix (optional): Create an external memory Quantile DMatrix with this cache
+ *       prefix when specified.
+ *   Other fields are the same as @ref XGQuantileDMatrixCreateFromCallback, or @ref
+ *   XGExtMemQuantileDMatrixCreateFromCallback if `cache_prefix` is specified.
+ * @param out    The created Quantile DMatrix.
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGQuantileDMatrixCreateFromArrowIPC(char const *path, char const *config,
+                                                DMatrixHandle *out);
+
 /**
  * @brief Set data on a DMatrix proxy.
  *
@@ -658,6 +734,10 @@ XGB_DLL int XGDMatrixSliceDMatrix(DMatrixHandle handle,
                                   DMatrixHandle *out);
 /*!
  * \brief create a new dmatrix from sliced content of existing matrix
+ *
+ * A CPU QuantileDMatrix is sliced without quantizing the data again, but the output
+ * holds its own copy of the quantized rows instead of a view into the input.
+ *
  * \param handle instance of data matrix to be sliced
  * \param idxset index set
  * \param len length of index set
@@ -680,8 +760,12 @@ XGB_DLL int XGDMatrixFree(DMatrixHandle handle);
  */
 
 /**
- * @brief Save the DMatrix object into a file. `QuantileDMatrix` and external memory
- *        DMatrix are not supported.
+ * @brief Save the DMatrix object into a file. External memory DMatrix is not supported.
+ *
+ * A `QuantileDMatrix` is saved as a versioned binary snapshot containing the quantile
+ * cuts, the histogram index, and the meta info. The snapshot can be loaded with @ref
+ * XGDMatrixCreateFromURI, which memory maps the file instead of reading it. Processes
+ * loading the same snapshot share the histogram index through the page cache.
  *
  * @param handle a instance of data matrix
  * @param fname file name
@@ -1214,6 +1298,32 @@ XGB_DLL int XGBoosterPredictFromColumnar(BoosterHandle handle, char const *value
                                          bst_ulong const **out_shape, bst_ulong *out_dim,
                                          const float **out_result);
 
+/**
+ * @brief Register the categories of a DataFrame for inplace prediction.
+ *
+ * The mapping from the categories of the input to the categories of the training data is
+ * computed once and cached by the booster. Subsequent calls to @ref
+ * XGBoosterPredictFromColumnar with the same category buffers find the mapping by the
+ * address of the buffers, without hashing or re-coding the categories. The categories are
+ * compared with a copy kept by the booster, buffers refilled with different categories
+ * are re-coded instead of using the cached mapping.
+ *
+ * Calling this function is optional. Without it, the cache is populated by the first
+ * prediction and looked up by a hash of the categories, which costs time linear to the
+ * size of the categories for each call.
+ *
+ * @since 3.1.0
+ *
+ * @param handle Booster handle.
+ * @param data   See @ref XGDMatrixCreateFromColumnar for more info. Only the categories
+ *               are used, the data can have zero rows.
+ * @param config Unused for now, pass NULL or "{}".
+ *
+ * @return 0 when success, -1 when failure happens
+ */
+XGB_DLL int XGBoosterRegisterCategories(BoosterHandle handle, char const *data,
+                                        char const *config);
+
 /**
  * \brief Inplace prediction from CPU CSR matrix.
  *
@@ -1645,7 +1755,8 @@ typedef void *TrackerHandle; /* NOLINT */
  * @param config JSON encoded parameters.
  *
  *   - dmlc_communicator: String, the type of tracker to create. Available options are
- *                        `rabit` and `federated`. See @ref TrackerHandle for more info.
+ *                        `rabit`, `shm` and `federated`. See @ref TrackerHandle for more
+ *                        info. The `shm` communicator uses the `rabit` tracker.
  *   - n_workers: Integer, the number of workers.
  *   - port: (Optional) Integer, the port this tracker should listen to.
  *   - timeout: (Optional) Integer, timeout in seconds for various networking
@@ -1658,6 +1769,8 @@ typedef void *TrackerHandle; /* NOLINT */
  *   - sortby: (Optional) Integer.
  *     + 0: Sort workers by their host name.
  *     + 1: Sort workers by task IDs.
+ *   - n_streams: (Optional) Integer, the number of TCP connections between each pair of
+ *                workers. Large messages are split across the connections. Default is 1.
  *
  *   Some `federated` specific configurations:
  *   - federated_secure: Boolean, whether this is a secure server. False for testing.
@@ -1730,6 +1843,8 @@ XGB_DLL int XGTrackerFree(TrackerHandle handle);
  *   - dmlc_communicator: The type of the communicator, this should match the tracker type.
  *     * rabit: Use Rabit. This is the default if the type is unspecified.
  *     * federated: Use the gRPC interface for Federated Learning.
+ *     * shm: Use shared memory between worker processes on the same host, bootstrapped by
+ *       the `rabit` tracker.
  *
  * Only applicable to the `rabit` communicator:
  *   - dmlc_tracker_uri: Hostname or IP address of the tracker.
@@ -1738,6 +1853,20 @@ XGB_DLL int XGTrackerFree(TrackerHandle handle);
  *   - dmlc_retry: The number of retries for connection failure.
  *   - dmlc_timeout: Timeout in seconds.
  *   - dmlc_nccl_path: Path to the nccl shared library `libnccl.so`.
+ *   - dmlc_allreduce_algo: Algorithm for the CPU allreduce, one of `auto`, `ring`,
+ *     `recursive_doubling`, and `rabenseifner`. The default `auto` selects the algorithm
+ *     based on the message size and the number of workers.
+ *   - dmlc_allreduce_hierarchical: Boolean, reduce through shared memory for workers on the
+ *     same host and run the allreduce only between hosts.
+ *   - dmlc_loop_backend: Backend for waiting on sockets, one of `auto`, `poll`, and `epoll`.
+ *     The default `auto` uses epoll on Linux and poll otherwise.
+ *   - dmlc_loop_busy_poll: Microseconds of polling without blocking before waiting on
+ *     sockets, only used by epoll. Defaults to 0.
+ *
+ * The `shm` communicator accepts the tracker, task, retry, timeout, nccl, and allreduce
+ * algorithm parameters of the `rabit` communicator, and:
+ *   - dmlc_shm_ring_bytes: Size of the ring buffer for each pair of workers, must be a
+ *     multiple of 64. Defaults to 1MiB.
  *
  * Only applicable to the `federated` communicator (use upper case for environment variables, use
  * lower case for runtime configuration):
@@ -1747,6 +1876,10 @@ XGB_DLL int XGTrackerFree(TrackerHandle handle);
  *   - federated_server_cert_path: Server certificate file path. Only needed for the SSL mode.
  *   - federated_client_key_path: Client key file path. Only needed for the SSL mode.
  *   - federated_client_cert_path: Client certificate file path. Only needed for the SSL mode.
+ *   - federated_chunk_bytes: Allreduce and broadcast buffers larger than this are streamed to
+ *     the server in chunks of this size. Workers use the smallest value among them. Defaults
+ *     to 1MiB. Servers without the streaming RPCs receive the buffers in a single message
+ *     instead.
  *
  * @return 0 for success, -1 for failure.
  */
@@ -189,6 +189,10 @@ struct PollHelper {
   [[nodiscard]] bool CheckWrite(xgboost::collective::TCPSocket const& socket) const {
     return this->CheckWrite(socket.Handle());
   }
+  /**
+   * @brief Remove all watched descriptors.
+   */
+  void Clear() { fds.clear(); }
   /**
    * @brief perform poll on the set defined, read, write, exception
    *
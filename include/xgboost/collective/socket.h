@@ -3,6 +3,7 @@
  */
 #pragma once
 
+#include <atomic>        // std::atomic
 #include <cerrno>        // errno, EINTR, EBADF
 #include <climits>       // HOST_NAME_MAX
 #include <cstddef>       // std::size_t
@@ -270,6 +271,8 @@ class TCPSocket {
 
  private:
   HandleT handle_{InvalidSocket()};
+  // Unique within the process, handles can be reused by the OS once a socket is closed.
+  std::uint64_t id_{0};
   bool non_blocking_{false};
   // There's reliable no way to extract domain from a socket without first binding that
   // socket on macos.
@@ -279,7 +282,12 @@ class TCPSocket {
 
   constexpr static HandleT InvalidSocket() { return INVALID_SOCKET; }
 
-  explicit TCPSocket(HandleT newfd) : handle_{newfd} {}
+  static std::uint64_t NextId() {
+    static std::atomic<std::uint64_t> id{0};
+    return ++id;
+  }
+
+  explicit TCPSocket(HandleT newfd) : handle_{newfd}, id_{NextId()} {}
 
  public:
   TCPSocket() = default;
@@ -527,16 +535,25 @@ class TCPSocket {
   }
 
   TCPSocket(TCPSocket const &that) = delete;
-  TCPSocket(TCPSocket &&that) noexcept(true) { std::swap(this->handle_, that.handle_); }
+  TCPSocket(TCPSocket &&that) noexcept(true) {
+    std::swap(this->handle_, that.handle_);
+    std::swap(this->id_, that.id_);
+  }
   TCPSocket &operator=(TCPSocket const &that) = delete;
   TCPSocket &operator=(TCPSocket &&that) noexcept(true) {
     std::swap(this->handle_, that.handle_);
+    std::swap(this->id_, that.id_);
     return *this;
   }
   /**
    * @brief Return the native socket file descriptor.
    */
   [[nodiscard]] HandleT const &Handle() const { return handle_; }
+  /**
+   * @brief Return an ID that is unique within the process. Unlike the handle, it's not
+   *        reused after the socket is closed.
+   */
+  [[nodiscard]] std::uint64_t Id() const { return id_; }
   /**
    * @brief Listen to incoming requests. Should be called after bind.
    *
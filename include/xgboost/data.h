@@ -541,6 +541,12 @@ struct ExtMemConfig {
   float missing;
   // The number of CPU threads.
   std::int32_t n_threads{0};
+  // Whether the gradient index in the CPU cache is bit-packed.
+  bool compress_cache{false};
+  // How the CPU cache is read, either `mmap` or `pread`.
+  std::string io_backend{"mmap"};
+  // Host memory budget for keeping CPU cache pages resident, for each type of page.
+  std::int64_t resident_cache_bytes{0};
   // The ratio of the cache that can be compressed. Used for testing.
   float hw_decomp_ratio{std::numeric_limits<float>::quiet_NaN()};
   // Fallback to using nvcomp. Used for testing.
@@ -556,6 +562,24 @@ struct ExtMemConfig {
         missing{missing},
         n_threads{n_threads} {}
 
+  ExtMemConfig& SetCompressCache(bool compress) {
+    this->compress_cache = compress;
+    return *this;
+  }
+
+  ExtMemConfig& SetIOBackend(std::string backend) {
+    CHECK(backend == "mmap" || backend == "pread")
+        << "Invalid I/O backend: `" << backend << "`, expecting `mmap` or `pread`.";
+    this->io_backend = std::move(backend);
+    return *this;
+  }
+
+  ExtMemConfig& SetResidentCacheBytes(std::int64_t n_bytes) {
+    CHECK_GE(n_bytes, 0) << "Invalid resident cache size.";
+    this->resident_cache_bytes = n_bytes;
+    return *this;
+  }
+
   ExtMemConfig& SetParamsForTest(float _hw_decomp_ratio, bool _allow_decomp_fallback) {
     this->hw_decomp_ratio = _hw_decomp_ratio;
     this->allow_decomp_fallback = _allow_decomp_fallback;
@@ -30,6 +30,10 @@ struct Context;
 struct LearnerModelParam;
 struct PredictionCacheEntry;
 
+namespace common {
+class HistogramCuts;
+}  // namespace common
+
 /*!
  * \brief interface of gradient boosting model.
  */
@@ -157,6 +161,17 @@ class GradientBooster : public Model, public Configurable {
     LOG(FATAL) << "Retrieving categories is not supported by the current booster.";
     return nullptr;
   }
+  /**
+   * @brief Getter for the quantile cuts stored in the model.
+   *
+   * @param max_bin The `max_bin` used to generate the cuts.
+   *
+   * @return nullptr if the model doesn't have the cuts.
+   */
+  [[nodiscard]] virtual common::HistogramCuts const* Cuts(bst_bin_t* max_bin) const {
+    *max_bin = 0;
+    return nullptr;
+  }
   /**
    * @brief create a gradient booster from given name
    * @param name name of gradient booster
@@ -11,11 +11,13 @@
 #include <xgboost/parameter.h>  // for XGBoostParameter
 
 #include <cstdint>  // for int32_t
+#include <string>   // for string
 
 namespace xgboost {
 struct GlobalConfiguration : public XGBoostParameter<GlobalConfiguration> {
   std::int32_t verbosity{1};
   bool use_rmm{false};
+  std::string sketch_method{"wq"};
   // This is not a dmlc parameter to avoid conflict with the context class.
   std::int32_t nthread{0};
   DMLC_DECLARE_PARAMETER(GlobalConfiguration) {
@@ -25,6 +27,9 @@ struct GlobalConfiguration : public XGBoostParameter<GlobalConfiguration> {
         .describe("Flag to print out detailed breakdown of runtime.");
     DMLC_DECLARE_FIELD(use_rmm).set_default(false).describe(
         "Whether to use RAPIDS Memory Manager to allocate GPU memory in XGBoost");
+    DMLC_DECLARE_FIELD(sketch_method)
+        .set_default("wq")
+        .describe("Quantile sketch used for CPU inputs, either `wq` or `sort`.");
   }
 };
 
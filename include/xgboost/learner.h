@@ -37,6 +37,10 @@ template <typename T>
 class HostDeviceVector;
 class CatContainer;
 
+namespace common {
+class HistogramCuts;
+}  // namespace common
+
 enum class PredictionType : std::uint8_t {  // NOLINT
   kValue = 0,
   kMargin = 1,
@@ -226,6 +230,14 @@ class Learner : public Model, public Configurable, public dmlc::Serializable {
    * @brief Getter for categories.
    */
   [[nodiscard]] virtual CatContainer const* Cats() const = 0;
+  /**
+   * @brief Getter for the quantile cuts saved with the `save_cuts` parameter.
+   *
+   * @param max_bin The `max_bin` used to generate the cuts.
+   *
+   * @return nullptr if the model doesn't have the cuts.
+   */
+  [[nodiscard]] virtual common::HistogramCuts const* Cuts(bst_bin_t* max_bin) const = 0;
   /**
    * @brief Slice the model.
    *
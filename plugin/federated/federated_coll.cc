@@ -1,17 +1,23 @@
 /**
- * Copyright 2023, XGBoost contributors
+ * Copyright 2023-2025, XGBoost contributors
  */
 #include "federated_coll.h"
 
 #include <federated.grpc.pb.h>
 #include <federated.pb.h>
 
-#include <algorithm>  // for copy_n
+#include <algorithm>  // for copy_n, max, min
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <memory>     // for unique_ptr
+#include <string>     // for string, to_string
+#include <thread>     // for thread
 
 #include "../../src/collective/allgather.h"
-#include "../../src/common/common.h"    // for AssertGPUSupport
-#include "federated_comm.h"             // for FederatedComm
-#include "xgboost/collective/result.h"  // for Result
+#include "../../src/common/common.h"         // for AssertGPUSupport, DivRoundUp
+#include "../../src/data/array_interface.h"  // for DispatchDType
+#include "federated_comm.h"                  // for FederatedComm
+#include "xgboost/collective/result.h"       // for Result
 
 namespace xgboost::collective {
 namespace {
@@ -20,18 +26,163 @@ namespace {
               status.error_message());
 }
 
-[[nodiscard]] Result BroadcastImpl(Comm const &comm, std::uint64_t *sequence_number,
+void WarnUnimplemented() {
+  LOG(WARNING) << "The federated server doesn't support streaming, large buffers are sent "
+                  "in a single message.";
+}
+
+[[nodiscard]] std::size_t NumChunks(std::size_t n_bytes, std::size_t chunk_bytes) {
+  return std::max(common::DivRoundUp(n_bytes, chunk_bytes), std::size_t{1});
+}
+
+/**
+ * @brief Send the requests for all chunks through a bidirectional stream.
+ *
+ *   Requests are written by a separate thread so that the server can receive the next chunk
+ *   while aggregating the current one. The gRPC flow control blocks the writer when the
+ *   server falls behind, only the chunk being sent and the last reply are held in memory.
+ *
+ * @param unimplemented Set to true if the server doesn't have the streaming RPC. No round
+ *                      is consumed on the server in this case.
+ */
+template <typename Request, typename Reply, typename MakeRequest, typename OnReply>
+[[nodiscard]] Result StreamImpl(
+    std::string const &name, grpc::ClientContext *context,
+    std::unique_ptr<grpc::ClientReaderWriter<Request, Reply>> stream, std::size_t n_chunks,
+    MakeRequest &&make_request, OnReply &&on_reply, bool *unimplemented) {
+  *unimplemented = false;
+  std::thread writer{[&] {
+    Request request;
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+      make_request(i, &request);
+      if (!stream->Write(request)) {
+        // The stream is broken, the error is obtained from `Finish`.
+        return;
+      }
+    }
+    stream->WritesDone();
+  }};
+
+  Reply reply;
+  std::size_t i = 0;
+  try {
+    for (; i < n_chunks && stream->Read(&reply); ++i) {
+      on_reply(i, reply);
+    }
+  } catch (...) {
+    context->TryCancel();
+    writer.join();
+    throw;
+  }
+  if (i != n_chunks) {
+    // Unblock the writer.
+    context->TryCancel();
+  }
+  writer.join();
+
+  auto status = stream->Finish();
+  if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED && i == 0) {
+    *unimplemented = true;
+    return Success();
+  }
+  if (!status.ok()) {
+    return GetGRPCResult(name, status);
+  }
+  if (i != n_chunks) {
+    return Fail(name + " stream ended with " + std::to_string(i) + " replies out of " +
+                std::to_string(n_chunks) + " chunks.");
+  }
+  return Success();
+}
+
+[[nodiscard]] Result AllreduceUnary(FederatedComm const *fed, std::uint64_t *sequence_number,
+                                    common::Span<std::int8_t> data,
+                                    ArrayInterfaceHandler::Type type, Op op) {
+  using namespace federated;  // NOLINT
+  auto stub = fed->Handle();
+
+  AllreduceRequest request;
+  request.set_sequence_number((*sequence_number)++);
+  request.set_rank(fed->Rank());
+  request.set_send_buffer(data.data(), data.size());
+  request.set_data_type(static_cast<::xgboost::collective::federated::DataType>(type));
+  request.set_reduce_operation(static_cast<::xgboost::collective::federated::ReduceOperation>(op));
+
+  AllreduceReply reply;
+  grpc::ClientContext context;
+  context.set_wait_for_ready(true);
+  grpc::Status status = stub->Allreduce(&context, request, &reply);
+  if (!status.ok()) {
+    return GetGRPCResult("Allreduce", status);
+  }
+  auto const &r = reply.receive_buffer();
+  std::copy_n(r.cbegin(), r.size(), data.data());
+  return Success();
+}
+
+[[nodiscard]] Result BroadcastStreamImpl(FederatedComm const *fed, std::uint64_t *sequence_number,
+                                         std::size_t chunk_bytes, common::Span<std::int8_t> data,
+                                         std::int32_t root, bool *unimplemented) {
+  using namespace federated;  // NOLINT
+
+  auto n_chunks = NumChunks(data.size(), chunk_bytes);
+  auto seq = *sequence_number;
+  // Each chunk is a round on the server.
+  *sequence_number += n_chunks;
+  auto rank = fed->Rank();
+
+  grpc::ClientContext context;
+  context.set_wait_for_ready(true);
+  auto rc = StreamImpl(
+      "BroadcastStream", &context, fed->Handle()->BroadcastStream(&context), n_chunks,
+      [&](std::size_t i, BroadcastRequest *request) {
+        request->set_sequence_number(seq + i);
+        request->set_rank(rank);
+        if (rank != root) {
+          request->set_send_buffer(nullptr, 0);
+        } else {
+          auto beg = i * chunk_bytes;
+          auto chunk = data.subspan(beg, std::min(chunk_bytes, data.size() - beg));
+          request->set_send_buffer(chunk.data(), chunk.size());
+        }
+        request->set_root(root);
+      },
+      [&](std::size_t i, BroadcastReply const &reply) {
+        if (rank != root) {
+          auto const &r = reply.receive_buffer();
+          auto beg = i * chunk_bytes;
+          CHECK_EQ(r.size(), std::min(chunk_bytes, data.size() - beg));
+          std::copy_n(r.cbegin(), r.size(), data.data() + beg);
+        }
+      },
+      unimplemented);
+  if (*unimplemented) {
+    *sequence_number = seq;
+  }
+  return rc;
+}
+
+[[nodiscard]] Result BroadcastImpl(FederatedComm const *fed, std::uint64_t *sequence_number,
+                                   bool *use_stream, std::size_t chunk_bytes,
                                    common::Span<std::int8_t> data, std::int32_t root) {
   using namespace federated;  // NOLINT
 
-  auto fed = dynamic_cast<FederatedComm const *>(&comm);
-  CHECK(fed);
+  if (*use_stream && data.size() > chunk_bytes) {
+    bool unimplemented{false};
+    auto rc =
+        BroadcastStreamImpl(fed, sequence_number, chunk_bytes, data, root, &unimplemented);
+    if (!unimplemented) {
+      return rc;
+    }
+    WarnUnimplemented();
+    *use_stream = false;
+  }
   auto stub = fed->Handle();
 
   BroadcastRequest request;
   request.set_sequence_number((*sequence_number)++);
-  request.set_rank(comm.Rank());
-  if (comm.Rank() != root) {
+  request.set_rank(fed->Rank());
+  if (fed->Rank() != root) {
     request.set_send_buffer(nullptr, 0);
   } else {
     request.set_send_buffer(data.data(), data.size());
@@ -45,7 +196,7 @@ namespace {
   if (!status.ok()) {
     return GetGRPCResult("Broadcast", status);
   }
-  if (comm.Rank() != root) {
+  if (fed->Rank() != root) {
     auto const &r = reply.receive_buffer();
     std::copy_n(r.cbegin(), r.size(), data.data());
   }
@@ -61,41 +212,103 @@ Coll *FederatedColl::MakeCUDAVar() {
 }
 #endif
 
+[[nodiscard]] Result FederatedColl::AgreeChunkBytes(FederatedComm const *fed) {
+  if (chunk_bytes_ != 0) {
+    return Success();
+  }
+  // Each chunk is a round on the server, all workers must use the same chunks.
+  auto chunk_bytes = static_cast<std::int64_t>(fed->ChunkBytes());
+  auto rc = AllreduceUnary(fed, &sequence_number_, common::EraseType(common::Span{&chunk_bytes, 1}),
+                           ArrayInterfaceHandler::kI8, Op::kMin);
+  if (!rc.OK()) {
+    return Fail("Failed to agree on the chunk size for streaming.", std::move(rc));
+  }
+  CHECK_GT(chunk_bytes, 0);
+  chunk_bytes_ = static_cast<std::size_t>(chunk_bytes);
+  return Success();
+}
+
 [[nodiscard]] Result FederatedColl::Allreduce(Comm const &comm, common::Span<std::int8_t> data,
                                               ArrayInterfaceHandler::Type type, Op op) {
-  using namespace federated;  // NOLINT
   auto fed = dynamic_cast<FederatedComm const *>(&comm);
   CHECK(fed);
-  auto stub = fed->Handle();
+  auto rc = this->AgreeChunkBytes(fed);
+  if (!rc.OK()) {
+    return rc;
+  }
+  if (use_stream_ && data.size() > chunk_bytes_) {
+    bool unimplemented{false};
+    rc = this->AllreduceStream(fed, data, type, op, &unimplemented);
+    if (!unimplemented) {
+      return rc;
+    }
+    WarnUnimplemented();
+    use_stream_ = false;
+  }
+  return AllreduceUnary(fed, &sequence_number_, data, type, op);
+}
 
-  AllreduceRequest request;
-  request.set_sequence_number(sequence_number_++);
-  request.set_rank(comm.Rank());
-  request.set_send_buffer(data.data(), data.size());
-  request.set_data_type(static_cast<::xgboost::collective::federated::DataType>(type));
-  request.set_reduce_operation(static_cast<::xgboost::collective::federated::ReduceOperation>(op));
+[[nodiscard]] Result FederatedColl::AllreduceStream(FederatedComm const *fed,
+                                                    common::Span<std::int8_t> data,
+                                                    ArrayInterfaceHandler::Type type, Op op,
+                                                    bool *unimplemented) {
+  using namespace federated;  // NOLINT
+
+  // Chunks must not split an element.
+  auto n_bytes_type = DispatchDType(type, [](auto t) { return sizeof(t); });
+  auto chunk_bytes = std::max(chunk_bytes_ / n_bytes_type, std::size_t{1}) * n_bytes_type;
+  auto n_chunks = NumChunks(data.size(), chunk_bytes);
+  auto seq = sequence_number_;
+  // Each chunk is a round on the server.
+  sequence_number_ += n_chunks;
+  auto rank = fed->Rank();
 
-  AllreduceReply reply;
   grpc::ClientContext context;
   context.set_wait_for_ready(true);
-  grpc::Status status = stub->Allreduce(&context, request, &reply);
-  if (!status.ok()) {
-    return GetGRPCResult("Allreduce", status);
+  auto rc = StreamImpl(
+      "AllreduceStream", &context, fed->Handle()->AllreduceStream(&context), n_chunks,
+      [&](std::size_t i, AllreduceRequest *request) {
+        auto beg = i * chunk_bytes;
+        auto chunk = data.subspan(beg, std::min(chunk_bytes, data.size() - beg));
+        request->set_sequence_number(seq + i);
+        request->set_rank(rank);
+        request->set_send_buffer(chunk.data(), chunk.size());
+        request->set_data_type(static_cast<federated::DataType>(type));
+        request->set_reduce_operation(static_cast<federated::ReduceOperation>(op));
+      },
+      [&](std::size_t i, AllreduceReply const &reply) {
+        auto const &r = reply.receive_buffer();
+        auto beg = i * chunk_bytes;
+        CHECK_EQ(r.size(), std::min(chunk_bytes, data.size() - beg));
+        std::copy_n(r.cbegin(), r.size(), data.data() + beg);
+      },
+      unimplemented);
+  if (*unimplemented) {
+    sequence_number_ = seq;
   }
-  auto const &r = reply.receive_buffer();
-  std::copy_n(r.cbegin(), r.size(), data.data());
-  return Success();
+  return rc;
 }
 
 [[nodiscard]] Result FederatedColl::Broadcast(Comm const &comm, common::Span<std::int8_t> data,
                                               std::int32_t root) {
-  return BroadcastImpl(comm, &this->sequence_number_, data, root);
+  auto fed = dynamic_cast<FederatedComm const *>(&comm);
+  CHECK(fed);
+  auto rc = this->AgreeChunkBytes(fed);
+  if (!rc.OK()) {
+    return rc;
+  }
+  return BroadcastImpl(fed, &this->sequence_number_, &this->use_stream_, this->chunk_bytes_, data,
+                       root);
 }
 
 [[nodiscard]] Result FederatedColl::Allgather(Comm const &comm, common::Span<std::int8_t> data) {
   using namespace federated;  // NOLINT
   auto fed = dynamic_cast<FederatedComm const *>(&comm);
   CHECK(fed);
+  auto rc = this->AgreeChunkBytes(fed);
+  if (!rc.OK()) {
+    return rc;
+  }
   auto stub = fed->Handle();
   auto size = data.size_bytes() / comm.World();
 
@@ -129,6 +342,10 @@ Coll *FederatedColl::MakeCUDAVar() {
 
   auto fed = dynamic_cast<FederatedComm const *>(&comm);
   CHECK(fed);
+  auto rc = this->AgreeChunkBytes(fed);
+  if (!rc.OK()) {
+    return rc;
+  }
   auto stub = fed->Handle();
 
   AllgatherVRequest request;
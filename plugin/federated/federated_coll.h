@@ -1,14 +1,34 @@
 /**
- * Copyright 2023-2024, XGBoost contributors
+ * Copyright 2023-2025, XGBoost contributors
  */
 #pragma once
 #include "../../src/collective/coll.h"    // for Coll
 #include "../../src/collective/comm.h"    // for Comm
 
 namespace xgboost::collective {
+class FederatedComm;
+
+/**
+ * @brief Collective operations through the federated server.
+ *
+ *   Buffers larger than @ref FederatedComm::ChunkBytes are streamed to the server in
+ *   chunks, each chunk is aggregated as a separate round. The workers agree on the smallest
+ *   chunk size in the first collective call. If the server doesn't implement the streaming
+ *   RPCs, the buffers are sent as single messages instead.
+ */
 class FederatedColl : public Coll {
  private:
   std::uint64_t sequence_number_{0};
+  // Disabled once the server reports that streaming is not implemented.
+  bool use_stream_{true};
+  // Chunk size agreed by all workers, 0 before the first collective call.
+  std::size_t chunk_bytes_{0};
+
+  [[nodiscard]] Result AgreeChunkBytes(FederatedComm const *fed);
+
+  [[nodiscard]] Result AllreduceStream(FederatedComm const *fed, common::Span<std::int8_t> data,
+                                       ArrayInterfaceHandler::Type type, Op op,
+                                       bool *unimplemented);
 
  public:
   Coll *MakeCUDAVar() override;
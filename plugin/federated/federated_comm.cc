@@ -1,5 +1,5 @@
 /**
- * Copyright 2023-2024, XGBoost contributors
+ * Copyright 2023-2025, XGBoost contributors
  */
 #include "federated_comm.h"
 
@@ -8,7 +8,7 @@
 #include <cstdint>  // for int32_t
 #include <cstdlib>  // for getenv
 #include <limits>   // for numeric_limits
-#include <string>   // for string, stoi
+#include <string>   // for string, stoi, stoll
 
 #include "../../src/common/common.h"      // for Split
 #include "../../src/common/io.h"          // for ReadAll
@@ -123,6 +123,18 @@ FederatedComm::FederatedComm(std::int32_t retry, std::chrono::seconds timeout, s
   client_key = OptionalArg<String>(config, "federated_client_key_path", client_key);
   client_cert = OptionalArg<String>(config, "federated_client_cert_path", client_cert);
 
+  /**
+   * Streaming
+   */
+  auto chunk_bytes = static_cast<Integer::Int>(DefaultChunkBytes());
+  value = getenv("FEDERATED_CHUNK_BYTES");
+  if (value != nullptr) {
+    chunk_bytes = std::stoll(value);
+  }
+  chunk_bytes = OptionalArg<Integer>(config, "federated_chunk_bytes", chunk_bytes);
+  CHECK_GT(chunk_bytes, 0) << "`federated_chunk_bytes` must be positive.";
+  this->chunk_bytes_ = static_cast<std::size_t>(chunk_bytes);
+
   this->Init(parsed[0], std::stoi(parsed[1]), world_size, rank, server_cert, client_key,
              client_cert);
 }
@@ -1,5 +1,5 @@
 /**
- * Copyright 2023-2024, XGBoost contributors
+ * Copyright 2023-2025, XGBoost contributors
  */
 #pragma once
 
@@ -7,6 +7,7 @@
 #include <federated.pb.h>
 
 #include <chrono>   // for seconds
+#include <cstddef>  // for size_t
 #include <cstdint>  // for int32_t
 #include <memory>   // for shared_ptr
 #include <string>   // for string
@@ -16,14 +17,21 @@
 
 namespace xgboost::collective {
 class FederatedComm : public HostComm {
+ public:
+  static constexpr std::size_t DefaultChunkBytes() { return 1024 * 1024; }
+
+ private:
   std::shared_ptr<federated::Federated::Stub> stub_;
+  // Buffers larger than this are streamed to the server in chunks.
+  std::size_t chunk_bytes_{DefaultChunkBytes()};
 
   void Init(std::string const& host, std::int32_t port, std::int32_t world, std::int32_t rank,
             std::string const& server_cert, std::string const& client_key,
             std::string const& client_cert);
 
  protected:
-  explicit FederatedComm(std::shared_ptr<FederatedComm const> that) : stub_{that->stub_} {
+  explicit FederatedComm(std::shared_ptr<FederatedComm const> that)
+      : stub_{that->stub_}, chunk_bytes_{that->chunk_bytes_} {
     this->rank_ = that->Rank();
     this->world_ = that->World();
 
@@ -44,6 +52,7 @@ class FederatedComm : public HostComm {
    * - federated_server_cert_path
    * - federated_client_key_path
    * - federated_client_cert_path
+   * - federated_chunk_bytes: Size of each message for streaming large buffers.
    */
   explicit FederatedComm(std::int32_t retry, std::chrono::seconds timeout, std::string task_id,
                          Json const& config);
@@ -63,6 +72,7 @@ class FederatedComm : public HostComm {
   }
   [[nodiscard]] bool IsFederated() const override { return true; }
   [[nodiscard]] federated::Federated::Stub* Handle() const { return stub_.get(); }
+  [[nodiscard]] std::size_t ChunkBytes() const { return chunk_bytes_; }
 
   [[nodiscard]] Comm* MakeCUDAVar(Context const* ctx, std::shared_ptr<Coll> pimpl) const override;
   /**
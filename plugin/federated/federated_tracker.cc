@@ -1,5 +1,5 @@
 /**
- * Copyright 2022-2024, XGBoost contributors
+ * Copyright 2022-2025, XGBoost contributors
  */
 #include "federated_tracker.h"
 
@@ -47,6 +47,42 @@ grpc::Status FederatedService::Broadcast(grpc::ServerContext*, BroadcastRequest
                      request->root());
   return grpc::Status::OK;
 }
+
+// Each chunk is handled as an independent round by the in-memory handler. The transport
+// keeps receiving the next chunk while the current one is being aggregated, and only one
+// chunk is held by the handler at a time.
+grpc::Status FederatedService::AllreduceStream(
+    grpc::ServerContext*, grpc::ServerReaderWriter<AllreduceReply, AllreduceRequest>* stream) {
+  AllreduceRequest request;
+  AllreduceReply reply;
+  while (stream->Read(&request)) {
+    reply.Clear();
+    handler_.Allreduce(request.send_buffer().data(), request.send_buffer().size(),
+                       reply.mutable_receive_buffer(), request.sequence_number(), request.rank(),
+                       static_cast<xgboost::ArrayInterfaceHandler::Type>(request.data_type()),
+                       static_cast<xgboost::collective::Op>(request.reduce_operation()));
+    if (!stream->Write(reply)) {
+      return grpc::Status{grpc::StatusCode::CANCELLED, "Failed to write the allreduce reply."};
+    }
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status FederatedService::BroadcastStream(
+    grpc::ServerContext*, grpc::ServerReaderWriter<BroadcastReply, BroadcastRequest>* stream) {
+  BroadcastRequest request;
+  BroadcastReply reply;
+  while (stream->Read(&request)) {
+    reply.Clear();
+    handler_.Broadcast(request.send_buffer().data(), request.send_buffer().size(),
+                       reply.mutable_receive_buffer(), request.sequence_number(), request.rank(),
+                       request.root());
+    if (!stream->Write(reply)) {
+      return grpc::Status{grpc::StatusCode::CANCELLED, "Failed to write the broadcast reply."};
+    }
+  }
+  return grpc::Status::OK;
+}
 }  // namespace federated
 
 FederatedTracker::FederatedTracker(Json const& config) : Tracker{config} {
@@ -1,5 +1,5 @@
 /**
- * Copyright 2022-2023, XGBoost contributors
+ * Copyright 2022-2025, XGBoost contributors
  */
 #pragma once
 #include <federated.grpc.pb.h>  // for Server
@@ -31,6 +31,14 @@ class FederatedService final : public Federated::Service {
   grpc::Status Broadcast(grpc::ServerContext* context, BroadcastRequest const* request,
                          BroadcastReply* reply) override;
 
+  grpc::Status AllreduceStream(
+      grpc::ServerContext* context,
+      grpc::ServerReaderWriter<AllreduceReply, AllreduceRequest>* stream) override;
+
+  grpc::Status BroadcastStream(
+      grpc::ServerContext* context,
+      grpc::ServerReaderWriter<BroadcastReply, BroadcastRequest>* stream) override;
+
  private:
   xgboost::collective::InMemoryHandler handler_;
 };
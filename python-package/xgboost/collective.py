@@ -76,6 +76,8 @@ def init(**args: _ArgVals) -> None:
           - dmlc_communicator: The type of the communicator.
             * rabit: Use Rabit. This is the default if the type is unspecified.
             * federated: Use the gRPC interface for Federated Learning.
+            * shm: Use shared memory between worker processes on the same host,
+              bootstrapped by the Rabit tracker.
 
         Only applicable to the Rabit communicator:
           - dmlc_tracker_uri: Hostname of the tracker.
@@ -84,6 +86,19 @@ def init(**args: _ArgVals) -> None:
           - dmlc_retry: The number of retry when handling network errors.
           - dmlc_timeout: Timeout in seconds.
           - dmlc_nccl_path: Path to load (dlopen) nccl for GPU-based communication.
+          - dmlc_allreduce_algo: Algorithm for the CPU allreduce, one of `auto`,
+            `ring`, `recursive_doubling`, and `rabenseifner`.
+          - dmlc_allreduce_hierarchical: Reduce through shared memory for workers on
+            the same host and run the allreduce only between hosts.
+          - dmlc_loop_backend: Backend for waiting on sockets, one of `auto`, `poll`,
+            and `epoll`. The default `auto` uses epoll on Linux and poll otherwise.
+          - dmlc_loop_busy_poll: Microseconds of polling without blocking before
+            waiting on sockets, only used by epoll.
+
+        The shm communicator accepts the tracker, task, retry, timeout, nccl, and
+        allreduce algorithm parameters of the Rabit communicator, and:
+          - dmlc_shm_ring_bytes: Size of the ring buffer for each pair of workers, must
+            be a multiple of 64.
 
         Only applicable to the Federated communicator:
           - federated_server_address: Address of the federated server.
@@ -94,6 +109,10 @@ def init(**args: _ArgVals) -> None:
           - federated_client_key: Client key file path. Only needed for the SSL mode.
           - federated_client_cert: Client certificate file path. Only needed for the SSL
             mode.
+          - federated_chunk_bytes: Allreduce and broadcast buffers larger than this are
+            streamed to the server in chunks of this size. Workers use the smallest
+            value among them. Servers without the streaming RPCs receive the buffers in a
+            single message instead.
 
         Use upper case for environment variables, use lower case for runtime
         configuration.
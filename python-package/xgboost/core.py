@@ -1660,6 +1660,14 @@ class QuantileDMatrix(DMatrix, _RefMixIn):
         reference (the training dataset) ``QuantileDMatrix`` using ``ref`` as some
         information may be lost in quantisation.
 
+    .. note::
+
+        A CPU ``QuantileDMatrix`` can be sliced by rows, for instance by
+        :py:func:`xgboost.cv`. The slice reuses the quantile cuts but it's not a view,
+        each slice holds a copy of the selected rows in the quantized form, along with a
+        new column index. Cross validation with ``k`` folds needs about ``k`` times the
+        memory of the quantized input on top of the input itself.
+
     .. versionadded:: 1.7.0
 
     Examples
@@ -58,6 +58,15 @@ class RabitTracker:
         the tracker even if the tracker is still being used. A value error is raised
         when timeout is reached.
 
+    n_streams :
+
+        .. versionadded:: 3.1.0
+
+        Number of TCP connections between each pair of workers. Large messages are split
+        into parts and sent over the connections in parallel, which can help saturate
+        high-bandwidth networks where a single TCP stream is limited by the network
+        stack.
+
     Examples
     --------
 
@@ -89,11 +98,14 @@ class RabitTracker:
         *,
         sortby: str = "host",
         timeout: int = 0,
+        n_streams: int = 1,
     ) -> None:
 
         handle = ctypes.c_void_p()
         if sortby not in ("host", "task"):
             raise ValueError("Expecting either 'host' or 'task' for sortby.")
+        if n_streams < 1:
+            raise ValueError("Expecting a positive number for n_streams.")
         if host_ip is not None:
             get_family(host_ip)  # use python socket to stop early for invalid address
         args = make_jcargs(
@@ -103,6 +115,7 @@ class RabitTracker:
             dmlc_communicator="rabit",
             sortby=self._SortBy.HOST if sortby == "host" else self._SortBy.TASK,
             timeout=int(timeout),
+            n_streams=int(n_streams),
         )
         _check_call(_LIB.XGTrackerCreate(args, ctypes.byref(handle)))
         self.handle = handle
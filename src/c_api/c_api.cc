@@ -22,9 +22,12 @@
 #include "../common/io.h"                // for FileExtension, LoadSequentialFile, MemoryBuf...
 #include "../common/threading_utils.h"   // for OmpGetNumThreads, ParallelFor
 #include "../data/adapter.h"             // for ArrayAdapter, DenseAdapter
+#include "../data/arrow_ipc.h"           // for ArrowIPCIterator
 #include "../data/batch_utils.h"         // for MatchingPageBytes, CachePageRatio
+#include "../data/buffered_iter.h"       // for BufferedDataIter
 #include "../data/cat_container.h"       // for CatContainer
 #include "../data/ellpack_page.h"        // for EllpackPage
+#include "../data/iterative_dmatrix.h"   // for IterativeDMatrix
 #include "../data/proxy_dmatrix.h"       // for DMatrixProxy
 #include "../data/simple_dmatrix.h"      // for SimpleDMatrix
 #include "../encoder/types.h"            // for Overloaded
@@ -332,6 +335,10 @@ XGB_DLL int XGDMatrixCreateFromCallback(DataIterHandle iter, DMatrixHandle proxy
       << "Page concatenation is not supported by the DMatrix yet.";
   auto cache_host_ratio =
       OptionalArg<Number, float>(jconfig, "cache_host_ratio", cuda_impl::AutoHostRatio());
+  auto compress_cache = OptionalArg<Boolean>(jconfig, "compress_cache", false);
+  auto io_backend = OptionalArg<String, std::string>(jconfig, "io_backend", std::string{"mmap"});
+  auto resident_cache_bytes =
+      OptionalArg<Integer, std::int64_t>(jconfig, "resident_cache_bytes", 0);
 
   xgboost_CHECK_C_ARG_PTR(next);
   xgboost_CHECK_C_ARG_PTR(reset);
@@ -339,6 +346,9 @@ XGB_DLL int XGDMatrixCreateFromCallback(DataIterHandle iter, DMatrixHandle proxy
 
   auto config =
       ExtMemConfig{cache, on_host, cache_host_ratio, min_cache_page_bytes, missing, n_threads};
+  config.SetCompressCache(compress_cache)
+      .SetIOBackend(io_backend)
+      .SetResidentCacheBytes(resident_cache_bytes);
   *out = new std::shared_ptr<xgboost::DMatrix>{
       xgboost::DMatrix::Create(iter, proxy, reset, next, config)};
   API_END();
@@ -372,13 +382,29 @@ XGB_DLL int XGQuantileDMatrixCreateFromCallback(DataIterHandle iter, DMatrixHand
   auto max_bin = OptionalArg<Integer, int64_t>(jconfig, "max_bin", 256);
   auto max_quantile_blocks = OptionalArg<Integer, std::int64_t>(
       jconfig, "max_quantile_blocks", std::numeric_limits<std::int64_t>::max());
+  auto single_pass = OptionalArg<Boolean>(jconfig, "single_pass", false);
+  auto single_pass_max_bytes =
+      OptionalArg<Integer, std::int64_t>(jconfig, "single_pass_max_bytes",
+                                         data::BufferedDataIter::DefaultMaxBytes());
+  CHECK_GE(single_pass_max_bytes, 0) << "`single_pass_max_bytes` must be non-negative.";
 
   xgboost_CHECK_C_ARG_PTR(next);
   xgboost_CHECK_C_ARG_PTR(reset);
   xgboost_CHECK_C_ARG_PTR(out);
 
-  *out = new std::shared_ptr<xgboost::DMatrix>{xgboost::DMatrix::Create(
-      iter, proxy, p_ref, reset, next, missing, n_threads, max_bin, max_quantile_blocks)};
+  if (single_pass) {
+    // The buffer is only needed during construction.
+    data::BufferedDataIter buffered{iter, proxy, reset, next, missing,
+                                    static_cast<std::int32_t>(n_threads),
+                                    static_cast<std::size_t>(single_pass_max_bytes)};
+    *out = new std::shared_ptr<xgboost::DMatrix>{
+        xgboost::DMatrix::Create(static_cast<DataIterHandle>(&buffered), proxy, p_ref,
+                                 data::bufiter::Reset, data::bufiter::Next, missing, n_threads,
+                                 max_bin, max_quantile_blocks)};
+  } else {
+    *out = new std::shared_ptr<xgboost::DMatrix>{xgboost::DMatrix::Create(
+        iter, proxy, p_ref, reset, next, missing, n_threads, max_bin, max_quantile_blocks)};
+  }
   API_END();
 }
 
@@ -403,6 +429,10 @@ XGB_DLL int XGExtMemQuantileDMatrixCreateFromCallback(DataIterHandle iter, DMatr
       jconfig, "max_quantile_blocks", std::numeric_limits<std::int64_t>::max());
   auto cache_host_ratio =
       OptionalArg<Number, float>(jconfig, "cache_host_ratio", cuda_impl::AutoHostRatio());
+  auto compress_cache = OptionalArg<Boolean>(jconfig, "compress_cache", false);
+  auto io_backend = OptionalArg<String, std::string>(jconfig, "io_backend", std::string{"mmap"});
+  auto resident_cache_bytes =
+      OptionalArg<Integer, std::int64_t>(jconfig, "resident_cache_bytes", 0);
 
   xgboost_CHECK_C_ARG_PTR(next);
   xgboost_CHECK_C_ARG_PTR(reset);
@@ -410,11 +440,69 @@ XGB_DLL int XGExtMemQuantileDMatrixCreateFromCallback(DataIterHandle iter, DMatr
 
   auto config =
       ExtMemConfig{cache, on_host, cache_host_ratio, min_cache_page_bytes, missing, n_threads};
+  config.SetCompressCache(compress_cache)
+      .SetIOBackend(io_backend)
+      .SetResidentCacheBytes(resident_cache_bytes);
   *out = new std::shared_ptr<xgboost::DMatrix>{xgboost::DMatrix::Create(
       iter, proxy, p_ref, reset, next, max_bin, max_quantile_blocks, config)};
   API_END();
 }
 
+XGB_DLL int XGQuantileDMatrixCreateFromArrowIPC(char const *path, char const *config,
+                                                DMatrixHandle *out) {
+  API_BEGIN();
+  xgboost_CHECK_C_ARG_PTR(path);
+  xgboost_CHECK_C_ARG_PTR(config);
+  xgboost_CHECK_C_ARG_PTR(out);
+
+  auto jconfig = Json::Load(StringView{config});
+  auto label = OptionalArg<String, std::string>(jconfig, "label", std::string{});
+  auto weight = OptionalArg<String, std::string>(jconfig, "weight", std::string{});
+  auto const &obj = get<Object const>(jconfig);
+  auto it = obj.find("cache_prefix");
+  bool is_extmem = it != obj.cend() && !IsA<Null>(it->second);
+
+  // The iterator is only used during construction.
+  data::ArrowIPCIterator iter{path, label, weight};
+  auto create = is_extmem ? XGExtMemQuantileDMatrixCreateFromCallback
+                          : XGQuantileDMatrixCreateFromCallback;
+  auto ret = create(&iter, iter.Proxy(), nullptr, data::arrowipc::Reset, data::arrowipc::Next,
+                    config, out);
+  if (ret != 0) {
+    return ret;
+  }
+  API_END();
+}
+
+XGB_DLL int XGQuantileDMatrixCreateFromBooster(BoosterHandle handle, char const * /*config*/,
+                                               DMatrixHandle *out) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(out);
+
+  auto *learner = static_cast<Learner *>(handle);
+  learner->Configure();
+  bst_bin_t max_bin{0};
+  auto const *p_cuts = learner->Cuts(&max_bin);
+  CHECK(p_cuts) << "The booster doesn't have quantile cuts. Train the booster with the `hist` "
+                   "tree method and `save_cuts` set to true.";
+
+  MetaInfo info;
+  info.num_col_ = learner->GetNumFeature();
+  std::vector<std::string> feature_types;
+  learner->GetFeatureTypes(&feature_types);
+  if (!feature_types.empty()) {
+    std::vector<char const *> c_feature_types(feature_types.size());
+    std::transform(feature_types.cbegin(), feature_types.cend(), c_feature_types.begin(),
+                   [](auto const &str) { return str.c_str(); });
+    info.SetFeatureInfo("feature_type", c_feature_types.data(), c_feature_types.size());
+  }
+
+  *out = new std::shared_ptr<xgboost::DMatrix>{
+      new data::IterativeDMatrix{*p_cuts, info, max_bin}};
+  API_END();
+}
+
 XGB_DLL int XGProxyDMatrixCreate(DMatrixHandle *out) {
   API_BEGIN();
   xgboost_CHECK_C_ARG_PTR(out);
@@ -621,8 +709,11 @@ XGB_DLL int XGDMatrixSaveBinary(DMatrixHandle handle, const char* fname,
   xgboost_CHECK_C_ARG_PTR(fname);
   if (data::SimpleDMatrix* derived = dynamic_cast<data::SimpleDMatrix*>(dmat)) {
     derived->SaveToLocalFile(fname);
+  } else if (auto* qdm = dynamic_cast<data::IterativeDMatrix*>(dmat)) {
+    auto fo = std::make_unique<common::AlignedFileWriteStream>(StringView{fname}, "wb");
+    qdm->Save(fo.get());
   } else {
-    LOG(FATAL) << "binary saving only supported by SimpleDMatrix";
+    LOG(FATAL) << "binary saving only supported by SimpleDMatrix and QuantileDMatrix";
   }
   API_END();
 }
@@ -1445,6 +1536,21 @@ XGB_DLL int XGBoosterPredictFromColumnar(BoosterHandle handle, char const *array
   API_END();
 }
 
+XGB_DLL int XGBoosterRegisterCategories(BoosterHandle handle, char const *data,
+                                        char const * /*config*/) {
+  API_BEGIN();
+  CHECK_HANDLE();
+  xgboost_CHECK_C_ARG_PTR(data);
+  auto *learner = static_cast<Learner *>(handle);
+  data::ColumnarAdapter adapter{data};
+  auto cats = learner->Cats();
+  CHECK(cats->HasCategorical()) << "The booster is not trained with categorical features.";
+  CHECK_EQ(adapter.NumColumns(), cats->NumFeatures())
+      << "Number of columns doesn't match the booster.";
+  [[maybe_unused]] auto mapping = cats->RegisterHostMapping(learner->Ctx(), adapter.Cats());
+  API_END();
+}
+
 XGB_DLL int XGBoosterPredictFromCSR(BoosterHandle handle, char const *indptr, char const *indices,
                                     char const *data, xgboost::bst_ulong cols,
                                     char const *c_json_config, DMatrixHandle m,
@@ -118,7 +118,8 @@ XGB_DLL int XGTrackerCreate(char const *config, TrackerHandle *handle) {
 #else
     LOG(FATAL) << error::NoFederated();
 #endif  // defined(XGBOOST_USE_FEDERATED)
-  } else if (type == "rabit") {
+  } else if (type == "rabit" || type == "shm") {
+    // The shared memory communicator is bootstrapped by the RABIT tracker.
     tptr = std::make_shared<collective::RabitTracker>(jconfig);
   } else {
     LOG(FATAL) << "Unknown communicator:" << type;
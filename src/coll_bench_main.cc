@@ -0,0 +1,540 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ *
+ * @brief Benchmark driver for the CPU collective operations. This file is not included in
+ *        the shared library.
+ *
+ *   The driver starts a local RABIT tracker and launches the workers as processes or
+ *   threads. Workers sweep over the message sizes, data types, and reduce operations, and
+ *   the first worker reports the latency percentiles and bandwidth in JSON. Arguments are
+ *   passed as `name=value` pairs, use `-h` to list them.
+ */
+#if defined(__unix__) || defined(__APPLE__)
+#include <spawn.h>     // for posix_spawnp
+#include <sys/wait.h>  // for waitpid, WIFEXITED, WEXITSTATUS
+#endif                 // defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>  // for max, sort
+#include <chrono>     // for steady_clock, duration, seconds
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int8_t, int32_t, int64_t
+#include <cstring>    // for memcpy
+#include <fstream>    // for ofstream
+#include <iostream>   // for cout, cerr
+#include <memory>     // for unique_ptr, make_unique
+#include <sstream>    // for stringstream
+#include <string>     // for string, to_string
+#include <thread>     // for thread
+#include <utility>    // for pair, move
+#include <vector>     // for vector
+
+#include "collective/coll.h"               // for Coll, AllreduceAlgo, ParseAllreduceAlgo
+#include "collective/comm.h"               // for RabitComm, DefaultNcclName
+#include "collective/in_memory_handler.h"  // for InMemoryHandler
+#include "collective/shm_comm.h"           // for ShmComm
+#include "collective/tracker.h"            // for RabitTracker, GetHostAddress
+#include "common/type.h"                   // for EraseType
+#include "data/array_interface.h"          // for ArrayInterfaceHandler, DispatchDType
+#include "xgboost/collective/result.h"     // for Result, SafeColl
+#include "xgboost/collective/socket.h"     // for SocketStartup
+#include "xgboost/global_config.h"         // for InitNewThread
+#include "xgboost/json.h"                  // for Json
+#include "xgboost/logging.h"               // for CHECK, LOG
+#include "xgboost/parameter.h"             // for XGBoostParameter
+
+#if defined(__unix__) || defined(__APPLE__)
+extern char** environ;  // NOLINT
+#endif                  // defined(__unix__) || defined(__APPLE__)
+
+namespace xgboost::collective {
+namespace {
+struct BenchParam : public XGBoostParameter<BenchParam> {
+  std::int32_t n_workers;
+  std::string comm;
+  std::string launcher;
+  std::string collectives;
+  std::string dtypes;
+  std::string ops;
+  std::string algo;
+  std::size_t min_bytes;
+  std::size_t max_bytes;
+  std::int32_t size_factor;
+  std::int32_t n_warmup;
+  std::int32_t n_iterations;
+  std::int32_t timeout;
+  std::string output;
+  // Set by the driver for worker processes.
+  std::string tracker_uri;
+  std::int32_t tracker_port;
+  std::int32_t task;
+
+  DMLC_DECLARE_PARAMETER(BenchParam) {
+    DMLC_DECLARE_FIELD(n_workers).set_default(4).set_lower_bound(1)
+        .describe("Number of workers.");
+    DMLC_DECLARE_FIELD(comm).set_default("rabit")
+        .describe("Communicator, one of `rabit`, `shm`, and `in_memory`.");
+    DMLC_DECLARE_FIELD(launcher).set_default("process")
+        .describe("Run workers as `process` or `thread`. The in-memory communicator "
+                  "requires threads.");
+    DMLC_DECLARE_FIELD(collectives).set_default("allreduce,allgatherv,broadcast")
+        .describe("Comma-separated list of collectives to run.");
+    DMLC_DECLARE_FIELD(dtypes).set_default("f4,f8")
+        .describe("Comma-separated list of data types for allreduce, in the array "
+                  "interface format without the byte order, like `f4` and `i8`.");
+    DMLC_DECLARE_FIELD(ops).set_default("sum,max")
+        .describe("Comma-separated list of reduce operations for allreduce.");
+    DMLC_DECLARE_FIELD(algo).set_default("auto")
+        .describe("Allreduce algorithm, same as the `dmlc_allreduce_algo` parameter.");
+    DMLC_DECLARE_FIELD(min_bytes).set_default(8).set_lower_bound(1)
+        .describe("Smallest message size in bytes.");
+    DMLC_DECLARE_FIELD(max_bytes).set_default(64ul << 20).set_lower_bound(1)
+        .describe("Largest message size in bytes.");
+    DMLC_DECLARE_FIELD(size_factor).set_default(4).set_lower_bound(2)
+        .describe("Factor between consecutive message sizes.");
+    DMLC_DECLARE_FIELD(n_warmup).set_default(5).set_lower_bound(0)
+        .describe("Number of iterations before measuring.");
+    DMLC_DECLARE_FIELD(n_iterations).set_default(50).set_lower_bound(1)
+        .describe("Number of measured iterations for each configuration.");
+    DMLC_DECLARE_FIELD(timeout).set_default(300).set_lower_bound(1)
+        .describe("Timeout in seconds for the communicator.");
+    DMLC_DECLARE_FIELD(output).set_default("stdout")
+        .describe("Path of the JSON output, `stdout` for printing.");
+    DMLC_DECLARE_FIELD(tracker_uri).set_default("")
+        .describe("Internal, address of the tracker for worker processes.");
+    DMLC_DECLARE_FIELD(tracker_port).set_default(0).set_lower_bound(0)
+        .describe("Internal, port of the tracker for worker processes.");
+    DMLC_DECLARE_FIELD(task).set_default(-1)
+        .describe("Internal, task index of worker processes.");
+  }
+};
+
+DMLC_REGISTER_PARAMETER(BenchParam);
+
+std::vector<std::string> SplitList(std::string const& str) {
+  std::vector<std::string> result;
+  std::stringstream ss{str};
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    if (!item.empty()) {
+      result.push_back(item);
+    }
+  }
+  return result;
+}
+
+ArrayInterfaceHandler::Type ParseDType(std::string const& name) {
+  using T = ArrayInterfaceHandler::Type;
+  std::vector<std::pair<std::string, T>> types{{"f4", T::kF4}, {"f8", T::kF8}, {"i1", T::kI1},
+                                               {"i2", T::kI2}, {"i4", T::kI4}, {"i8", T::kI8},
+                                               {"u1", T::kU1}, {"u2", T::kU2}, {"u4", T::kU4},
+                                               {"u8", T::kU8}};
+  for (auto const& [key, value] : types) {
+    if (key == name) {
+      return value;
+    }
+  }
+  LOG(FATAL) << "Invalid data type: `" << name << "`.";
+  return T::kF4;
+}
+
+Op ParseOp(std::string const& name) {
+  if (name == "sum") {
+    return Op::kSum;
+  } else if (name == "max") {
+    return Op::kMax;
+  } else if (name == "min") {
+    return Op::kMin;
+  }
+  LOG(FATAL) << "Invalid reduce operation: `" << name << "`. Available options are `sum`, "
+             << "`max`, and `min`.";
+  return Op::kSum;
+}
+
+/**
+ * @brief Collectives for a single worker, implemented by a communicator.
+ */
+class Runner {
+ public:
+  virtual ~Runner() noexcept(false) = default;
+  [[nodiscard]] virtual std::int32_t Rank() const = 0;
+  [[nodiscard]] virtual std::int32_t World() const = 0;
+  [[nodiscard]] virtual Result Allreduce(common::Span<std::int8_t> data,
+                                         ArrayInterfaceHandler::Type type, Op op) = 0;
+  // Gather the data from all workers into `recv`, `sizes` has the size for each worker.
+  [[nodiscard]] virtual Result AllgatherV(common::Span<std::int8_t const> data,
+                                          std::vector<std::int64_t> const& sizes,
+                                          common::Span<std::int8_t> recv) = 0;
+  [[nodiscard]] virtual Result Broadcast(common::Span<std::int8_t> data, std::int32_t root) = 0;
+};
+
+class CommRunner : public Runner {
+  std::unique_ptr<HostComm> comm_;
+  Coll coll_;
+  std::vector<std::int64_t> recv_segments_;
+
+ public:
+  CommRunner(std::unique_ptr<HostComm> comm, AllreduceAlgo algo)
+      : comm_{std::move(comm)}, coll_{algo} {}
+  ~CommRunner() noexcept(false) override { SafeColl(comm_->Shutdown()); }
+
+  [[nodiscard]] std::int32_t Rank() const override { return comm_->Rank(); }
+  [[nodiscard]] std::int32_t World() const override { return comm_->World(); }
+  [[nodiscard]] Result Allreduce(common::Span<std::int8_t> data,
+                                 ArrayInterfaceHandler::Type type, Op op) override {
+    return coll_.Allreduce(*comm_, data, type, op);
+  }
+  [[nodiscard]] Result AllgatherV(common::Span<std::int8_t const> data,
+                                  std::vector<std::int64_t> const& sizes,
+                                  common::Span<std::int8_t> recv) override {
+    recv_segments_.resize(sizes.size() + 1);
+    return coll_.AllgatherV(*comm_, data, common::Span{sizes.data(), sizes.size()},
+                            common::Span{recv_segments_.data(), recv_segments_.size()}, recv,
+                            AllgatherVAlgo::kRing);
+  }
+  [[nodiscard]] Result Broadcast(common::Span<std::int8_t> data, std::int32_t root) override {
+    return coll_.Broadcast(*comm_, data, root);
+  }
+};
+
+class InMemoryRunner : public Runner {
+  InMemoryHandler* handler_;
+  std::int32_t world_;
+  std::int32_t rank_;
+  std::size_t seq_{0};
+  std::string out_;
+
+ public:
+  InMemoryRunner(InMemoryHandler* handler, std::int32_t world, std::int32_t rank)
+      : handler_{handler}, world_{world}, rank_{rank} {}
+  ~InMemoryRunner() noexcept(false) override { handler_->Shutdown(seq_++, rank_); }
+
+  [[nodiscard]] std::int32_t Rank() const override { return rank_; }
+  [[nodiscard]] std::int32_t World() const override { return world_; }
+  [[nodiscard]] Result Allreduce(common::Span<std::int8_t> data,
+                                 ArrayInterfaceHandler::Type type, Op op) override {
+    handler_->Allreduce(reinterpret_cast<char const*>(data.data()), data.size_bytes(), &out_,
+                        seq_++, rank_, type, op);
+    std::memcpy(data.data(), out_.data(), data.size_bytes());
+    return Success();
+  }
+  [[nodiscard]] Result AllgatherV(common::Span<std::int8_t const> data,
+                                  std::vector<std::int64_t> const&,
+                                  common::Span<std::int8_t> recv) override {
+    handler_->AllgatherV(reinterpret_cast<char const*>(data.data()), data.size_bytes(), &out_,
+                         seq_++, rank_);
+    std::memcpy(recv.data(), out_.data(), recv.size_bytes());
+    return Success();
+  }
+  [[nodiscard]] Result Broadcast(common::Span<std::int8_t> data, std::int32_t root) override {
+    handler_->Broadcast(reinterpret_cast<char const*>(data.data()), data.size_bytes(), &out_,
+                        seq_++, rank_, root);
+    std::memcpy(data.data(), out_.data(), data.size_bytes());
+    return Success();
+  }
+};
+
+/**
+ * @brief Run the benchmark on a worker, returns the result on the first worker.
+ */
+class Benchmark {
+  BenchParam const& param_;
+  Runner* runner_;
+  Json results_{Array{}};
+
+  // Measure the latency of each iteration, taking the slowest worker.
+  template <typename Fn>
+  [[nodiscard]] std::vector<double> Measure(Fn&& fn) {
+    std::int8_t token{0};
+    auto barrier = [&] {
+      SafeColl(runner_->Allreduce(common::Span<std::int8_t>{&token, 1}, ArrayInterfaceHandler::kI1,
+                                  Op::kMax));
+    };
+    for (std::int32_t i = 0; i < param_.n_warmup; ++i) {
+      barrier();
+      SafeColl(fn());
+    }
+    std::vector<double> latency(param_.n_iterations);
+    for (auto& v : latency) {
+      barrier();
+      auto start = std::chrono::steady_clock::now();
+      SafeColl(fn());
+      v = std::chrono::duration<double>{std::chrono::steady_clock::now() - start}.count();
+    }
+    SafeColl(runner_->Allreduce(common::EraseType(common::Span{latency.data(), latency.size()}),
+                                ArrayInterfaceHandler::kF8, Op::kMax));
+    return latency;
+  }
+
+  // The bus factor converts the message size into the amount of data each worker sends,
+  // for comparing with the link bandwidth.
+  void Report(Json record, std::size_t n_bytes, double bus_factor, std::vector<double> latency) {
+    if (runner_->Rank() != 0) {
+      return;
+    }
+    std::sort(latency.begin(), latency.end());
+    auto percentile = [&](double q) {
+      auto idx = static_cast<std::size_t>(q * static_cast<double>(latency.size() - 1) + 0.5);
+      return latency[idx];
+    };
+    auto p50 = percentile(0.5);
+    auto p99 = percentile(0.99);
+    auto alg_bw = static_cast<double>(n_bytes) / p50 / 1e9;
+    record["bytes"] = static_cast<Integer::Int>(n_bytes);
+    record["p50_us"] = p50 * 1e6;
+    record["p99_us"] = p99 * 1e6;
+    record["algbw_gbps"] = alg_bw;
+    record["busbw_gbps"] = alg_bw * bus_factor;
+    get<Array>(results_).emplace_back(std::move(record));
+  }
+
+  [[nodiscard]] std::vector<std::size_t> Sizes() const {
+    std::vector<std::size_t> sizes;
+    for (auto n = param_.min_bytes; n <= param_.max_bytes; n *= param_.size_factor) {
+      sizes.push_back(n);
+    }
+    return sizes;
+  }
+
+  void RunAllreduce() {
+    auto world = static_cast<double>(runner_->World());
+    for (auto const& dtype : SplitList(param_.dtypes)) {
+      auto type = ParseDType(dtype);
+      auto n_bytes_elem = DispatchDType(type, [](auto t) { return sizeof(t); });
+      for (auto const& name : SplitList(param_.ops)) {
+        auto op = ParseOp(name);
+        for (auto n : this->Sizes()) {
+          auto n_bytes = std::max(n / n_bytes_elem, std::size_t{1}) * n_bytes_elem;
+          std::vector<std::int8_t> data(n_bytes, 0);
+          auto latency = this->Measure([&] {
+            return runner_->Allreduce(common::Span{data.data(), data.size()}, type, op);
+          });
+          Json record{Object{}};
+          record["collective"] = String{"allreduce"};
+          record["dtype"] = String{dtype};
+          record["op"] = String{name};
+          this->Report(std::move(record), n_bytes, 2.0 * (world - 1.0) / world, latency);
+        }
+      }
+    }
+  }
+
+  void RunAllgatherV() {
+    auto world = runner_->World();
+    // Workers contribute different sizes, proportional to their rank plus one.
+    auto total = static_cast<std::size_t>(world) * (world + 1) / 2;
+    for (auto n : this->Sizes()) {
+      std::vector<std::int64_t> sizes(world);
+      for (std::int32_t r = 0; r < world; ++r) {
+        sizes[r] = static_cast<std::int64_t>(std::max(n * (r + 1) / total, std::size_t{1}));
+      }
+      std::size_t n_bytes = 0;
+      for (auto v : sizes) {
+        n_bytes += v;
+      }
+      std::vector<std::int8_t> data(sizes[runner_->Rank()], 0);
+      std::vector<std::int8_t> recv(n_bytes, 0);
+      auto latency = this->Measure([&] {
+        return runner_->AllgatherV(common::Span{data.data(), data.size()}, sizes,
+                                   common::Span{recv.data(), recv.size()});
+      });
+      Json record{Object{}};
+      record["collective"] = String{"allgatherv"};
+      auto w = static_cast<double>(world);
+      this->Report(std::move(record), n_bytes, (w - 1.0) / w, latency);
+    }
+  }
+
+  void RunBroadcast() {
+    for (auto n : this->Sizes()) {
+      std::vector<std::int8_t> data(n, 0);
+      auto latency = this->Measure(
+          [&] { return runner_->Broadcast(common::Span{data.data(), data.size()}, 0); });
+      Json record{Object{}};
+      record["collective"] = String{"broadcast"};
+      this->Report(std::move(record), n, 1.0, latency);
+    }
+  }
+
+ public:
+  Benchmark(BenchParam const& param, Runner* runner) : param_{param}, runner_{runner} {}
+
+  [[nodiscard]] Json Run() {
+    for (auto const& name : SplitList(param_.collectives)) {
+      if (name == "allreduce") {
+        this->RunAllreduce();
+      } else if (name == "allgatherv") {
+        this->RunAllgatherV();
+      } else if (name == "broadcast") {
+        this->RunBroadcast();
+      } else {
+        LOG(FATAL) << "Invalid collective: `" << name << "`. Available options are "
+                   << "`allreduce`, `allgatherv`, and `broadcast`.";
+      }
+    }
+    Json out{Object{}};
+    out["comm"] = String{param_.comm};
+    out["launcher"] = String{param_.launcher};
+    out["n_workers"] = Integer{runner_->World()};
+    out["algo"] = String{param_.algo};
+    out["n_iterations"] = Integer{param_.n_iterations};
+    out["results"] = std::move(results_);
+    return out;
+  }
+};
+
+void WriteOutput(BenchParam const& param, Json const& out) {
+  std::string str;
+  Json::Dump(out, &str);
+  if (param.output == "stdout") {
+    std::cout << str << std::endl;
+  } else {
+    std::ofstream fout{param.output};
+    CHECK(fout) << "Failed to open `" << param.output << "`.";
+    fout << str << std::endl;
+  }
+}
+
+void RunWorker(BenchParam const& param, std::string const& host, std::int32_t port,
+               std::int32_t task) {
+  auto timeout = std::chrono::seconds{param.timeout};
+  auto task_id = "bench-" + std::to_string(task);
+  std::unique_ptr<HostComm> comm;
+  if (param.comm == "rabit") {
+    comm = std::make_unique<RabitComm>(host, port, timeout, DefaultRetry(), task_id,
+                                       DefaultNcclName());
+  } else if (param.comm == "shm") {
+    comm = std::make_unique<ShmComm>(host, port, timeout, DefaultRetry(), task_id,
+                                     DefaultNcclName());
+  } else {
+    LOG(FATAL) << "Invalid communicator: `" << param.comm << "`.";
+  }
+  CommRunner runner{std::move(comm), ParseAllreduceAlgo(param.algo)};
+  auto out = Benchmark{param, &runner}.Run();
+  if (runner.Rank() == 0) {
+    WriteOutput(param, out);
+  }
+}
+
+void RunInMemory(BenchParam const& param) {
+  CHECK_EQ(param.launcher, "thread") << "The in-memory communicator requires `launcher=thread`.";
+  InMemoryHandler handler{param.n_workers};
+  std::vector<std::thread> workers;
+  for (std::int32_t r = 0; r < param.n_workers; ++r) {
+    workers.emplace_back([&, r, init = InitNewThread{}] {
+      init();
+      InMemoryRunner runner{&handler, param.n_workers, r};
+      auto out = Benchmark{param, &runner}.Run();
+      if (r == 0) {
+        WriteOutput(param, out);
+      }
+    });
+  }
+  for (auto& t : workers) {
+    t.join();
+  }
+}
+
+void LaunchProcesses(BenchParam const& param, std::vector<std::string> const& args,
+                     std::string const& host, std::int32_t port) {
+#if defined(__unix__) || defined(__APPLE__)
+  std::vector<pid_t> pids;
+  for (std::int32_t i = 0; i < param.n_workers; ++i) {
+    auto w_args = args;
+    w_args.push_back("tracker_uri=" + host);
+    w_args.push_back("tracker_port=" + std::to_string(port));
+    w_args.push_back("task=" + std::to_string(i));
+    std::vector<char*> argv;
+    for (auto& arg : w_args) {
+      argv.push_back(arg.data());
+    }
+    argv.push_back(nullptr);
+    pid_t pid;
+    auto rc = posix_spawnp(&pid, argv.front(), nullptr, nullptr, argv.data(), environ);
+    CHECK_EQ(rc, 0) << "Failed to launch the worker process: " << rc;
+    pids.push_back(pid);
+  }
+  for (auto pid : pids) {
+    std::int32_t status{0};
+    CHECK_EQ(waitpid(pid, &status, 0), pid);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0) << "Worker process failed.";
+  }
+#else
+  LOG(FATAL) << "Worker processes are not supported on this platform, use `launcher=thread`.";
+#endif  // defined(__unix__) || defined(__APPLE__)
+}
+
+void RunDriver(BenchParam const& param, std::vector<std::string> const& args) {
+  std::string host;
+  SafeColl(GetHostAddress(&host));
+  Json config{Object{}};
+  config["host"] = host;
+  config["port"] = Integer{0};
+  config["n_workers"] = Integer{param.n_workers};
+  config["sortby"] = Integer{static_cast<std::int32_t>(Tracker::SortBy::kTask)};
+  config["timeout"] = Integer{param.timeout};
+  RabitTracker tracker{config};
+  auto fut = tracker.Run();
+  SafeColl(tracker.WaitUntilReady());
+  auto port = tracker.Port();
+
+  if (param.launcher == "process") {
+    LaunchProcesses(param, args, host, port);
+  } else if (param.launcher == "thread") {
+    std::vector<std::thread> workers;
+    for (std::int32_t i = 0; i < param.n_workers; ++i) {
+      workers.emplace_back([&, i, init = InitNewThread{}] {
+        init();
+        RunWorker(param, host, port, i);
+      });
+    }
+    for (auto& t : workers) {
+      t.join();
+    }
+  } else {
+    LOG(FATAL) << "Invalid launcher: `" << param.launcher << "`.";
+  }
+  SafeColl(fut.get());
+}
+
+std::int32_t BenchMain(std::int32_t argc, char* argv[]) {
+  std::vector<std::string> args{argv[0]};
+  Args kwargs;
+  for (std::int32_t i = 1; i < argc; ++i) {
+    std::string arg{argv[i]};
+    if (arg == "-h" || arg == "--help") {
+      std::cout << "Usage: " << argv[0] << " [name=value]...\n\n"
+                << BenchParam::__DOC__() << std::endl;
+      return 0;
+    }
+    auto pos = arg.find('=');
+    CHECK_NE(pos, std::string::npos) << "Invalid argument: `" << arg << "`, expecting name=value.";
+    kwargs.emplace_back(arg.substr(0, pos), arg.substr(pos + 1));
+    args.push_back(arg);
+  }
+  BenchParam param;
+  auto unknown = param.UpdateAllowUnknown(kwargs);
+  CHECK(unknown.empty()) << "Unknown argument: `" << unknown.front().first << "`.";
+  CHECK_LE(param.min_bytes, param.max_bytes);
+
+  system::SocketStartup();
+  if (param.comm == "in_memory") {
+    RunInMemory(param);
+  } else if (param.tracker_port != 0) {
+    RunWorker(param, param.tracker_uri, param.tracker_port, param.task);
+  } else {
+    RunDriver(param, args);
+  }
+  system::SocketFinalize();
+  return 0;
+}
+}  // namespace
+}  // namespace xgboost::collective
+
+int main(int argc, char* argv[]) {
+  try {
+    return xgboost::collective::BenchMain(argc, argv);
+  } catch (dmlc::Error const& e) {
+    std::cerr << "Error running the collective benchmark:\n\n" << e.what() << std::endl;
+    return 1;
+  }
+}
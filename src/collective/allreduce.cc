@@ -3,14 +3,17 @@
  */
 #include "allreduce.h"
 
-#include <algorithm>  // for min
+#include <algorithm>  // for min, max
 #include <cstddef>    // for size_t
 #include <cstdint>    // for int32_t, int8_t
-#include <utility>    // for move
+#include <string>     // for to_string
+#include <utility>    // for move, pair
 #include <vector>     // for vector
 
+#include "../common/common.h"           // for DivRoundUp
 #include "../data/array_interface.h"    // for Type, DispatchDType
 #include "allgather.h"                  // for RingAllgather
+#include "coll.h"                       // for AllreduceAlgo
 #include "comm.h"                       // for Comm
 #include "xgboost/collective/result.h"  // for Result
 #include "xgboost/span.h"               // for Span
@@ -50,6 +53,178 @@ Result RingAllreduceSmall(Comm const& comm, common::Span<std::int8_t> data, Func
 
   return Success();
 }
+
+/**
+ * @brief Send a buffer to the peer and receive another one from it. Empty buffers are
+ *        skipped, both sides must agree on the sizes.
+ */
+[[nodiscard]] Result Exchange(Comm const& comm, std::int32_t peer,
+                              common::Span<std::int8_t const> send,
+                              common::Span<std::int8_t> recv) {
+  auto ch = comm.Chan(peer);
+  return Success() << [&] {
+    if (send.empty()) {
+      return Success();
+    }
+    return ch->SendAll(send.data(), send.size_bytes());
+  } << [&] {
+    if (recv.empty()) {
+      return Success();
+    }
+    return ch->RecvAll(recv);
+  } << [&] {
+    return comm.Block();
+  };
+}
+
+/**
+ * @brief Helper for folding a non-power-of-two world into a power-of-two one.
+ *
+ *   For the first `2 * rem` workers, even ranks send their data to the next odd rank and
+ *   sit out the exchange. The remaining workers are renumbered into [0, pof2).
+ */
+struct PowerOfTwoGroup {
+  std::int32_t pof2;
+  std::int32_t rem;
+  std::int32_t new_rank;  // -1 if the worker doesn't participate in the exchange.
+
+  PowerOfTwoGroup(std::int32_t rank, std::int32_t world) {
+    pof2 = 1;
+    while (pof2 * 2 <= world) {
+      pof2 *= 2;
+    }
+    rem = world - pof2;
+    if (rank < 2 * rem) {
+      new_rank = (rank % 2 == 0) ? -1 : rank / 2;
+    } else {
+      new_rank = rank - rem;
+    }
+  }
+  // Translate the rank in the power-of-two group back to the original rank.
+  [[nodiscard]] std::int32_t Rank(std::int32_t new_rank) const {
+    return new_rank < rem ? new_rank * 2 + 1 : new_rank + rem;
+  }
+};
+
+template <typename Fn>
+[[nodiscard]] Result FoldedAllreduce(Comm const& comm, common::Span<std::int8_t> data,
+                                     Func const& op, Fn&& pof2_fn) {
+  auto rank = comm.Rank();
+  PowerOfTwoGroup group{rank, comm.World()};
+  std::vector<std::int8_t> buffer;
+  // Fold the extra workers.
+  if (rank < 2 * group.rem) {
+    if (group.new_rank == -1) {
+      auto rc = Exchange(comm, rank + 1, data, {});
+      if (!rc.OK()) {
+        return Fail("Failed to fold the data into the next worker.", std::move(rc));
+      }
+    } else {
+      buffer.resize(data.size_bytes());
+      auto s_buf = common::Span{buffer.data(), buffer.size()};
+      auto rc = Exchange(comm, rank - 1, {}, s_buf);
+      if (!rc.OK()) {
+        return Fail("Failed to fold the data from the previous worker.", std::move(rc));
+      }
+      op(s_buf, data);
+    }
+  }
+
+  if (group.new_rank != -1) {
+    auto rc = pof2_fn(group);
+    if (!rc.OK()) {
+      return rc;
+    }
+  }
+
+  // Send the result back to the folded workers.
+  if (rank < 2 * group.rem) {
+    auto rc = (group.new_rank == -1) ? Exchange(comm, rank + 1, {}, data)
+                                     : Exchange(comm, rank - 1, data, {});
+    if (!rc.OK()) {
+      return Fail("Failed to send the result back to the folded worker.", std::move(rc));
+    }
+  }
+  return Success();
+}
+
+Result RecursiveDoublingImpl(Comm const& comm, common::Span<std::int8_t> data, Func const& op) {
+  std::vector<std::int8_t> buffer(data.size_bytes());
+  auto s_buf = common::Span{buffer.data(), buffer.size()};
+  return FoldedAllreduce(comm, data, op, [&](PowerOfTwoGroup const& group) {
+    for (std::int32_t mask = 1; mask < group.pof2; mask <<= 1) {
+      auto peer = group.Rank(group.new_rank ^ mask);
+      auto rc = Exchange(comm, peer, data, s_buf);
+      if (!rc.OK()) {
+        return Fail("Recursive doubling failed, current mask:" + std::to_string(mask),
+                    std::move(rc));
+      }
+      // Both sides compute `recv op local`, which are identical for commutative ops.
+      op(s_buf, data);
+    }
+    return Success();
+  });
+}
+
+template <typename T>
+Result RabenseifnerTyped(Comm const& comm, common::Span<std::int8_t> data, Func const& op) {
+  auto n = data.size_bytes() / sizeof(T);
+  std::vector<std::int8_t> buffer(common::DivRoundUp(n, 2) * sizeof(T));
+  auto bytes = [](std::size_t beg, std::size_t end) {
+    return std::make_pair(beg * sizeof(T), (end - beg) * sizeof(T));
+  };
+
+  return FoldedAllreduce(comm, data, op, [&](PowerOfTwoGroup const& group) {
+    // Range of elements owned by the current worker after each halving step.
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    std::size_t beg = 0, end = n;
+    // Reduce-scatter with recursive halving.
+    for (std::int32_t mask = group.pof2 / 2; mask > 0; mask >>= 1) {
+      auto peer = group.Rank(group.new_rank ^ mask);
+      auto mid = beg + (end - beg) / 2;
+      bool keep_low = (group.new_rank & mask) == 0;
+      auto [keep_off, keep_size] = keep_low ? bytes(beg, mid) : bytes(mid, end);
+      auto [send_off, send_size] = keep_low ? bytes(mid, end) : bytes(beg, mid);
+
+      auto keep = data.subspan(keep_off, keep_size);
+      auto recv = common::Span{buffer.data(), keep_size};
+      auto rc = Exchange(comm, peer, data.subspan(send_off, send_size), recv);
+      if (!rc.OK()) {
+        return Fail("Recursive halving failed, current mask:" + std::to_string(mask),
+                    std::move(rc));
+      }
+      op(recv, keep);
+
+      ranges.emplace_back(beg, end);
+      if (keep_low) {
+        end = mid;
+      } else {
+        beg = mid;
+      }
+    }
+    // Allgather with recursive doubling, walking the ranges backward.
+    for (std::int32_t mask = 1; mask < group.pof2; mask <<= 1) {
+      auto peer = group.Rank(group.new_rank ^ mask);
+      auto [pbeg, pend] = ranges.back();
+      ranges.pop_back();
+      auto mid = pbeg + (pend - pbeg) / 2;
+      bool keep_low = (group.new_rank & mask) == 0;
+      auto [send_off, send_size] = bytes(beg, end);
+      auto [recv_off, recv_size] = keep_low ? bytes(mid, pend) : bytes(pbeg, mid);
+
+      auto rc = Exchange(comm, peer, data.subspan(send_off, send_size),
+                         data.subspan(recv_off, recv_size));
+      if (!rc.OK()) {
+        return Fail("Recursive doubling allgather failed, current mask:" + std::to_string(mask),
+                    std::move(rc));
+      }
+      beg = pbeg;
+      end = pend;
+    }
+    CHECK(ranges.empty());
+    return Success();
+  });
+}
 }  // namespace
 
 template <typename T>
@@ -110,6 +285,51 @@ Result RingScatterReduceTyped(Comm const& comm, common::Span<std::int8_t> data,
   return Success();
 }
 
+Result RingReduceScatter(Comm const& comm, common::Span<std::int8_t> data,
+                         common::Span<std::size_t const> seg_ptrs, Func const& op) {
+  auto rank = comm.Rank();
+  auto world = comm.World();
+  CHECK_EQ(seg_ptrs.size(), static_cast<std::size_t>(world) + 1);
+  CHECK_EQ(seg_ptrs.back(), data.size_bytes());
+  if (world == 1) {
+    return Success();
+  }
+
+  auto next_ch = comm.Chan(BootstrapNext(rank, world));
+  auto prev_ch = comm.Chan(BootstrapPrev(rank, world));
+  auto segment = [&](std::int32_t r) {
+    return data.subspan(seg_ptrs[r], seg_ptrs[r + 1] - seg_ptrs[r]);
+  };
+
+  std::size_t max_seg_bytes = 0;
+  for (std::int32_t r = 0; r < world; ++r) {
+    max_seg_bytes = std::max(max_seg_bytes, segment(r).size());
+  }
+  std::vector<std::int8_t> buffer(max_seg_bytes, -1);
+  auto s_buf = common::Span{buffer.data(), buffer.size()};
+
+  // Shifted by one from the scatter reduce in the ring allreduce, the segment received in
+  // the last round is the one owned by the current worker.
+  for (std::int32_t r = 0; r < world - 1; ++r) {
+    auto send_seg = segment((rank + 2 * world - r - 1) % world);
+    auto recv_seg = segment((rank + 2 * world - r - 2) % world);
+    auto seg = s_buf.subspan(0, recv_seg.size());
+    auto rc = Success() << [&] {
+      return next_ch->SendAll(send_seg);
+    } << [&] {
+      return prev_ch->RecvAll(seg);
+    } << [&] {
+      return comm.Block();
+    };
+    if (!rc.OK()) {
+      return Fail("Ring reduce scatter failed, current iteration:" + std::to_string(r),
+                  std::move(rc));
+    }
+    op(seg, recv_seg);
+  }
+  return Success();
+}
+
 Result RingAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
                      ArrayInterfaceHandler::Type type) {
   if (comm.World() == 1) {
@@ -147,4 +367,65 @@ Result RingAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func cons
     };
   });
 }
+
+Result RecursiveDoublingAllreduce(Comm const& comm, common::Span<std::int8_t> data,
+                                  Func const& op, ArrayInterfaceHandler::Type type) {
+  if (comm.World() == 1 || data.size_bytes() == 0) {
+    return Success();
+  }
+  return DispatchDType(type, [&](auto t) {
+    using T = decltype(t);
+    CHECK_EQ(data.size_bytes() % sizeof(T), 0);
+    return RecursiveDoublingImpl(comm, data, op);
+  });
+}
+
+Result RabenseifnerAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
+                             ArrayInterfaceHandler::Type type) {
+  if (comm.World() == 1 || data.size_bytes() == 0) {
+    return Success();
+  }
+  return DispatchDType(type, [&](auto t) {
+    using T = decltype(t);
+    CHECK_EQ(data.size_bytes() % sizeof(T), 0);
+    return RabenseifnerTyped<T>(comm, data, op);
+  });
+}
+
+[[nodiscard]] AllreduceAlgo SelectAllreduceAlgo(std::size_t n_bytes, std::size_t n_elems,
+                                                std::int32_t world) {
+  // Thresholds are similar to the ones used by MPICH.
+  constexpr std::size_t kSmallBytes = 2048;
+  constexpr std::size_t kLargeBytes = 1024 * 1024;
+  if (world <= 2) {
+    // All algorithms send the same amount of data in the same number of rounds.
+    return AllreduceAlgo::kRing;
+  }
+  if (n_bytes <= kSmallBytes || n_elems < static_cast<std::size_t>(world)) {
+    return AllreduceAlgo::kRecursiveDoubling;
+  }
+  if (n_bytes <= kLargeBytes) {
+    return AllreduceAlgo::kRabenseifner;
+  }
+  // The ring pipelines better for large messages.
+  return AllreduceAlgo::kRing;
+}
+
+Result Allreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
+                 ArrayInterfaceHandler::Type type, AllreduceAlgo algo) {
+  if (algo == AllreduceAlgo::kAuto) {
+    auto n_elems = DispatchDType(type, [&](auto t) { return data.size_bytes() / sizeof(t); });
+    algo = SelectAllreduceAlgo(data.size_bytes(), n_elems, comm.World());
+  }
+  switch (algo) {
+    case AllreduceAlgo::kRing:
+      return RingAllreduce(comm, data, op, type);
+    case AllreduceAlgo::kRecursiveDoubling:
+      return RecursiveDoublingAllreduce(comm, data, op, type);
+    case AllreduceAlgo::kRabenseifner:
+      return RabenseifnerAllreduce(comm, data, op, type);
+    default:
+      return Fail("Unknown algorithm for allreduce.");
+  }
+}
 }  // namespace xgboost::collective::cpu_impl
@@ -2,13 +2,16 @@
  * Copyright 2023-2024, XGBoost Contributors
  */
 #pragma once
-#include <cstdint>      // for int8_t
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int8_t, int32_t
 #include <functional>   // for function
+#include <future>       // for future, promise
 #include <type_traits>  // for is_invocable_v, enable_if_t
 #include <vector>       // for vector
 
 #include "../common/type.h"             // for EraseType, RestoreType
 #include "../data/array_interface.h"    // for ToDType, ArrayInterfaceHandler
+#include "coll.h"                       // for AllreduceAlgo
 #include "comm.h"                       // for Comm, RestoreType
 #include "comm_group.h"                 // for GlobalCommGroup
 #include "xgboost/collective/result.h"  // for Result
@@ -22,6 +25,50 @@ using Func =
 
 Result RingAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
                      ArrayInterfaceHandler::Type type);
+
+/**
+ * @brief Reduce-scatter with a ring. The buffer is split into segments by `seg_ptrs`, a
+ *        list of byte offsets with size `world + 1`. Upon return, the segment of the
+ *        current rank contains the reduced result, other segments are left in an
+ *        unspecified state.
+ *
+ *   Segments can have different sizes and might be empty. Each worker sends and receives
+ *   `(p - 1)` segments, about half of the traffic of the ring allreduce.
+ */
+Result RingReduceScatter(Comm const& comm, common::Span<std::int8_t> data,
+                         common::Span<std::size_t const> seg_ptrs, Func const& op);
+
+/**
+ * @brief Allreduce by exchanging the full buffer with a partner in each of the log(p)
+ *        rounds. Latency optimal, suitable for small messages.
+ *
+ *   Extra workers in a non-power-of-two world are folded into their neighbours before
+ *   the exchange and receive the result afterward.
+ */
+Result RecursiveDoublingAllreduce(Comm const& comm, common::Span<std::int8_t> data,
+                                  Func const& op, ArrayInterfaceHandler::Type type);
+
+/**
+ * @brief Rabenseifner's allreduce, reduce-scatter by recursive halving followed by
+ *        allgather with recursive doubling. Takes 2log(p) rounds with the same data
+ *        volume as the ring allreduce.
+ *
+ *   The op must be element-wise as the buffer is split at arbitrary element boundaries.
+ */
+Result RabenseifnerAllreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
+                             ArrayInterfaceHandler::Type type);
+
+/**
+ * @brief Choose an allreduce algorithm based on the message size and the world size.
+ */
+[[nodiscard]] AllreduceAlgo SelectAllreduceAlgo(std::size_t n_bytes, std::size_t n_elems,
+                                                std::int32_t world);
+
+/**
+ * @brief Allreduce with an element-wise op using the specified algorithm.
+ */
+Result Allreduce(Comm const& comm, common::Span<std::int8_t> data, Func const& op,
+                 ArrayInterfaceHandler::Type type, AllreduceAlgo algo);
 }  // namespace cpu_impl
 
 template <typename T, typename Fn>
@@ -59,6 +106,29 @@ template <typename T, std::int32_t kDim>
   return Allreduce(ctx, *GlobalCommGroup(), data, op);
 }
 
+/**
+ * @brief Start an allreduce in the background.
+ *
+ *   See @ref CommGroup::Async for the restrictions. The data must be kept alive until the
+ *   returned future is ready.
+ */
+template <typename T, std::int32_t kDim>
+[[nodiscard]] std::future<Result> AllreduceAsync(Context const* ctx, CommGroup const& comm,
+                                                 linalg::TensorView<T, kDim> data, Op op) {
+  if (!comm.IsDistributed()) {
+    std::promise<Result> p;
+    p.set_value(Success());
+    return p.get_future();
+  }
+  return comm.Async([=, &comm] { return Allreduce(ctx, comm, data, op); });
+}
+
+template <typename T, std::int32_t kDim>
+[[nodiscard]] std::future<Result> AllreduceAsync(Context const* ctx,
+                                                 linalg::TensorView<T, kDim> data, Op op) {
+  return AllreduceAsync(ctx, *GlobalCommGroup(), data, op);
+}
+
 /**
  * @brief Specialization for std::vector.
  */
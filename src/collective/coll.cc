@@ -7,6 +7,7 @@
 #include <cstddef>      // for size_t
 #include <cstdint>      // for int8_t, int64_t
 #include <functional>   // for bit_and, bit_or, bit_xor, plus
+#include <memory>       // for make_shared
 #include <string>       // for string
 #include <type_traits>  // for is_floating_point_v, is_same_v
 #include <utility>      // for move
@@ -16,6 +17,7 @@
 #include "allreduce.h"                // for Allreduce
 #include "broadcast.h"                // for Broadcast
 #include "comm.h"                     // for Comm
+#include "hierarchical.h"             // for HierarchicalAllreduce
 
 #if defined(XGBOOST_USE_CUDA)
 #include "cuda_fp16.h"  // for __half
@@ -31,10 +33,39 @@ bool constexpr IsFloatingPointV() {
 #endif  // defined(XGBOOST_USE_CUDA)
 }
 
+[[nodiscard]] AllreduceAlgo ParseAllreduceAlgo(std::string const& name) {
+  if (name == "auto") {
+    return AllreduceAlgo::kAuto;
+  } else if (name == "ring") {
+    return AllreduceAlgo::kRing;
+  } else if (name == "recursive_doubling") {
+    return AllreduceAlgo::kRecursiveDoubling;
+  } else if (name == "rabenseifner") {
+    return AllreduceAlgo::kRabenseifner;
+  }
+  LOG(FATAL) << "Invalid allreduce algorithm: `" << name << "`. Expecting one of `auto`, "
+             << "`ring`, `recursive_doubling`, `rabenseifner`.";
+  return AllreduceAlgo::kAuto;
+}
+
 [[nodiscard]] Result Coll::Allreduce(Comm const& comm, common::Span<std::int8_t> data,
                                      ArrayInterfaceHandler::Type type, Op op) {
   namespace coll = ::xgboost::collective;
 
+  if (this->hierarchical_ && comm.World() > 1 && (!hier_ || hier_->Parent() != &comm)) {
+    std::string host;
+    auto rc = Success() << [&] {
+      return comm.ProcessorName(&host);
+    } << [&] {
+      hier_ = std::make_shared<cpu_impl::HierarchicalAllreduce>();
+      return hier_->Init(comm, host);
+    };
+    if (!rc.OK()) {
+      return Fail("Failed to initialize the hierarchical allreduce.", std::move(rc));
+    }
+  }
+  auto use_hier = this->hierarchical_ && hier_ && hier_->Parent() == &comm && hier_->Enabled();
+
   auto redop_fn = [](auto lhs, auto out, auto elem_op) {
     auto p_lhs = lhs.data();
     auto p_out = out.data();
@@ -58,7 +89,10 @@ bool constexpr IsFloatingPointV() {
       redop_fn(lhs_t, rhs_t, elem_op);
     };
 
-    return cpu_impl::RingAllreduce(comm, data, erased_fn, type);
+    if (use_hier) {
+      return hier_->Allreduce(data, erased_fn, type, this->allreduce_algo_);
+    }
+    return cpu_impl::Allreduce(comm, data, erased_fn, type, this->allreduce_algo_);
   };
 
   std::string msg{"Floating point is not supported for bit wise collective operations."};
@@ -3,7 +3,8 @@
  */
 #pragma once
 #include <cstdint>  // for int8_t, int64_t
-#include <memory>   // for enable_shared_from_this
+#include <memory>   // for enable_shared_from_this, shared_ptr
+#include <string>   // for string
 
 #include "../data/array_interface.h"    // for ArrayInterfaceHandler
 #include "comm.h"                       // for Comm
@@ -16,12 +17,36 @@ enum class AllgatherVAlgo {
   kBcast = 1,  // use broadcast-based allgather-v
 };
 
+enum class AllreduceAlgo : std::int32_t {
+  kAuto = 0,               // select based on the message size and the world size
+  kRing = 1,               // use ring-based scatter-reduce followed by allgather
+  kRecursiveDoubling = 2,  // use recursive doubling, for small messages
+  kRabenseifner = 3,       // use recursive halving followed by recursive doubling
+};
+
+/**
+ * @brief Parse the `dmlc_allreduce_algo` parameter, one of `auto`, `ring`,
+ *        `recursive_doubling` and `rabenseifner`.
+ */
+[[nodiscard]] AllreduceAlgo ParseAllreduceAlgo(std::string const& name);
+
+namespace cpu_impl {
+class HierarchicalAllreduce;
+}  // namespace cpu_impl
+
 /**
  * @brief Interface and base implementation for collective.
  */
 class Coll : public std::enable_shared_from_this<Coll> {
+  AllreduceAlgo allreduce_algo_{AllreduceAlgo::kAuto};
+  // Reduce through shared memory for workers on the same host.
+  bool hierarchical_{false};
+  std::shared_ptr<cpu_impl::HierarchicalAllreduce> hier_;
+
  public:
   Coll() = default;
+  explicit Coll(AllreduceAlgo algo, bool hierarchical = false)
+      : allreduce_algo_{algo}, hierarchical_{hierarchical} {}
   virtual ~Coll() noexcept(false) {}  // NOLINT
 
   virtual Coll* MakeCUDAVar();
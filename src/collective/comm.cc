@@ -14,6 +14,7 @@
 #if !defined(XGBOOST_USE_NCCL)
 #include "../common/common.h"           // for AssertNCCLSupport
 #endif                                  // !defined(XGBOOST_USE_NCCL)
+#include "../common/json_utils.h"       // for OptionalArg
 #include "allgather.h"                  // for RingAllgather
 #include "protocol.h"                   // for kMagic
 #include "xgboost/base.h"               // for XGBOOST_STRICT_R_MODE
@@ -59,10 +60,10 @@ Result ConnectTrackerImpl(proto::PeerInfo info, std::chrono::seconds timeout, st
                             this->Rank(), this->World());
 }
 
-[[nodiscard]] Result ConnectWorkers(Comm const& comm, TCPSocket* listener, std::int32_t lport,
-                                    proto::PeerInfo ninfo, std::chrono::seconds timeout,
-                                    std::int32_t retry,
-                                    std::vector<std::shared_ptr<TCPSocket>>* out_workers) {
+[[nodiscard]] Result ConnectWorkers(
+    Comm const& comm, TCPSocket* listener, std::int32_t lport, proto::PeerInfo ninfo,
+    std::chrono::seconds timeout, std::int32_t retry, std::int32_t n_streams,
+    std::vector<std::vector<std::shared_ptr<TCPSocket>>>* out_workers) {
   auto next = std::make_shared<TCPSocket>();
   auto prev = std::make_shared<TCPSocket>();
 
@@ -137,31 +138,38 @@ Result ConnectTrackerImpl(proto::PeerInfo info, std::chrono::seconds timeout, st
     CHECK_NE(p.port, -1);
   }
 
-  std::vector<std::shared_ptr<TCPSocket>>& workers = *out_workers;
+  CHECK_GE(n_streams, 1);
+  auto& workers = *out_workers;
   workers.resize(comm.World());
+  for (auto& streams : workers) {
+    streams.resize(n_streams);
+  }
 
+  // Each connection is identified by the rank of the worker and the index of the stream.
   for (std::int32_t r = (comm.Rank() + 1); r < comm.World(); ++r) {
     auto const& peer = peers[r];
-    auto worker = std::make_shared<TCPSocket>();
-    rc = std::move(rc)
-         << [&] { return Connect(peer.host, peer.port, retry, timeout, worker.get()); }
-         << [&] { return worker->RecvTimeout(timeout); };
-    if (!rc.OK()) {
-      return rc;
-    }
+    for (std::int32_t s = 0; s < n_streams; ++s) {
+      auto worker = std::make_shared<TCPSocket>();
+      rc = std::move(rc)
+           << [&] { return Connect(peer.host, peer.port, retry, timeout, worker.get()); }
+           << [&] { return worker->RecvTimeout(timeout); };
+      if (!rc.OK()) {
+        return rc;
+      }
 
-    auto rank = comm.Rank();
-    std::size_t n_bytes{0};
-    auto rc = worker->SendAll(&rank, sizeof(comm.Rank()), &n_bytes);
-    if (!rc.OK()) {
-      return rc;
-    } else if (n_bytes != sizeof(comm.Rank())) {
-      return Fail("Failed to send rank.", std::move(rc));
+      std::int32_t id[2]{comm.Rank(), s};
+      std::size_t n_bytes{0};
+      auto rc = worker->SendAll(id, sizeof(id), &n_bytes);
+      if (!rc.OK()) {
+        return rc;
+      } else if (n_bytes != sizeof(id)) {
+        return Fail("Failed to send rank.", std::move(rc));
+      }
+      workers[r][s] = std::move(worker);
     }
-    workers[r] = std::move(worker);
   }
 
-  for (std::int32_t r = 0; r < comm.Rank(); ++r) {
+  for (std::int32_t i = 0; i < comm.Rank() * n_streams; ++i) {
     auto peer = std::make_shared<TCPSocket>();
     rc = std::move(rc) << [&] {
       SockAddress addr;
@@ -172,22 +180,29 @@ Result ConnectTrackerImpl(proto::PeerInfo info, std::chrono::seconds timeout, st
     if (!rc.OK()) {
       return rc;
     }
-    std::int32_t rank{-1};
+    std::int32_t id[2]{-1, -1};
     std::size_t n_bytes{0};
-    auto rc = peer->RecvAll(&rank, sizeof(rank), &n_bytes);
+    auto rc = peer->RecvAll(id, sizeof(id), &n_bytes);
     if (!rc.OK()) {
       return rc;
-    } else if (n_bytes != sizeof(comm.Rank())) {
+    } else if (n_bytes != sizeof(id)) {
       return Fail("Failed to recv rank.");
     }
-    workers[rank] = std::move(peer);
+    auto [rank, s] = id;
+    if (rank < 0 || rank >= comm.Rank() || s < 0 || s >= n_streams || workers[rank][s]) {
+      return Fail("Got an invalid connection from rank " + std::to_string(rank) + ", stream " +
+                  std::to_string(s) + ".");
+    }
+    workers[rank][s] = std::move(peer);
   }
 
   for (std::int32_t r = 0; r < comm.World(); ++r) {
     if (r == comm.Rank()) {
       continue;
     }
-    CHECK(workers[r]);
+    for (auto const& w : workers[r]) {
+      CHECK(w);
+    }
   }
 
   return Success();
@@ -204,7 +219,8 @@ std::string InitLog(std::string task_id, std::int32_t rank) {
 
 RabitComm::RabitComm(std::string const& tracker_host, std::int32_t tracker_port,
                      std::chrono::seconds timeout, std::int32_t retry, std::string task_id,
-                     StringView nccl_path)
+                     StringView nccl_path, LoopBackend loop_backend,
+                     std::chrono::microseconds busy_poll)
     : HostComm{tracker_host, tracker_port, timeout, retry, std::move(task_id)},
       nccl_path_{std::move(nccl_path)} {
   if (this->TrackerInfo().host.empty()) {
@@ -213,7 +229,7 @@ RabitComm::RabitComm(std::string const& tracker_host, std::int32_t tracker_port,
     return;
   }
 
-  loop_.reset(new Loop{std::chrono::seconds{timeout_}});  // NOLINT
+  loop_.reset(new Loop{std::chrono::seconds{timeout_}, loop_backend, busy_poll});  // NOLINT
   auto rc = this->Bootstrap(timeout_, retry_, task_id_);
   if (!rc.OK()) {
     this->ResetState();
@@ -325,28 +341,36 @@ Comm* RabitComm::MakeCUDAVar(Context const*, std::shared_ptr<Coll>) const {
   // get the rank of this worker
   this->rank_ = BootstrapPrev(ninfo.rank, world);
   this->tracker_.rank = rank_;
+  // Number of connections to each peer, older trackers don't send it.
+  auto n_streams =
+      static_cast<std::int32_t>(OptionalArg<Integer const>(jnext, "n_streams", Integer::Int{1}));
+  if (n_streams < 1) {
+    return Fail("Invalid number of streams from the tracker: " + std::to_string(n_streams));
+  }
 
-  std::vector<std::shared_ptr<TCPSocket>> workers;
-  rc = ConnectWorkers(*this, &listener, lport, ninfo, timeout, retry, &workers);
+  std::vector<std::vector<std::shared_ptr<TCPSocket>>> workers;
+  rc = ConnectWorkers(*this, &listener, lport, ninfo, timeout, retry, n_streams, &workers);
   if (!rc.OK()) {
     return Fail("Failed to connect to other workers.", std::move(rc));
   }
 
   CHECK(this->channels_.empty());
-  for (auto& w : workers) {
-    if (w) {
-      rc = std::move(rc) << [&] {
-        return w->SetNoDelay();
-      } << [&] {
-        return w->NonBlocking(true);
-      } << [&] {
-        return w->SetKeepAlive();
-      };
-    }
-    if (!rc.OK()) {
-      return rc;
+  for (auto& streams : workers) {
+    for (auto& w : streams) {
+      if (w) {
+        rc = std::move(rc) << [&] {
+          return w->SetNoDelay();
+        } << [&] {
+          return w->NonBlocking(true);
+        } << [&] {
+          return w->SetKeepAlive();
+        };
+      }
+      if (!rc.OK()) {
+        return rc;
+      }
     }
-    this->channels_.emplace_back(std::make_shared<Channel>(*this, w));
+    this->channels_.emplace_back(std::make_shared<Channel>(*this, std::move(streams)));
   }
 
   LOG(CONSOLE) << InitLog(task_id_, rank_);
@@ -2,14 +2,15 @@
  * Copyright 2023-2024, XGBoost Contributors
  */
 #pragma once
-#include <chrono>   // for seconds
-#include <cstddef>  // for size_t
-#include <cstdint>  // for int32_t, int64_t
-#include <memory>   // for shared_ptr
-#include <string>   // for string
-#include <thread>   // for thread
-#include <utility>  // for move
-#include <vector>   // for vector
+#include <algorithm>  // for clamp
+#include <chrono>     // for seconds
+#include <cstddef>    // for size_t
+#include <cstdint>    // for int32_t, int64_t
+#include <memory>     // for shared_ptr
+#include <string>     // for string
+#include <thread>     // for thread
+#include <utility>    // for move
+#include <vector>     // for vector
 
 #include "loop.h"                       // for Loop
 #include "protocol.h"                   // for PeerInfo
@@ -136,7 +137,8 @@ class RabitComm : public HostComm {
   RabitComm() = default;
   RabitComm(std::string const& tracker_host, std::int32_t tracker_port,
             std::chrono::seconds timeout, std::int32_t retry, std::string task_id,
-            StringView nccl_path);
+            StringView nccl_path, LoopBackend loop_backend = LoopBackend::kAuto,
+            std::chrono::microseconds busy_poll = std::chrono::microseconds{0});
   ~RabitComm() noexcept(false) override;
 
   [[nodiscard]] bool IsFederated() const override { return false; }
@@ -150,21 +152,47 @@ class RabitComm : public HostComm {
 
 /**
  * @brief Communication channel between workers.
+ *
+ *   A channel can hold multiple connections to the same peer. Large messages are split into
+ *   contiguous parts, one for each connection, and the event loop fills the parts of the
+ *   receive buffer independently. Both ends split a message based on its size, the sizes
+ *   of a send and the matching receive must be the same.
  */
 class Channel {
-  std::shared_ptr<TCPSocket> sock_{nullptr};
+  std::vector<std::shared_ptr<TCPSocket>> socks_;
   Result rc_;
   Comm const& comm_;
 
+  template <typename Fn>
+  void Stripe(std::size_t n, Fn&& fn) const {
+    std::size_t n_parts = std::clamp(n / MinStripeBytes(), std::size_t{1}, socks_.size());
+    for (std::size_t i = 0; i < n_parts; ++i) {
+      auto beg = n * i / n_parts;
+      auto end = n * (i + 1) / n_parts;
+      CHECK(socks_[i].get());
+      fn(socks_[i].get(), beg, end - beg);
+    }
+  }
+
  public:
+  /**
+   * @brief Minimum size of each part for striping a message across connections.
+   */
+  static constexpr std::size_t MinStripeBytes() { return 256 * 1024; }
+
   explicit Channel(Comm const& comm, std::shared_ptr<TCPSocket> sock)
-      : sock_{std::move(sock)}, comm_{comm} {}
+      : Channel{comm, std::vector<std::shared_ptr<TCPSocket>>{std::move(sock)}} {}
+  Channel(Comm const& comm, std::vector<std::shared_ptr<TCPSocket>> socks)
+      : socks_{std::move(socks)}, comm_{comm} {
+    CHECK(!socks_.empty());
+  }
   virtual ~Channel() = default;
 
   [[nodiscard]] virtual Result SendAll(std::int8_t const* ptr, std::size_t n) {
-    Loop::Op op{Loop::Op::kWrite, comm_.Rank(), const_cast<std::int8_t*>(ptr), n, sock_.get(), 0};
-    CHECK(sock_.get());
-    comm_.Submit(std::move(op));
+    this->Stripe(n, [&](TCPSocket* sock, std::size_t beg, std::size_t n_bytes) {
+      auto data = const_cast<std::int8_t*>(ptr) + beg;
+      comm_.Submit(Loop::Op{Loop::Op::kWrite, comm_.Rank(), data, n_bytes, sock, 0});
+    });
     return Success();
   }
   [[nodiscard]] Result SendAll(common::Span<std::int8_t const> data) {
@@ -172,16 +200,24 @@ class Channel {
   }
 
   [[nodiscard]] virtual Result RecvAll(std::int8_t* ptr, std::size_t n) {
-    Loop::Op op{Loop::Op::kRead, comm_.Rank(), ptr, n, sock_.get(), 0};
-    CHECK(sock_.get());
-    comm_.Submit(std::move(op));
+    this->Stripe(n, [&](TCPSocket* sock, std::size_t beg, std::size_t n_bytes) {
+      comm_.Submit(Loop::Op{Loop::Op::kRead, comm_.Rank(), ptr + beg, n_bytes, sock, 0});
+    });
     return Success();
   }
   [[nodiscard]] Result RecvAll(common::Span<std::int8_t> data) {
     return this->RecvAll(data.data(), data.size_bytes());
   }
 
-  [[nodiscard]] auto Socket() const { return sock_; }
+  /**
+   * @brief The first connection to the peer.
+   */
+  [[nodiscard]] auto Socket() const { return socks_.front(); }
+  /**
+   * @brief All connections to the peer.
+   */
+  [[nodiscard]] auto const& Sockets() const { return socks_; }
+  [[nodiscard]] std::size_t NumStreams() const { return socks_.size(); }
   [[nodiscard]] virtual Result Block() { return comm_.Block(); }
 };
 
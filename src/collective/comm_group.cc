@@ -7,15 +7,22 @@
 #include <cctype>     // for tolower
 #include <chrono>     // for seconds
 #include <cstdint>    // for int32_t
+#include <exception>  // for exception
 #include <iterator>   // for back_inserter
-#include <memory>     // for shared_ptr, unique_ptr
+#include <future>     // for future
+#include <memory>     // for shared_ptr, unique_ptr, make_unique
 #include <string>     // for string
-
-#include "../common/json_utils.h"  // for OptionalArg
-#include "coll.h"                  // for Coll
-#include "comm.h"                  // for Comm
-#include "xgboost/context.h"       // for DeviceOrd
-#include "xgboost/json.h"          // for Json
+#include <utility>    // for move
+
+#include "../common/json_utils.h"   // for OptionalArg
+#include "coll.h"                   // for Coll, ParseAllreduceAlgo
+#include "comm.h"                   // for Comm, RabitComm
+#include "loop.h"                   // for ParseLoopBackend
+#include "shm_comm.h"               // for ShmComm
+#include "xgboost/context.h"        // for DeviceOrd
+#include "xgboost/global_config.h"  // for InitNewThread
+#include "xgboost/json.h"           // for Json
+#include "xgboost/logging.h"        // for Error
 
 #if defined(XGBOOST_USE_FEDERATED)
 #include "../../plugin/federated/federated_coll.h"
@@ -84,11 +91,31 @@ CommGroup::CommGroup()
     auto tracker_host = get_param("dmlc_tracker_uri", std::string{}, String{});
     auto tracker_port = get_param("dmlc_tracker_port", static_cast<std::int64_t>(0), Integer{});
     auto nccl = get_param("dmlc_nccl_path", std::string{DefaultNcclName()}, String{});
+    auto algo = get_param("dmlc_allreduce_algo", std::string{"auto"}, String{});
+    auto hierarchical = get_param("dmlc_allreduce_hierarchical", false, Boolean{});
+    auto loop_backend = get_param("dmlc_loop_backend", std::string{"auto"}, String{});
+    auto busy_poll = get_param("dmlc_loop_busy_poll", static_cast<Integer::Int>(0), Integer{});
+    CHECK_GE(busy_poll, 0);
     auto ptr = new CommGroup{
         std::shared_ptr<RabitComm>{new RabitComm{  // NOLINT
             tracker_host, static_cast<std::int32_t>(tracker_port), std::chrono::seconds{timeout},
-            static_cast<std::int32_t>(retry), task_id, nccl}},
-        std::shared_ptr<Coll>(new Coll{})};  // NOLINT
+            static_cast<std::int32_t>(retry), task_id, nccl, ParseLoopBackend(loop_backend),
+            std::chrono::microseconds{busy_poll}}},
+        std::shared_ptr<Coll>(new Coll{ParseAllreduceAlgo(algo), hierarchical})};  // NOLINT
+    return ptr;
+  } else if (type == "shm") {
+    auto tracker_host = get_param("dmlc_tracker_uri", std::string{}, String{});
+    auto tracker_port = get_param("dmlc_tracker_port", static_cast<std::int64_t>(0), Integer{});
+    auto nccl = get_param("dmlc_nccl_path", std::string{DefaultNcclName()}, String{});
+    auto algo = get_param("dmlc_allreduce_algo", std::string{"auto"}, String{});
+    auto ring_bytes = get_param("dmlc_shm_ring_bytes",
+                                static_cast<Integer::Int>(ShmComm::DefaultRingBytes()), Integer{});
+    CHECK_GT(ring_bytes, 0);
+    auto ptr = new CommGroup{
+        std::shared_ptr<ShmComm>{new ShmComm{  // NOLINT
+            tracker_host, static_cast<std::int32_t>(tracker_port), std::chrono::seconds{timeout},
+            static_cast<std::int32_t>(retry), task_id, nccl, static_cast<std::size_t>(ring_bytes)}},
+        std::shared_ptr<Coll>(new Coll{ParseAllreduceAlgo(algo)})};  // NOLINT
     return ptr;
   } else if (type == "federated") {
 #if defined(XGBOOST_USE_FEDERATED)
@@ -104,6 +131,22 @@ CommGroup::CommGroup()
   return nullptr;
 }
 
+[[nodiscard]] std::future<Result> CommGroup::Async(std::function<Result()> fn) const {
+  if (!async_) {
+    async_ = std::make_unique<common::ThreadPool>("coll-async", 1, InitNewThread{});
+  }
+  // The thread pool doesn't handle exceptions, convert them into errors for the caller.
+  return async_->Submit([fn = std::move(fn)]() -> Result {
+    try {
+      return fn();
+    } catch (dmlc::Error const& e) {
+      return Fail("Async collective failed: " + std::string{e.what()});
+    } catch (std::exception const& e) {
+      return Fail("Async collective failed: " + std::string{e.what()});
+    }
+  });
+}
+
 std::unique_ptr<collective::CommGroup>& GlobalCommGroup() {
   static thread_local std::unique_ptr<collective::CommGroup> sptr;
   if (!sptr) {
@@ -2,10 +2,13 @@
  * Copyright 2023, XGBoost Contributors
  */
 #pragma once
-#include <memory>   // for shared_ptr, unique_ptr
-#include <string>   // for string
-#include <utility>  // for move
+#include <functional>  // for function
+#include <future>      // for future
+#include <memory>      // for shared_ptr, unique_ptr
+#include <string>      // for string
+#include <utility>     // for move
 
+#include "../common/threadpool.h"       // for ThreadPool
 #include "coll.h"                       // for Comm
 #include "comm.h"                       // for Coll
 #include "xgboost/collective/result.h"  // for Result
@@ -21,6 +24,8 @@ class CommGroup {
 
   std::shared_ptr<Coll> backend_;
   mutable std::shared_ptr<Coll> gpu_coll_;  // lazy initialization
+  // Single thread for running collectives in the background, lazy initialization.
+  mutable std::unique_ptr<common::ThreadPool> async_;
 
   CommGroup(std::shared_ptr<Comm> comm, std::shared_ptr<Coll> coll)
       : comm_{std::dynamic_pointer_cast<HostComm>(comm)}, backend_{std::move(coll)} {
@@ -35,6 +40,8 @@ class CommGroup {
   [[nodiscard]] bool IsDistributed() const noexcept { return comm_->IsDistributed(); }
 
   [[nodiscard]] Result Finalize() const {
+    // Finish the pending collectives.
+    async_.reset();
     return Success() << [this] {
       if (gpu_comm_) {
         return gpu_comm_->Shutdown();
@@ -56,6 +63,15 @@ class CommGroup {
    */
   [[nodiscard]] Comm const& Ctx(Context const* ctx, DeviceOrd device) const;
   [[nodiscard]] Result SignalError(Result const& res) { return comm_->SignalError(res); }
+  /**
+   * @brief Run a collective in a background thread.
+   *
+   *   Submitted functions are executed one at a time in the submission order, which keeps
+   *   the order of collectives consistent across workers. The caller must wait for all
+   *   pending collectives before running any synchronous collective as they share the same
+   *   channels. Exceptions thrown by the function are returned as a failed result.
+   */
+  [[nodiscard]] std::future<Result> Async(std::function<Result()> fn) const;
 
   [[nodiscard]] Result ProcessorName(std::string* out) const {
     return this->comm_->ProcessorName(out);
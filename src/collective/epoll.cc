@@ -0,0 +1,224 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include "epoll.h"
+
+#if defined(__linux__)
+#include <sys/epoll.h>  // for epoll_create1, epoll_ctl, epoll_wait, epoll_event
+#include <unistd.h>     // for close
+#endif                  // defined(__linux__)
+
+#include <algorithm>     // for max
+#include <cerrno>        // for errno, EEXIST, ENOENT, EBADF
+#include <chrono>        // for steady_clock, milliseconds
+#include <cstddef>       // for size_t
+#include <string>        // for to_string
+#include <system_error>  // for make_error_code, errc
+
+#include "xgboost/collective/poll_utils.h"  // for PollError
+#include "xgboost/collective/socket.h"      // for FailWithCode
+#include "xgboost/logging.h"                // for CHECK
+
+namespace xgboost::collective {
+#if defined(__linux__)
+// The event flags are used with `PollError`.
+static_assert(EPOLLIN == POLLIN && EPOLLOUT == POLLOUT && EPOLLERR == POLLERR &&
+              EPOLLHUP == POLLHUP);
+
+namespace {
+[[nodiscard]] Result Control(std::int32_t efd, std::int32_t op, std::int32_t fd,
+                             std::uint32_t events) {
+  epoll_event ev{};
+  ev.events = events;
+  ev.data.fd = fd;
+  if (epoll_ctl(efd, op, fd, &ev) != 0) {
+    return system::FailWithCode("epoll_ctl failed, fd:" + std::to_string(fd));
+  }
+  return Success();
+}
+
+// Add a socket or modify its interest, handles stale registrations of reused fds.
+[[nodiscard]] Result Register(std::int32_t efd, std::int32_t fd, std::uint32_t events,
+                              bool is_registered) {
+  auto op = is_registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+  epoll_event ev{};
+  ev.events = events;
+  ev.data.fd = fd;
+  if (epoll_ctl(efd, op, fd, &ev) == 0) {
+    return Success();
+  }
+  if (op == EPOLL_CTL_MOD && errno == ENOENT) {
+    // The socket was closed and the fd has been reused.
+    return Control(efd, EPOLL_CTL_ADD, fd, events);
+  }
+  if (op == EPOLL_CTL_ADD && errno == EEXIST) {
+    return Control(efd, EPOLL_CTL_MOD, fd, events);
+  }
+  return system::FailWithCode("epoll_ctl failed, fd:" + std::to_string(fd));
+}
+}  // namespace
+
+EPollHelper::~EPollHelper() {
+  if (efd_ != -1) {
+    close(efd_);
+  }
+}
+
+[[nodiscard]] Result EPollHelper::Init(std::chrono::microseconds busy_poll) {
+  CHECK_EQ(efd_, -1) << "The epoll instance is already created.";
+  efd_ = epoll_create1(EPOLL_CLOEXEC);
+  if (efd_ == -1) {
+    return system::FailWithCode("Failed to create the epoll instance.");
+  }
+  busy_poll_ = busy_poll;
+  return Success();
+}
+
+void EPollHelper::Watch(TCPSocket const& socket, std::uint32_t events) {
+  auto& interest = watched_[socket.Handle()];
+  interest.id = socket.Id();
+  interest.events |= events;
+}
+
+void EPollHelper::WatchRead(TCPSocket const& socket) { this->Watch(socket, EPOLLIN); }
+
+void EPollHelper::WatchWrite(TCPSocket const& socket) { this->Watch(socket, EPOLLOUT); }
+
+[[nodiscard]] bool EPollHelper::CheckRead(TCPSocket const& socket) const {
+  auto it = ready_.find(socket.Handle());
+  return it != ready_.cend() && (it->second & EPOLLIN) != 0;
+}
+
+[[nodiscard]] bool EPollHelper::CheckWrite(TCPSocket const& socket) const {
+  auto it = ready_.find(socket.Handle());
+  return it != ready_.cend() && (it->second & EPOLLOUT) != 0;
+}
+
+[[nodiscard]] Result EPollHelper::Update() {
+  for (auto const& [fd, interest] : watched_) {
+    auto it = registered_.find(fd);
+    // A different socket means the previous one is closed and the fd has been reused.
+    bool is_registered = it != registered_.cend() && it->second.id == interest.id;
+    if (is_registered && it->second.events == interest.events) {
+      continue;
+    }
+    auto rc = Register(efd_, fd, interest.events, is_registered);
+    if (!rc.OK()) {
+      return rc;
+    }
+    registered_[fd] = interest;
+  }
+  // Stop reporting readiness for sockets that are not watched in this round.
+  for (auto it = registered_.begin(); it != registered_.end();) {
+    auto fd = it->first;
+    if (it->second.events == 0 || watched_.find(fd) != watched_.cend()) {
+      ++it;
+      continue;
+    }
+    epoll_event ev{};
+    ev.data.fd = fd;
+    if (epoll_ctl(efd_, EPOLL_CTL_MOD, fd, &ev) != 0) {
+      if (errno != ENOENT && errno != EBADF) {
+        return system::FailWithCode("epoll_ctl failed, fd:" + std::to_string(fd));
+      }
+      // The socket is closed, the kernel has removed it.
+      it = registered_.erase(it);
+      continue;
+    }
+    it->second.events = 0;
+    ++it;
+  }
+  return Success();
+}
+
+[[nodiscard]] Result EPollHelper::Wait(std::chrono::seconds timeout, std::int32_t* n_events) {
+  auto max_events = static_cast<std::int32_t>(std::max(registered_.size(), std::size_t{1}));
+  events_.resize(max_events * sizeof(epoll_event));
+  auto* events = reinterpret_cast<epoll_event*>(events_.data());
+
+  std::int32_t n{0};
+  if (busy_poll_.count() > 0) {
+    auto deadline = std::chrono::steady_clock::now() + busy_poll_;
+    do {
+      n = epoll_wait(efd_, events, max_events, 0);
+    } while (n == 0 && std::chrono::steady_clock::now() < deadline);
+  }
+  if (n == 0) {
+    auto ms = timeout.count() < 0 ? -1 : std::chrono::milliseconds{timeout}.count();
+    n = epoll_wait(efd_, events, max_events, static_cast<std::int32_t>(ms));
+  }
+  if (n == 0) {
+    return Fail("Poll timeout:" + std::to_string(timeout.count()) + " seconds.",
+                std::make_error_code(std::errc::timed_out));
+  } else if (n < 0) {
+    return system::FailWithCode("epoll_wait failed, nfds:" + std::to_string(watched_.size()));
+  }
+  *n_events = n;
+  return Success();
+}
+
+[[nodiscard]] Result EPollHelper::Poll(std::chrono::seconds timeout, bool check_error) {
+  CHECK_NE(efd_, -1) << "The epoll instance is not created.";
+  ready_.clear();
+  auto rc = this->Update();
+  if (!rc.OK()) {
+    return rc;
+  }
+  while (ready_.empty()) {
+    std::int32_t n{0};
+    rc = this->Wait(timeout, &n);
+    if (!rc.OK()) {
+      return rc;
+    }
+    auto const* events = reinterpret_cast<epoll_event const*>(events_.data());
+    for (std::int32_t i = 0; i < n; ++i) {
+      auto fd = events[i].data.fd;
+      auto revents = events[i].events;
+      auto it = watched_.find(fd);
+      if (it == watched_.cend()) {
+        // Errors are always reported, remove the socket to avoid waking up repeatedly. It's
+        // registered again if it's watched later.
+        rc = Control(efd_, EPOLL_CTL_DEL, fd, 0);
+        if (!rc.OK()) {
+          return rc;
+        }
+        registered_.erase(fd);
+        continue;
+      }
+      auto result = rabit::utils::PollError(revents);
+      if (check_error && !result.OK()) {
+        return result;
+      }
+      ready_[fd] = revents & it->second.events;
+    }
+  }
+  return Success();
+}
+#else
+EPollHelper::~EPollHelper() = default;
+
+[[nodiscard]] Result EPollHelper::Init(std::chrono::microseconds) {
+  return Fail("epoll is only supported on Linux.");
+}
+
+void EPollHelper::Watch(TCPSocket const&, std::uint32_t) { LOG(FATAL) << "Not implemented."; }
+
+void EPollHelper::WatchRead(TCPSocket const&) { LOG(FATAL) << "Not implemented."; }
+
+void EPollHelper::WatchWrite(TCPSocket const&) { LOG(FATAL) << "Not implemented."; }
+
+[[nodiscard]] bool EPollHelper::CheckRead(TCPSocket const&) const { return false; }
+
+[[nodiscard]] bool EPollHelper::CheckWrite(TCPSocket const&) const { return false; }
+
+[[nodiscard]] Result EPollHelper::Update() { return Fail("epoll is only supported on Linux."); }
+
+[[nodiscard]] Result EPollHelper::Wait(std::chrono::seconds, std::int32_t*) {
+  return Fail("epoll is only supported on Linux.");
+}
+
+[[nodiscard]] Result EPollHelper::Poll(std::chrono::seconds, bool) {
+  return Fail("epoll is only supported on Linux.");
+}
+#endif  // defined(__linux__)
+}  // namespace xgboost::collective
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#pragma once
+#include <chrono>         // for seconds, microseconds
+#include <cstdint>        // for int32_t, uint32_t
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "xgboost/collective/result.h"  // for Result
+#include "xgboost/collective/socket.h"  // for TCPSocket
+
+namespace xgboost::collective {
+/**
+ * @brief Readiness notification with Linux epoll, has the same interface as the
+ *        `PollHelper`.
+ *
+ *   Sockets are registered with epoll the first time they are watched and stay registered
+ *   across rounds. Each round, only the sockets whose interest changed since the previous
+ *   round are modified. Sockets not watched in a round have their interest cleared instead
+ *   of being removed, as the ring collectives keep using the same sockets. A closed socket
+ *   is removed from epoll by the kernel, registrations record the socket ID to detect a
+ *   new socket that reuses the fd.
+ *
+ *   Not supported on other platforms, @ref Init returns an error.
+ */
+class EPollHelper {
+  std::int32_t efd_{-1};
+  std::chrono::microseconds busy_poll_{0};
+
+  struct Interest {
+    // ID of the socket, see @ref TCPSocket::Id
+    std::uint64_t id{0};
+    std::uint32_t events{0};
+  };
+  // Interest registered with epoll.
+  std::unordered_map<std::int32_t, Interest> registered_;
+  // Interest for the current round.
+  std::unordered_map<std::int32_t, Interest> watched_;
+  // Ready events from the last poll.
+  std::unordered_map<std::int32_t, std::uint32_t> ready_;
+  // Buffer for `epoll_wait`.
+  std::vector<std::int8_t> events_;
+
+  void Watch(TCPSocket const& socket, std::uint32_t events);
+  [[nodiscard]] Result Update();
+  [[nodiscard]] Result Wait(std::chrono::seconds timeout, std::int32_t* n_events);
+
+ public:
+  EPollHelper() = default;
+  EPollHelper(EPollHelper const& that) = delete;
+  EPollHelper& operator=(EPollHelper const& that) = delete;
+  EPollHelper(EPollHelper&& that) = delete;
+  EPollHelper& operator=(EPollHelper&& that) = delete;
+  ~EPollHelper();
+
+  /**
+   * @brief Create the epoll instance.
+   *
+   * @param busy_poll Duration for polling without blocking before waiting for events. Can
+   *                  reduce the latency of small messages at the cost of CPU time.
+   */
+  [[nodiscard]] Result Init(std::chrono::microseconds busy_poll);
+  /**
+   * @brief Clear the interest of the current round, the sockets stay registered.
+   */
+  void Clear() { watched_.clear(); }
+
+  void WatchRead(TCPSocket const& socket);
+  void WatchWrite(TCPSocket const& socket);
+
+  [[nodiscard]] bool CheckRead(TCPSocket const& socket) const;
+  [[nodiscard]] bool CheckWrite(TCPSocket const& socket) const;
+  /**
+   * @brief Wait for the watched sockets.
+   *
+   * @param timeout Timeout in seconds. Block if negative.
+   */
+  [[nodiscard]] Result Poll(std::chrono::seconds timeout, bool check_error = true);
+};
+}  // namespace xgboost::collective
@@ -0,0 +1,261 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include "hierarchical.h"
+
+#include <algorithm>  // for copy_n, min, find, sort
+#include <atomic>     // for atomic
+#include <chrono>     // for steady_clock, microseconds, seconds
+#include <cstring>    // for memcpy
+#include <iterator>   // for distance
+#include <map>        // for map
+#include <new>        // for placement new
+#include <string>     // for string
+#include <thread>     // for yield, sleep_for
+#include <utility>    // for move
+
+#include "allgather.h"                  // for RingAllgather
+#include "xgboost/collective/socket.h"  // for HOST_NAME_MAX
+#include "xgboost/logging.h"            // for CHECK
+
+namespace xgboost::collective::cpu_impl {
+namespace {
+// Sequence number in the shared segment, placed in its own cache line.
+struct alignas(64) Flag {
+  std::atomic<std::uint64_t> seq{0};
+};
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+// Layout of the segment: a ready flag for each local worker, a done flag for the leader,
+// followed by a data slot for each local worker.
+std::size_t HeaderBytes(std::size_t n_local) { return sizeof(Flag) * (n_local + 1); }
+
+Flag* Flags(SharedMemory const& shm) { return reinterpret_cast<Flag*>(shm.Data().data()); }
+
+common::Span<std::int8_t> Slot(SharedMemory const& shm, std::size_t n_local, std::size_t i,
+                               std::size_t slot_bytes) {
+  return shm.Data().subspan(HeaderBytes(n_local) + i * slot_bytes, slot_bytes);
+}
+
+[[nodiscard]] Result WaitFor(Flag const& flag, std::uint64_t seq, std::chrono::seconds timeout) {
+  constexpr std::size_t kMaxSpins = 1024;
+  auto start = std::chrono::steady_clock::now();
+  std::size_t n_spins = 0;
+  while (flag.seq.load(std::memory_order_acquire) < seq) {
+    if (n_spins < kMaxSpins) {
+      ++n_spins;
+      std::this_thread::yield();
+      continue;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds{50});
+    if (timeout.count() > 0 && std::chrono::steady_clock::now() - start > timeout) {
+      return Fail("Timeout waiting for the local workers through shared memory.");
+    }
+  }
+  return Success();
+}
+
+/**
+ * @brief A view of the parent communicator containing only the leaders.
+ */
+class LeaderComm : public Comm {
+  Comm const& parent_;
+  std::vector<std::int32_t> ranks_;
+
+ public:
+  LeaderComm(Comm const& parent, std::vector<std::int32_t> ranks, std::int32_t rank)
+      : parent_{parent}, ranks_{std::move(ranks)} {
+    this->world_ = static_cast<std::int32_t>(ranks_.size());
+    this->rank_ = rank;
+    this->timeout_ = parent.Timeout();
+    this->retry_ = parent.Retry();
+  }
+
+  [[nodiscard]] std::shared_ptr<Channel> Chan(std::int32_t rank) const override {
+    return parent_.Chan(ranks_.at(rank));
+  }
+  [[nodiscard]] Result Block() const override { return parent_.Block(); }
+  [[nodiscard]] bool IsFederated() const override { return parent_.IsFederated(); }
+  [[nodiscard]] Result LogTracker(std::string msg) const override {
+    return parent_.LogTracker(std::move(msg));
+  }
+  // Channels are owned by the parent.
+  [[nodiscard]] Result Shutdown() override { return Success(); }
+};
+}  // namespace
+
+HierarchicalAllreduce::HierarchicalAllreduce(std::size_t slot_bytes) : slot_bytes_{slot_bytes} {
+  CHECK_GT(slot_bytes_, 0);
+  // Keep slots aligned for all data types.
+  CHECK_EQ(slot_bytes_ % sizeof(Flag), 0);
+}
+
+HierarchicalAllreduce::~HierarchicalAllreduce() = default;
+
+[[nodiscard]] Result HierarchicalAllreduce::Init(Comm const& comm, std::string const& host) {
+  comm_ = &comm;
+  auto world = comm.World();
+  auto rank = comm.Rank();
+
+  // Exchange the host names.
+  if (host.size() >= HOST_NAME_MAX) {
+    return Fail("Got an invalid host name.");
+  }
+  std::vector<std::int8_t> buffer(HOST_NAME_MAX * world, 0);
+  std::copy_n(host.cbegin(), host.size(), buffer.begin() + HOST_NAME_MAX * rank);
+  auto rc = RingAllgather(comm, common::Span{buffer.data(), buffer.size()});
+  if (!rc.OK()) {
+    return Fail("Failed to get host names from peers.", std::move(rc));
+  }
+
+  // Group workers by host, ordered by rank.
+  std::map<std::string, std::vector<std::int32_t>> groups;
+  for (std::int32_t r = 0; r < world; ++r) {
+    auto name = reinterpret_cast<char const*>(buffer.data() + HOST_NAME_MAX * r);
+    groups[name].push_back(r);
+  }
+  std::vector<std::int32_t> leaders;
+  for (auto const& kv : groups) {
+    leaders.push_back(kv.second.front());
+    enabled_ |= kv.second.size() > 1;
+  }
+  std::sort(leaders.begin(), leaders.end());
+
+  local_ranks_ = groups.at(host);
+  auto it = std::find(local_ranks_.cbegin(), local_ranks_.cend(), rank);
+  CHECK(it != local_ranks_.cend());
+  local_rank_ = static_cast<std::int32_t>(std::distance(local_ranks_.cbegin(), it));
+  if (!enabled_) {
+    return Success();
+  }
+
+  if (this->IsLeader()) {
+    auto lit = std::find(leaders.cbegin(), leaders.cend(), rank);
+    auto leader_rank = static_cast<std::int32_t>(std::distance(leaders.cbegin(), lit));
+    leaders_ = std::make_shared<LeaderComm>(comm, std::move(leaders), leader_rank);
+  }
+  if (this->LocalWorld() == 1) {
+    return Success();
+  }
+  return this->InitSharedMemory(comm);
+}
+
+[[nodiscard]] Result HierarchicalAllreduce::InitSharedMemory(Comm const& comm) {
+  auto n_local = this->LocalWorld();
+  auto n_bytes = HeaderBytes(n_local) + n_local * slot_bytes_;
+  shm_ = std::make_unique<SharedMemory>();
+
+  std::vector<std::int8_t> name(SharedMemory::MaxNameBytes(), 0);
+  auto s_name = common::Span{name.data(), name.size()};
+  std::int8_t ack{0};
+  if (this->IsLeader()) {
+    auto rc = Success() << [&] {
+      return shm_->Create(SharedMemory::MakeName(comm.Rank()), n_bytes);
+    } << [&] {
+      auto* flags = Flags(*shm_);
+      for (std::size_t i = 0; i < n_local + 1; ++i) {
+        new (flags + i) Flag{};
+      }
+      std::copy_n(shm_->Name().cbegin(), shm_->Name().size(), name.begin());
+      for (std::size_t i = 1; i < n_local; ++i) {
+        auto rc = comm.Chan(local_ranks_[i])->SendAll(s_name);
+        if (!rc.OK()) {
+          return rc;
+        }
+      }
+      return comm.Block();
+    } << [&] {
+      // Wait for all local workers to open the segment before unlinking it.
+      for (std::size_t i = 1; i < n_local; ++i) {
+        auto rc = comm.Chan(local_ranks_[i])->RecvAll(&ack, sizeof(ack));
+        if (!rc.OK()) {
+          return rc;
+        }
+        rc = comm.Block();
+        if (!rc.OK()) {
+          return rc;
+        }
+      }
+      return shm_->Unlink();
+    };
+    if (!rc.OK()) {
+      return Fail("Failed to create the shared memory for local workers.", std::move(rc));
+    }
+    return Success();
+  }
+
+  auto leader = comm.Chan(local_ranks_.front());
+  auto rc = Success() << [&] {
+    return leader->RecvAll(s_name);
+  } << [&] {
+    return comm.Block();
+  } << [&] {
+    return shm_->Open(reinterpret_cast<char const*>(name.data()), n_bytes);
+  } << [&] {
+    return leader->SendAll(&ack, sizeof(ack));
+  } << [&] {
+    return comm.Block();
+  };
+  if (!rc.OK()) {
+    return Fail("Failed to open the shared memory from the local leader.", std::move(rc));
+  }
+  return Success();
+}
+
+[[nodiscard]] Result HierarchicalAllreduce::Allreduce(common::Span<std::int8_t> data,
+                                                      Func const& op,
+                                                      ArrayInterfaceHandler::Type type,
+                                                      AllreduceAlgo algo) {
+  CHECK(comm_);
+  CHECK(enabled_);
+  auto n_bytes_elem = DispatchDType(type, [](auto t) { return sizeof(t); });
+  CHECK_EQ(data.size_bytes() % n_bytes_elem, 0);
+  auto chunk_bytes = slot_bytes_ / n_bytes_elem * n_bytes_elem;
+  CHECK_GT(chunk_bytes, 0);
+
+  auto n_local = this->LocalWorld();
+  auto timeout = comm_->Timeout();
+  auto* flags = shm_ ? Flags(*shm_) : nullptr;
+
+  for (std::size_t offset = 0; offset < data.size_bytes(); offset += chunk_bytes) {
+    auto seg = data.subspan(offset, std::min(chunk_bytes, data.size_bytes() - offset));
+    auto seq = ++seq_;
+    // Reduce inside the host.
+    if (n_local > 1 && !this->IsLeader()) {
+      auto slot = Slot(*shm_, n_local, local_rank_, slot_bytes_);
+      std::memcpy(slot.data(), seg.data(), seg.size_bytes());
+      flags[local_rank_].seq.store(seq, std::memory_order_release);
+    } else if (n_local > 1) {
+      for (std::size_t i = 1; i < n_local; ++i) {
+        auto rc = WaitFor(flags[i], seq, timeout);
+        if (!rc.OK()) {
+          return rc;
+        }
+        op(Slot(*shm_, n_local, i, slot_bytes_).subspan(0, seg.size_bytes()), seg);
+      }
+    }
+    // Reduce between hosts.
+    if (this->IsLeader()) {
+      auto rc = cpu_impl::Allreduce(*leaders_, seg, op, type, algo);
+      if (!rc.OK()) {
+        return Fail("Inter-host allreduce failed.", std::move(rc));
+      }
+    }
+    // Broadcast inside the host. The leader only overwrites its slot after all local
+    // workers have copied the previous result, as it waits for their next input first.
+    if (n_local > 1 && this->IsLeader()) {
+      auto slot = Slot(*shm_, n_local, 0, slot_bytes_);
+      std::memcpy(slot.data(), seg.data(), seg.size_bytes());
+      flags[n_local].seq.store(seq, std::memory_order_release);
+    } else if (n_local > 1) {
+      auto rc = WaitFor(flags[n_local], seq, timeout);
+      if (!rc.OK()) {
+        return rc;
+      }
+      auto slot = Slot(*shm_, n_local, 0, slot_bytes_);
+      std::memcpy(seg.data(), slot.data(), seg.size_bytes());
+    }
+  }
+  return Success();
+}
+}  // namespace xgboost::collective::cpu_impl
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#pragma once
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int8_t, int32_t, uint64_t
+#include <memory>   // for shared_ptr, unique_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../data/array_interface.h"    // for ArrayInterfaceHandler
+#include "allreduce.h"                  // for Func
+#include "coll.h"                       // for AllreduceAlgo
+#include "comm.h"                       // for Comm
+#include "shm.h"                        // for SharedMemory
+#include "xgboost/collective/result.h"  // for Result
+#include "xgboost/span.h"               // for Span
+
+namespace xgboost::collective::cpu_impl {
+/**
+ * @brief Two-level allreduce for multiple workers on the same host.
+ *
+ *   Workers are grouped by host name. Inside a group, workers write their data into slots
+ *   of a shared memory segment and the first worker (the leader) reduces them. Leaders
+ *   run the inter-host allreduce among themselves, then write the result back for the
+ *   other workers in the group to copy. Data larger than a slot is processed in chunks.
+ *
+ *   Synchronization is done with sequence numbers in the shared segment, the TCP
+ *   channels are used only for setting up the segment.
+ */
+class HierarchicalAllreduce {
+ public:
+  static constexpr std::size_t DefaultSlotBytes() { return 4 * 1024 * 1024; }
+
+ private:
+  Comm const* comm_{nullptr};
+  std::size_t slot_bytes_;
+  // Global ranks of the workers on the current host, the first one is the leader.
+  std::vector<std::int32_t> local_ranks_;
+  std::int32_t local_rank_{0};
+  // Whether any host has more than one worker.
+  bool enabled_{false};
+  // Communicator for leaders, null for other workers.
+  std::shared_ptr<Comm> leaders_;
+  std::unique_ptr<SharedMemory> shm_;
+  std::uint64_t seq_{0};
+
+  [[nodiscard]] Result InitSharedMemory(Comm const& comm);
+
+ public:
+  explicit HierarchicalAllreduce(std::size_t slot_bytes = DefaultSlotBytes());
+  ~HierarchicalAllreduce();
+  /**
+   * @brief Group the workers and set up the shared memory. This is a collective call.
+   *
+   * @param comm The communicator for all workers.
+   * @param host Name of the host for the current worker.
+   */
+  [[nodiscard]] Result Init(Comm const& comm, std::string const& host);
+  /**
+   * @brief Run an allreduce with an element-wise op.
+   *
+   * @param algo The algorithm for the inter-host allreduce.
+   */
+  [[nodiscard]] Result Allreduce(common::Span<std::int8_t> data, Func const& op,
+                                 ArrayInterfaceHandler::Type type, AllreduceAlgo algo);
+
+  [[nodiscard]] bool Enabled() const { return enabled_; }
+  [[nodiscard]] Comm const* Parent() const { return comm_; }
+  [[nodiscard]] bool IsLeader() const { return local_rank_ == 0; }
+  [[nodiscard]] std::size_t LocalWorld() const { return local_ranks_.size(); }
+};
+}  // namespace xgboost::collective::cpu_impl
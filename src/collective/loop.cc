@@ -7,7 +7,7 @@
 #include <cstdint>    // for int32_t
 #include <exception>  // for exception, current_exception, rethrow_exception
 #include <future>     // for promise
-#include <memory>     // for make_shared
+#include <memory>     // for make_shared, make_unique
 #include <mutex>      // for lock_guard, unique_lock
 #include <queue>      // for queue
 #include <string>     // for string
@@ -18,10 +18,24 @@
 #include "xgboost/collective/poll_utils.h"  // for PollHelper
 #include "xgboost/collective/result.h"      // for Fail, Success
 #include "xgboost/collective/socket.h"      // for FailWithCode
-#include "xgboost/logging.h"                // for CHECK
+#include "xgboost/logging.h"                // for CHECK, LOG
 
 namespace xgboost::collective {
-Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
+LoopBackend ParseLoopBackend(std::string const& name) {
+  if (name == "auto") {
+    return LoopBackend::kAuto;
+  } else if (name == "poll") {
+    return LoopBackend::kPoll;
+  } else if (name == "epoll") {
+    return LoopBackend::kEpoll;
+  }
+  LOG(FATAL) << "Invalid event loop backend: `" << name
+             << "`. Available options are `auto`, `poll`, and `epoll`.";
+  return LoopBackend::kAuto;
+}
+
+template <typename Poller>
+Result Loop::ProcessQueue(std::queue<Op>* p_queue, Poller* p_poll) const {
   timer_.Start(__func__);
   auto error = [this](Op op) {
     op.pr->set_value();
@@ -34,10 +48,12 @@ Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
   }
 
   auto& qcopy = *p_queue;
+  auto& poll = *p_poll;
 
   // clear the copied queue
   while (!qcopy.empty()) {
-    rabit::utils::PollHelper poll;
+    poll.Clear();
+    bool has_sock{false};
     std::size_t n_ops = qcopy.size();
 
     // Iterate through all the ops for poll
@@ -48,10 +64,12 @@ Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
       switch (op.code) {
         case Op::kRead: {
           poll.WatchRead(*op.sock);
+          has_sock = true;
           break;
         }
         case Op::kWrite: {
           poll.WatchWrite(*op.sock);
+          has_sock = true;
           break;
         }
         case Op::kSleep: {
@@ -68,7 +86,7 @@ Result Loop::ProcessQueue(std::queue<Op>* p_queue) const {
 
     // poll, work on fds that are ready.
     timer_.Start("poll");
-    if (!poll.fds.empty()) {
+    if (has_sock) {
       auto rc = poll.Poll(timeout_);
       if (!rc.OK()) {
         timer_.Stop(__func__);
@@ -180,7 +198,13 @@ void Loop::Process() {
       lock.unlock();
 
       // Clear the local queue.
-      auto rc = this->ProcessQueue(&qcopy);
+      Result rc;
+      if (epoll_) {
+        rc = this->ProcessQueue(&qcopy, epoll_.get());
+      } else {
+        rabit::utils::PollHelper poll;
+        rc = this->ProcessQueue(&qcopy, &poll);
+      }
 
       // Handle error
       if (!rc.OK()) {
@@ -267,8 +291,24 @@ void Loop::Submit(Op op) {
   queue_.push(op);
 }
 
-Loop::Loop(std::chrono::seconds timeout) : timeout_{timeout} {
+Loop::Loop(std::chrono::seconds timeout, LoopBackend backend,
+           std::chrono::microseconds busy_poll)
+    : timeout_{timeout} {
   timer_.Init(__func__);
+  bool use_epoll = backend == LoopBackend::kEpoll;
+#if defined(__linux__)
+  use_epoll |= backend == LoopBackend::kAuto;
+#endif  // defined(__linux__)
+  if (use_epoll) {
+    epoll_ = std::make_unique<EPollHelper>();
+    auto rc = epoll_->Init(busy_poll);
+    if (!rc.OK() && backend == LoopBackend::kAuto) {
+      LOG(WARNING) << "Failed to initialize epoll, fall back to poll. " << rc.Report();
+      epoll_.reset();
+    } else {
+      SafeColl(rc);
+    }
+  }
   worker_ = std::thread{[this] {
     this->Process();
   }};
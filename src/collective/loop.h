@@ -8,17 +8,34 @@
 #include <cstdint>             // for int8_t, int32_t
 #include <exception>           // for exception_ptr
 #include <future>              // for future
-#include <memory>              // for shared_ptr
+#include <memory>              // for shared_ptr, unique_ptr
 #include <mutex>               // for mutex
 #include <queue>               // for queue
+#include <string>              // for string
 #include <thread>              // for thread
 #include <vector>              // for vector
 
 #include "../common/timer.h"            // for Monitor
+#include "epoll.h"                      // for EPollHelper
 #include "xgboost/collective/result.h"  // for Result
 #include "xgboost/collective/socket.h"  // for TCPSocket
 
 namespace xgboost::collective {
+/**
+ * @brief Backend for waiting on sockets in the event loop.
+ */
+enum class LoopBackend : std::int8_t {
+  // epoll on Linux, poll otherwise.
+  kAuto = 0,
+  kPoll = 1,
+  kEpoll = 2,
+};
+
+/**
+ * @brief Get the backend from its name, one of `auto`, `poll`, and `epoll`.
+ */
+[[nodiscard]] LoopBackend ParseLoopBackend(std::string const& name);
+
 class Loop {
  public:
   struct Op {
@@ -63,8 +80,11 @@ class Loop {
   bool stop_{false};
   std::exception_ptr curr_exce_{nullptr};
   common::Monitor mutable timer_;
+  // Persistent interest set, null if the poll backend is used.
+  std::unique_ptr<EPollHelper> epoll_;
 
-  Result ProcessQueue(std::queue<Op>* p_queue) const;
+  template <typename Poller>
+  Result ProcessQueue(std::queue<Op>* p_queue, Poller* p_poll) const;
   // The cunsumer function that runs inside a worker thread.
   void Process();
 
@@ -82,7 +102,14 @@ class Loop {
    */
   [[nodiscard]] Result Block();
 
-  explicit Loop(std::chrono::seconds timeout);
+  /**
+   * @param timeout   Timeout for waiting on sockets.
+   * @param backend   Backend for waiting on sockets.
+   * @param busy_poll Duration of polling without blocking before waiting on sockets, only
+   *                  used by the epoll backend.
+   */
+  explicit Loop(std::chrono::seconds timeout, LoopBackend backend = LoopBackend::kAuto,
+                std::chrono::microseconds busy_poll = std::chrono::microseconds{0});
 
   ~Loop() noexcept(false) {
     // The worker will be joined in the stop function.
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include "shm.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>     // for O_CREAT, O_EXCL, O_RDWR
+#include <sys/mman.h>  // for shm_open, shm_unlink, mmap, munmap
+#include <unistd.h>    // for close, ftruncate, getpid
+#endif                 // defined(__unix__) || defined(__APPLE__)
+
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint64_t
+#include <string>   // for string, to_string
+#include <utility>  // for move
+
+#include "xgboost/collective/socket.h"  // for FailWithCode
+#include "xgboost/logging.h"            // for CHECK
+
+namespace xgboost::collective {
+std::string SharedMemory::MakeName(std::int32_t rank) {
+  static std::atomic<std::uint64_t> n_segments{0};
+  std::string name{"/xgboost"};
+#if defined(__unix__) || defined(__APPLE__)
+  name += "." + std::to_string(getpid());
+#endif  // defined(__unix__) || defined(__APPLE__)
+  name += "." + std::to_string(rank) + "." + std::to_string(n_segments++);
+  CHECK_LT(name.size(), MaxNameBytes());
+  return name;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+[[nodiscard]] Result SharedMemory::Map(std::int32_t fd, std::size_t n_bytes) {
+  auto ptr = mmap(nullptr, n_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (ptr == MAP_FAILED) {
+    auto rc = system::FailWithCode("Failed to map the shared memory: `" + name_ + "`.");
+    close(fd);
+    return rc;
+  }
+  ptr_ = reinterpret_cast<std::int8_t*>(ptr);
+  n_bytes_ = n_bytes;
+  if (close(fd) != 0) {
+    return system::FailWithCode("Failed to close the shared memory: `" + name_ + "`.");
+  }
+  return Success();
+}
+
+[[nodiscard]] Result SharedMemory::Create(std::string name, std::size_t n_bytes) {
+  CHECK(!ptr_) << "Shared memory is already mapped.";
+  name_ = std::move(name);
+  auto fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd == -1) {
+    return system::FailWithCode("Failed to create the shared memory: `" + name_ + "`.");
+  }
+  linked_ = true;
+  if (ftruncate(fd, static_cast<off_t>(n_bytes)) != 0) {
+    auto rc = system::FailWithCode("Failed to resize the shared memory: `" + name_ + "`.");
+    close(fd);
+    return rc;
+  }
+  return this->Map(fd, n_bytes);
+}
+
+[[nodiscard]] Result SharedMemory::Open(std::string name, std::size_t n_bytes) {
+  CHECK(!ptr_) << "Shared memory is already mapped.";
+  name_ = std::move(name);
+  auto fd = shm_open(name_.c_str(), O_RDWR, 0600);
+  if (fd == -1) {
+    return system::FailWithCode("Failed to open the shared memory: `" + name_ + "`.");
+  }
+  return this->Map(fd, n_bytes);
+}
+
+[[nodiscard]] Result SharedMemory::Unlink() {
+  if (!linked_) {
+    return Success();
+  }
+  linked_ = false;
+  if (shm_unlink(name_.c_str()) != 0) {
+    return system::FailWithCode("Failed to unlink the shared memory: `" + name_ + "`.");
+  }
+  return Success();
+}
+
+SharedMemory::~SharedMemory() noexcept(false) {
+  if (ptr_) {
+    CHECK_EQ(munmap(ptr_, n_bytes_), 0) << "Failed to unmap the shared memory: `" << name_ << "`.";
+  }
+  SafeColl(this->Unlink());
+}
+#else
+[[nodiscard]] Result SharedMemory::Map(std::int32_t, std::size_t) {
+  return Fail("Shared memory is not supported on this platform.");
+}
+
+[[nodiscard]] Result SharedMemory::Create(std::string, std::size_t) {
+  return Fail("Shared memory is not supported on this platform.");
+}
+
+[[nodiscard]] Result SharedMemory::Open(std::string, std::size_t) {
+  return Fail("Shared memory is not supported on this platform.");
+}
+
+[[nodiscard]] Result SharedMemory::Unlink() { return Success(); }
+
+SharedMemory::~SharedMemory() noexcept(false) = default;
+#endif  // defined(__unix__) || defined(__APPLE__)
+}  // namespace xgboost::collective
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#pragma once
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int8_t, int32_t
+#include <string>   // for string
+
+#include "xgboost/collective/result.h"  // for Result
+#include "xgboost/span.h"               // for Span
+
+namespace xgboost::collective {
+/**
+ * @brief A POSIX shared memory segment mapped into the current process.
+ *
+ *   One process creates the segment and the others open it by name. The creator should
+ *   unlink the segment once all processes have opened it, the memory is released after
+ *   the last mapping is gone. Not supported on Windows.
+ */
+class SharedMemory {
+  std::string name_;
+  std::int8_t* ptr_{nullptr};
+  std::size_t n_bytes_{0};
+  // Whether this is the creator and the name is not yet unlinked.
+  bool linked_{false};
+
+  [[nodiscard]] Result Map(std::int32_t fd, std::size_t n_bytes);
+
+ public:
+  // Maximum size of a generated name, including the terminating null.
+  static constexpr std::size_t MaxNameBytes() { return 64; }
+  /**
+   * @brief Generate a segment name unique to the current process.
+   */
+  [[nodiscard]] static std::string MakeName(std::int32_t rank);
+
+  SharedMemory() = default;
+  SharedMemory(SharedMemory const& that) = delete;
+  SharedMemory& operator=(SharedMemory const& that) = delete;
+  SharedMemory(SharedMemory&& that) = delete;
+  SharedMemory& operator=(SharedMemory&& that) = delete;
+  ~SharedMemory() noexcept(false);
+
+  /**
+   * @brief Create a new zero-initialized segment, fails if the name exists.
+   */
+  [[nodiscard]] Result Create(std::string name, std::size_t n_bytes);
+  /**
+   * @brief Open a segment created by another process.
+   */
+  [[nodiscard]] Result Open(std::string name, std::size_t n_bytes);
+  /**
+   * @brief Remove the name of the segment, existing mappings are still valid.
+   */
+  [[nodiscard]] Result Unlink();
+
+  [[nodiscard]] common::Span<std::int8_t> Data() const { return {ptr_, n_bytes_}; }
+  [[nodiscard]] std::string const& Name() const { return name_; }
+};
+}  // namespace xgboost::collective
@@ -0,0 +1,319 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include "shm_comm.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>  // for FUTEX_WAIT, FUTEX_WAKE
+#include <sys/syscall.h>  // for SYS_futex
+#include <unistd.h>       // for syscall
+#endif                    // defined(__linux__)
+
+#include <algorithm>     // for copy_n, min
+#include <atomic>        // for atomic
+#include <climits>       // for INT_MAX
+#include <cstring>       // for memcpy
+#include <ctime>         // for timespec
+#include <new>           // for placement new
+#include <system_error>  // for make_error_code, errc
+#include <thread>        // for yield, sleep_for
+#include <utility>       // for move
+
+#include "allgather.h"                  // for RingAllgather
+#include "xgboost/collective/socket.h"  // for GetHostName, HOST_NAME_MAX
+#include "xgboost/logging.h"            // for CHECK
+
+namespace xgboost::collective {
+namespace {
+// Notification for the owner of a segment, placed in its own cache line.
+struct alignas(64) Doorbell {
+  std::atomic<std::uint32_t> seq{0};
+  std::atomic<std::uint32_t> n_waiters{0};
+};
+// The futex operates on the 32-bit word of the atomic.
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+// Total number of bytes written into or read from a ring.
+struct alignas(64) Cursor {
+  std::atomic<std::uint64_t> pos{0};
+};
+
+// Layout of the segment: a doorbell for the owner, followed by a ring for each worker. A
+// ring has the write cursor, the read cursor and the data.
+std::size_t RingStride(std::size_t ring_bytes) { return 2 * sizeof(Cursor) + ring_bytes; }
+
+std::size_t SegmentBytes(std::int32_t world, std::size_t ring_bytes) {
+  return sizeof(Doorbell) + world * RingStride(ring_bytes);
+}
+
+Doorbell* Bell(SharedMemory const& shm) { return reinterpret_cast<Doorbell*>(shm.Data().data()); }
+
+struct Ring {
+  Cursor* head;
+  Cursor* tail;
+  std::int8_t* data;
+  std::size_t n_bytes;
+};
+
+Ring GetRing(SharedMemory const& shm, std::size_t ring_bytes, std::int32_t i) {
+  auto ptr = shm.Data().data() + sizeof(Doorbell) + i * RingStride(ring_bytes);
+  auto cursors = reinterpret_cast<Cursor*>(ptr);
+  return {cursors, cursors + 1, ptr + 2 * sizeof(Cursor), ring_bytes};
+}
+
+// Copy as much as possible into the ring, called only by the producer.
+std::size_t RingWrite(Ring const& ring, std::int8_t const* ptr, std::size_t n) {
+  auto head = ring.head->pos.load(std::memory_order_relaxed);
+  auto tail = ring.tail->pos.load(std::memory_order_acquire);
+  auto n_bytes = std::min(n, ring.n_bytes - static_cast<std::size_t>(head - tail));
+  auto off = head % ring.n_bytes;
+  auto n_first = std::min(n_bytes, ring.n_bytes - off);
+  std::memcpy(ring.data + off, ptr, n_first);
+  std::memcpy(ring.data, ptr + n_first, n_bytes - n_first);
+  ring.head->pos.store(head + n_bytes, std::memory_order_release);
+  return n_bytes;
+}
+
+// Copy as much as possible out of the ring, called only by the consumer.
+std::size_t RingRead(Ring const& ring, std::int8_t* ptr, std::size_t n) {
+  auto tail = ring.tail->pos.load(std::memory_order_relaxed);
+  auto head = ring.head->pos.load(std::memory_order_acquire);
+  auto n_bytes = std::min(n, static_cast<std::size_t>(head - tail));
+  auto off = tail % ring.n_bytes;
+  auto n_first = std::min(n_bytes, ring.n_bytes - off);
+  std::memcpy(ptr, ring.data + off, n_first);
+  std::memcpy(ptr + n_first, ring.data, n_bytes - n_first);
+  ring.tail->pos.store(tail + n_bytes, std::memory_order_release);
+  return n_bytes;
+}
+
+#if defined(__linux__)
+void FutexWait(std::atomic<std::uint32_t>* addr, std::uint32_t expected,
+               std::chrono::milliseconds timeout) {
+  timespec ts{};
+  ts.tv_sec = static_cast<decltype(ts.tv_sec)>(timeout.count() / 1000);
+  ts.tv_nsec = static_cast<decltype(ts.tv_nsec)>(timeout.count() % 1000 * 1000000);
+  // Spurious wake-ups and interrupts are handled by the caller. The segment is shared
+  // between processes, hence no FUTEX_PRIVATE_FLAG.
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr), FUTEX_WAIT, expected, &ts, nullptr,
+          0);
+}
+
+void FutexWake(std::atomic<std::uint32_t>* addr) {
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr), FUTEX_WAKE, INT_MAX, nullptr,
+          nullptr, 0);
+}
+#else
+void FutexWait(std::atomic<std::uint32_t>*, std::uint32_t, std::chrono::milliseconds) {
+  std::this_thread::sleep_for(std::chrono::microseconds{50});
+}
+
+void FutexWake(std::atomic<std::uint32_t>*) {}
+#endif  // defined(__linux__)
+
+void Notify(Doorbell* bell) {
+  bell->seq.fetch_add(1);
+  // Skip the system call if the owner is not sleeping. A waiter registers itself before
+  // checking the sequence number, so either it sees the new value or we see the waiter.
+  if (bell->n_waiters.load() > 0) {
+    FutexWake(&bell->seq);
+  }
+}
+
+void Wait(Doorbell* bell, std::uint32_t seq, std::chrono::milliseconds timeout) {
+  bell->n_waiters.fetch_add(1);
+  FutexWait(&bell->seq, seq, timeout);
+  bell->n_waiters.fetch_sub(1);
+}
+}  // namespace
+
+/**
+ * @brief Queue operations in the communicator, they are progressed when blocking.
+ */
+class ShmChannel : public Channel {
+  ShmComm const& comm_;
+  std::int32_t peer_;
+
+ public:
+  ShmChannel(ShmComm const& comm, std::int32_t peer)
+      : Channel{comm, nullptr}, comm_{comm}, peer_{peer} {}
+
+  [[nodiscard]] Result SendAll(std::int8_t const* ptr, std::size_t n) override {
+    CHECK_NE(peer_, comm_.Rank());
+    CHECK_NE(n, 0);
+    comm_.sends_[peer_].push({const_cast<std::int8_t*>(ptr), n, 0});
+    return Success();
+  }
+  [[nodiscard]] Result RecvAll(std::int8_t* ptr, std::size_t n) override {
+    CHECK_NE(peer_, comm_.Rank());
+    CHECK_NE(n, 0);
+    comm_.recvs_[peer_].push({ptr, n, 0});
+    return Success();
+  }
+};
+
+ShmComm::ShmComm(std::string const& tracker_host, std::int32_t tracker_port,
+                 std::chrono::seconds timeout, std::int32_t retry, std::string task_id,
+                 StringView nccl_path, std::size_t ring_bytes)
+    : RabitComm{tracker_host, tracker_port, timeout, retry, std::move(task_id), nccl_path},
+      ring_bytes_{ring_bytes} {
+  CHECK_GT(ring_bytes_, 0);
+  // Keep the cursors aligned.
+  CHECK_EQ(ring_bytes_ % sizeof(Cursor), 0);
+  if (!this->IsDistributed()) {
+    return;
+  }
+  auto rc = this->InitSharedMemory();
+  if (!rc.OK()) {
+    this->ResetState();
+    SafeColl(Fail("Failed to initialize the shared memory communicator.", std::move(rc)));
+  }
+}
+
+[[nodiscard]] Result ShmComm::InitSharedMemory() {
+  auto world = this->World();
+  auto rank = this->Rank();
+
+  // All workers must be on the same host.
+  std::string host;
+  auto rc = GetHostName(&host);
+  if (!rc.OK()) {
+    return rc;
+  }
+  if (host.size() >= HOST_NAME_MAX) {
+    return Fail("Got an invalid host name.");
+  }
+  std::vector<std::int8_t> hosts(HOST_NAME_MAX * world, 0);
+  std::copy_n(host.cbegin(), host.size(), hosts.begin() + HOST_NAME_MAX * rank);
+  rc = RingAllgather(*this, common::Span{hosts.data(), hosts.size()});
+  if (!rc.OK()) {
+    return Fail("Failed to get host names from peers.", std::move(rc));
+  }
+  for (std::int32_t r = 0; r < world; ++r) {
+    auto name = reinterpret_cast<char const*>(hosts.data() + HOST_NAME_MAX * r);
+    if (host != name) {
+      return Fail("All workers must run on the same host for the shared memory communicator, "
+                  "got `" + host + "` and `" + name + "`.");
+    }
+  }
+
+  // Create the rings for receiving from peers and exchange the segment names.
+  auto n_bytes = SegmentBytes(world, ring_bytes_);
+  auto name_bytes = SharedMemory::MaxNameBytes();
+  std::vector<std::int8_t> names(name_bytes * world, 0);
+  self_ = std::make_unique<SharedMemory>();
+  rc = Success() << [&] {
+    return self_->Create(SharedMemory::MakeName(rank), n_bytes);
+  } << [&] {
+    new (Bell(*self_)) Doorbell{};
+    for (std::int32_t r = 0; r < world; ++r) {
+      auto ring = GetRing(*self_, ring_bytes_, r);
+      new (ring.head) Cursor{};
+      new (ring.tail) Cursor{};
+    }
+    std::copy_n(self_->Name().cbegin(), self_->Name().size(),
+                names.begin() + name_bytes * rank);
+    return RingAllgather(*this, common::Span{names.data(), names.size()});
+  } << [&] {
+    peers_.resize(world);
+    for (std::int32_t r = 0; r < world; ++r) {
+      if (r == rank) {
+        continue;
+      }
+      peers_[r] = std::make_unique<SharedMemory>();
+      auto name = reinterpret_cast<char const*>(names.data() + name_bytes * r);
+      auto rc = peers_[r]->Open(name, n_bytes);
+      if (!rc.OK()) {
+        return rc;
+      }
+    }
+    // Peers contribute to this allgather only after opening all segments, the names can be
+    // removed once it finishes.
+    std::vector<std::int8_t> ack(world, 0);
+    return RingAllgather(*this, common::Span{ack.data(), ack.size()});
+  } << [&] {
+    return self_->Unlink();
+  };
+  if (!rc.OK()) {
+    return Fail("Failed to set up the shared memory.", std::move(rc));
+  }
+
+  sends_.resize(world);
+  recvs_.resize(world);
+  for (std::int32_t r = 0; r < world; ++r) {
+    this->channels_.at(r) = std::make_shared<ShmChannel>(*this, r);
+  }
+  ready_ = true;
+  return Success();
+}
+
+bool ShmComm::Progress(std::int32_t peer) const {
+  std::size_t n_bytes = 0;
+  auto drain = [&](std::queue<Pending>* p_ops, auto&& fn) {
+    auto& ops = *p_ops;
+    while (!ops.empty()) {
+      auto& op = ops.front();
+      auto n = fn(op.ptr + op.off, op.n - op.off);
+      op.off += n;
+      n_bytes += n;
+      if (op.off != op.n) {
+        break;
+      }
+      ops.pop();
+    }
+  };
+  if (!sends_[peer].empty()) {
+    auto ring = GetRing(*peers_[peer], ring_bytes_, this->Rank());
+    drain(&sends_[peer], [&](std::int8_t* ptr, std::size_t n) { return RingWrite(ring, ptr, n); });
+  }
+  if (!recvs_[peer].empty()) {
+    auto ring = GetRing(*self_, ring_bytes_, peer);
+    drain(&recvs_[peer], [&](std::int8_t* ptr, std::size_t n) { return RingRead(ring, ptr, n); });
+  }
+  if (n_bytes == 0) {
+    return false;
+  }
+  // The peer might be waiting for either data or space.
+  Notify(Bell(*peers_[peer]));
+  return true;
+}
+
+[[nodiscard]] Result ShmComm::Block() const {
+  if (!ready_) {
+    return RabitComm::Block();
+  }
+  constexpr std::size_t kMaxSpins = 1024;
+  auto* bell = Bell(*self_);
+  auto last = std::chrono::steady_clock::now();
+  std::size_t n_spins = 0;
+  while (true) {
+    // Read the sequence before checking the rings to avoid missing a notification.
+    auto seq = bell->seq.load();
+    bool progress = false;
+    bool pending = false;
+    for (std::int32_t r = 0; r < this->World(); ++r) {
+      progress |= this->Progress(r);
+      pending |= !sends_[r].empty() || !recvs_[r].empty();
+    }
+    if (!pending) {
+      return Success();
+    }
+    if (progress) {
+      n_spins = 0;
+      last = std::chrono::steady_clock::now();
+      continue;
+    }
+    if (n_spins < kMaxSpins) {
+      ++n_spins;
+      std::this_thread::yield();
+      continue;
+    }
+    if (timeout_.count() > 0 && std::chrono::steady_clock::now() - last > timeout_) {
+      return Fail("Timeout waiting for peers through shared memory.",
+                  std::make_error_code(std::errc::timed_out));
+    }
+    Wait(bell, seq, std::chrono::milliseconds{100});
+  }
+}
+}  // namespace xgboost::collective
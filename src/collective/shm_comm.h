@@ -0,0 +1,73 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#pragma once
+#include <chrono>   // for seconds
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int8_t, int32_t
+#include <memory>   // for unique_ptr
+#include <queue>    // for queue
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "comm.h"                       // for RabitComm
+#include "shm.h"                        // for SharedMemory
+#include "xgboost/collective/result.h"  // for Result
+#include "xgboost/string_view.h"        // for StringView
+
+namespace xgboost::collective {
+class ShmChannel;
+
+/**
+ * @brief Communicator for worker processes running on the same host.
+ *
+ *   Workers are bootstrapped by the RABIT tracker in the same way as the @ref RabitComm,
+ *   after which each pair of workers communicates through a single-producer
+ *   single-consumer ring buffer in POSIX shared memory. Each worker owns a segment holding
+ *   the rings for receiving from all other workers. A worker waiting for its peers sleeps
+ *   on a futex in its own segment, peers wake it up after writing into or reading from a
+ *   ring shared with it.
+ *
+ *   Sends and receives are queued by the channels and progressed by @ref Block in the
+ *   calling thread. The TCP connections are only used for bootstrapping and error
+ *   handling. Not supported on Windows.
+ */
+class ShmComm : public RabitComm {
+ public:
+  static constexpr std::size_t DefaultRingBytes() { return 1024 * 1024; }
+
+ private:
+  struct Pending {
+    std::int8_t* ptr;
+    std::size_t n;
+    std::size_t off;
+  };
+
+  std::size_t ring_bytes_;
+  // Rings for receiving from peers.
+  std::unique_ptr<SharedMemory> self_;
+  // Segments owned by peers, holding the rings for sending to them.
+  std::vector<std::unique_ptr<SharedMemory>> peers_;
+  // Whether the shared memory is ready, TCP channels are used before that.
+  bool ready_{false};
+  // Pending operations for each peer, in the order of submission.
+  mutable std::vector<std::queue<Pending>> sends_;
+  mutable std::vector<std::queue<Pending>> recvs_;
+
+  [[nodiscard]] Result InitSharedMemory();
+  // Returns whether any data is transferred.
+  bool Progress(std::int32_t peer) const;
+
+  friend class ShmChannel;
+
+ public:
+  /**
+   * @param ring_bytes Capacity of the ring buffer for each pair of workers.
+   */
+  ShmComm(std::string const& tracker_host, std::int32_t tracker_port,
+          std::chrono::seconds timeout, std::int32_t retry, std::string task_id,
+          StringView nccl_path, std::size_t ring_bytes = DefaultRingBytes());
+
+  [[nodiscard]] Result Block() const override;
+};
+}  // namespace xgboost::collective
@@ -117,6 +117,11 @@ RabitTracker::RabitTracker(Json const& config) : Tracker{config} {
   auto rc = Success() << [&] {
     host_.clear();
     host_ = OptionalArg<String>(config, "host", std::string{});
+    n_streams_ = static_cast<std::int32_t>(
+        OptionalArg<Integer const>(config, "n_streams", Integer::Int{1}));
+    if (n_streams_ < 1) {
+      return Fail("Invalid number of streams: " + std::to_string(n_streams_));
+    }
     if (host_.empty()) {
       return collective::GetHostAddress(&host_);
     }
@@ -142,9 +147,10 @@ Result RabitTracker::Bootstrap(std::vector<WorkerProxy>* p_workers) {
     auto& worker = workers[r];
     auto next = BootstrapNext(r, n_workers_);
     auto const& next_w = workers[next];
-    bootstrap_threads.emplace_back([next, &worker, &next_w, init = InitNewThread{}] {
+    bootstrap_threads.emplace_back([this, next, &worker, &next_w, init = InitNewThread{}] {
       init();
       auto jnext = proto::PeerInfo{next_w.Host(), next_w.Port(), next}.ToJson();
+      jnext["n_streams"] = Integer{this->n_streams_};
       std::string str;
       Json::Dump(jnext, &str);
       worker.Send(StringView{str});
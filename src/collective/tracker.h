@@ -130,6 +130,8 @@ class RabitTracker : public Tracker {
 
  private:
   std::string host_;
+  // number of connections between each pair of workers, sent to workers during bootstrap.
+  std::int32_t n_streams_{1};
   // record for how to reach out to workers if error happens.
   std::vector<std::pair<std::string, std::int32_t>> worker_error_handles_;
   // listening socket for incoming workers.
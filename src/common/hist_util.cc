@@ -6,11 +6,13 @@
 
 #include <dmlc/timer.h>
 
+#include <algorithm>  // for copy, transform
 #include <vector>
 
 #include "../data/adapter.h"         // for SparsePageAdapterBatch
 #include "../data/gradient_index.h"  // for GHistIndexMatrix
 #include "io.h"                      // for AlignedResourceReadStream, AlignedFileWriteStream
+#include "json_utils.h"              // for LoadVector
 #include "quantile.h"
 #include "xgboost/base.h"
 #include "xgboost/context.h"  // for Context
@@ -51,6 +53,50 @@ void HistogramCuts::Save(common::AlignedFileWriteStream *fo) const {
   return p_cuts;
 }
 
+void HistogramCuts::Save(Json *p_out) const {
+  auto &out = *p_out;
+  out = Object{};
+
+  auto const &h_ptrs = this->Ptrs();
+  U32Array ptrs{h_ptrs.size()};
+  std::copy(h_ptrs.cbegin(), h_ptrs.cend(), ptrs.GetArray().begin());
+  out["cut_ptrs"] = std::move(ptrs);
+
+  out["cut_values"] = F32Array{};
+  SaveVector(this->Values(), &out["cut_values"]);
+  out["min_vals"] = F32Array{};
+  SaveVector(this->MinValues(), &out["min_vals"]);
+
+  out["has_categorical"] = Boolean{this->has_categorical_};
+  out["max_cat"] = Number{this->max_cat_};
+}
+
+[[nodiscard]] HistogramCuts *HistogramCuts::Load(Json const &in) {
+  auto p_cuts = new HistogramCuts;
+
+  auto const &jptrs = in["cut_ptrs"];
+  auto &h_ptrs = p_cuts->cut_ptrs_.HostVector();
+  if (IsA<U32Array>(jptrs)) {
+    auto const &ptrs = get<U32Array const>(jptrs);
+    h_ptrs.assign(ptrs.cbegin(), ptrs.cend());
+  } else {
+    // Text JSON
+    auto const &ptrs = get<Array const>(jptrs);
+    h_ptrs.resize(ptrs.size());
+    std::transform(ptrs.cbegin(), ptrs.cend(), h_ptrs.begin(),
+                   [](Json const &v) { return get<Integer const>(v); });
+  }
+  LoadVector(in["cut_values"], &p_cuts->cut_values_.HostVector());
+  LoadVector(in["min_vals"], &p_cuts->min_vals_.HostVector());
+
+  p_cuts->has_categorical_ = get<Boolean const>(in["has_categorical"]);
+  p_cuts->max_cat_ = get<Number const>(in["max_cat"]);
+
+  CHECK_EQ(h_ptrs.back(), p_cuts->cut_values_.Size()) << "Invalid histogram cuts.";
+  CHECK_EQ(h_ptrs.size() - 1, p_cuts->min_vals_.Size()) << "Invalid histogram cuts.";
+  return p_cuts;
+}
+
 HistogramCuts SketchOnDMatrix(Context const *ctx, DMatrix *m, bst_bin_t max_bins, bool use_sorted,
                               Span<float const> hessian) {
   HistogramCuts out;
@@ -67,13 +113,19 @@ HistogramCuts SketchOnDMatrix(Context const *ctx, DMatrix *m, bst_bin_t max_bins
     }
   }
 
-  if (!use_sorted) {
-    HostSketchContainer container(ctx, max_bins, m->Info().feature_types.ConstHostSpan(), reduced,
-                                  HostSketchContainer::UseGroup(info));
+  auto push_row_pages = [&](auto &&container) {
     for (auto const &page : m->GetBatches<SparsePage>()) {
       container.PushRowPage(page, info, hessian);
     }
     container.MakeCuts(ctx, m->Info(), &out);
+  };
+
+  if (!use_sorted && UseSortSketch()) {
+    push_row_pages(SortSketchContainer{ctx, max_bins, m->Info().feature_types.ConstHostSpan(),
+                                       reduced, HostSketchContainer::UseGroup(info)});
+  } else if (!use_sorted) {
+    push_row_pages(HostSketchContainer{ctx, max_bins, m->Info().feature_types.ConstHostSpan(),
+                                       reduced, HostSketchContainer::UseGroup(info)});
   } else {
     SortedSketchContainer container{ctx,
                                     max_bins,
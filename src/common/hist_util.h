@@ -22,6 +22,7 @@
 
 namespace xgboost {
 class GHistIndexMatrix;
+class Json;
 
 namespace common {
 class AlignedFileWriteStream;
@@ -181,6 +182,11 @@ class HistogramCuts {
 
   void Save(common::AlignedFileWriteStream* fo) const;
   [[nodiscard]] static HistogramCuts* Load(common::AlignedResourceReadStream* fi);
+  /**
+   * @brief Save the cuts as part of a (UB)JSON model.
+   */
+  void Save(Json* p_out) const;
+  [[nodiscard]] static HistogramCuts* Load(Json const& in);
 };
 
 /**
@@ -6,7 +6,7 @@
 
 #include <fcntl.h>     // for open, O_RDONLY, posix_fadvise
 #include <sys/mman.h>  // for mmap, munmap, madvise
-#include <unistd.h>    // for close, getpagesize
+#include <unistd.h>    // for close, getpagesize, pread
 
 #else
 
@@ -22,6 +22,7 @@
 
 #include <algorithm>     // for copy, transform
 #include <cctype>        // for tolower
+#include <cerrno>        // for errno, EINTR
 #include <cstddef>       // for size_t
 #include <cstdint>       // for int32_t, uint32_t
 #include <cstdio>        // for fread, fseek
@@ -369,6 +370,44 @@ std::shared_ptr<MallocResource> MemBufFileReadStream::ReadFileIntoBuffer(StringV
   return res;
 }
 
+std::shared_ptr<MallocResource> PreadFileReadStream::ReadFileIntoBuffer(StringView path,
+                                                                        std::size_t offset,
+                                                                        std::size_t length) {
+#if defined(__unix__) || defined(__APPLE__)
+  CHECK(std::filesystem::exists(path.c_str())) << "`" << path << "` doesn't exist";
+  auto res = std::make_shared<MallocResource>(length);
+  auto ptr = res->DataAs<char>();
+
+  std::unique_ptr<FILE, std::function<int(FILE*)>> fp{fopen(path.c_str(), "rb"), fclose};
+  CHECK(fp) << "Failed to open:" << path << ". " << error::SystemError().message();
+  auto fd = fileno(fp.get());
+  CHECK_GE(fd, 0) << error::SystemError().message();
+#if defined(__linux__)
+  // Let the kernel read ahead aggressively, we are going to consume the entire range.
+  if (posix_fadvise(fd, offset, length, POSIX_FADV_SEQUENTIAL) != 0) {
+    LOG(FATAL) << error::SystemError().message();
+  }
+#endif  // defined(__linux__)
+
+  std::size_t n_read = 0;
+  while (n_read < length) {
+    auto n = std::min(length - n_read, kChunkBytes);
+    auto ret = pread(fd, ptr + n_read, n, static_cast<off_t>(offset + n_read));
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    CHECK_GT(ret, 0) << "Failed to read file `" << path << "`. "
+                     << (ret < 0 ? error::SystemError().message() : "Unexpected end of file.");
+    n_read += ret;
+  }
+  return res;
+#else
+  // No pread on Windows, fallback to the stdio implementation.
+  MemBufFileReadStream fi{path, offset, length};
+  return std::dynamic_pointer_cast<MallocResource>(fi.Share());
+#endif  // defined(__unix__) || defined(__APPLE__)
+}
+
 AlignedFileWriteStream::AlignedFileWriteStream(StringView path, StringView flags)
     : pimpl_{dmlc::Stream::Create(path.c_str(), flags.c_str())} {}
 
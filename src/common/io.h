@@ -539,6 +539,31 @@ class MemBufFileReadStream : public AlignedResourceReadStream {
       : AlignedResourceReadStream{ReadFileIntoBuffer(path, offset, length)} {}
 };
 
+/**
+ * @brief Read a portion of a file into a memory buffer with large `pread` calls.
+ *
+ *   Unlike the mmap stream, the data is loaded eagerly in large chunks instead of being
+ *   faulted in one page at a time when it's accessed. This is suitable for prefetching
+ *   external memory pages in background threads.
+ */
+class PreadFileReadStream : public AlignedResourceReadStream {
+  static std::shared_ptr<MallocResource> ReadFileIntoBuffer(StringView path, std::size_t offset,
+                                                            std::size_t length);
+
+ public:
+  // Maximum number of bytes for each read call.
+  static std::size_t constexpr kChunkBytes = static_cast<std::size_t>(1) << 24;
+  /**
+   * @brief Construct a stream for reading file.
+   *
+   * @param path      File path.
+   * @param offset    The number of bytes into the file.
+   * @param length    The number of bytes to read.
+   */
+  explicit PreadFileReadStream(StringView path, std::size_t offset, std::size_t length)
+      : AlignedResourceReadStream{ReadFileIntoBuffer(path, offset, length)} {}
+};
+
 /**
  * @brief Base class for write stream with alignment defined by IOAlignment().
  */
@@ -360,6 +360,15 @@ class PartitionBuilder {
     std::copy_n(right, mem_blocks_[task_idx]->n_right, right_result);
   }
 
+  // Get the rows assigned to the left and the right child by a partition task. The result
+  // is valid until the next call to `Init`.
+  [[nodiscard]] std::pair<Span<bst_idx_t const>, Span<bst_idx_t const>> GetTaskRows(
+      bst_node_t nid, std::size_t begin) const {
+    std::size_t task_idx = blocks_offsets_[nid] + begin / BlockSize;
+    auto const& block = mem_blocks_[task_idx];
+    return {{block->Left(), block->n_left}, {block->Right(), block->n_right}};
+  }
+
   size_t GetTaskIdx(int nid, size_t begin) {
     return blocks_offsets_[nid] + begin / BlockSize;
   }
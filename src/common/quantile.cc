@@ -3,11 +3,17 @@
  */
 #include "quantile.h"
 
+#include <xgboost/global_config.h>  // for GlobalConfigThreadLocalStore
+
+#include <array>    // for array
+#include <cstdint>  // for uint32_t
 #include <limits>
 #include <numeric>  // for partial_sum
 #include <utility>
 
 #include "../collective/aggregator.h"
+#include "../collective/allreduce.h"   // for Allreduce
+#include "../collective/comm_group.h"  // for GlobalCommGroup
 #include "../common/error_msg.h"  // for InvalidMaxBin
 #include "../data/adapter.h"
 #include "categorical.h"
@@ -339,6 +345,12 @@ void SketchContainerImpl<WQSketch>::AllReduce(
     return;
   }
 
+  if (!collective::IsFederated() && !this->gather_merge_) {
+    this->ScatterMergeSketches(ctx, num_cuts, global_column_size, p_reduced);
+    monitor_.Stop(__func__);
+    return;
+  }
+
   std::vector<bst_idx_t> worker_segments(1, 0);  // CSC pointer to sketches.
   std::vector<bst_idx_t> sketches_scan((n_columns + 1) * world, 0);
 
@@ -372,6 +384,96 @@ void SketchContainerImpl<WQSketch>::AllReduce(
   monitor_.Stop(__func__);
 }
 
+template <typename WQSketch>
+void SketchContainerImpl<WQSketch>::ScatterMergeSketches(
+    Context const *ctx, std::vector<std::int32_t> const &num_cuts,
+    std::vector<bst_idx_t> const &global_column_size,
+    std::vector<typename WQSketch::SummaryContainer> *p_reduced) {
+  using Entry = typename WQSketch::Entry;
+  using Summary = typename WQSketch::Summary;
+  static_assert(sizeof(Entry) % sizeof(float) == 0, "Unexpected size of sketch entry.");
+  // Each slot is a header of [size, limit] followed by the entries.
+  constexpr std::size_t kHeader = 2, kEntrySize = sizeof(Entry) / sizeof(float);
+
+  auto &reduced = *p_reduced;
+  auto world = collective::GetWorldSize();
+  // Pruning a partial merge of k workers to n entries has a rank error of about k/world/n of
+  // the total weight. Summing over the ring steps gives (world + 1)/2/n, the limit of the
+  // intermediate prunes is scaled by (world + 1)/2 to match a single prune to `num_cuts`.
+  auto ring_limit = [&](bst_feature_t fidx) {
+    auto limit = static_cast<bst_idx_t>(num_cuts[fidx]) * (world + 1) / 2;
+    return static_cast<std::size_t>(std::min(limit, global_column_size[fidx]));
+  };
+  std::vector<bst_feature_t> numeric;
+  std::size_t capacity = 0;
+  for (bst_feature_t fidx = 0; fidx < reduced.size(); ++fidx) {
+    if (!IsCat(feature_types_, fidx)) {
+      numeric.push_back(fidx);
+      // The limit is calculated from the global column size, it's the same for all workers.
+      capacity = std::max(capacity, ring_limit(fidx));
+    }
+  }
+  if (numeric.empty() || capacity == 0) {
+    return;
+  }
+  CHECK_LT(capacity, static_cast<std::size_t>(1) << 24) << "Too many intermediate cuts.";
+
+  // Pad the number of slots such that the ring segments are aligned with slots.
+  auto slot_size = kHeader + capacity * kEntrySize;
+  auto n_slots = DivRoundUp(numeric.size(), static_cast<std::size_t>(world)) * world;
+  std::vector<float> slots(n_slots * slot_size, 0.0f);
+  auto get_entries = [&](common::Span<float> slot) {
+    return reinterpret_cast<Entry *>(slot.data() + kHeader);
+  };
+  ParallelFor(numeric.size(), n_threads_, [&](auto i) {
+    auto fidx = numeric[i];
+    auto slot = Span{slots}.subspan(i * slot_size, slot_size);
+    auto const &sketch = reduced[fidx];
+    slot[0] = static_cast<float>(sketch.size);
+    slot[1] = static_cast<float>(ring_limit(fidx));
+    std::copy_n(sketch.data, sketch.size, get_entries(slot));
+  });
+
+  // Merge the received summaries into the local ones. With the ring
+  // reduce-scatter, each worker merges only a slice of the features, the merged slices
+  // are then distributed by the allgather.
+  std::vector<typename WQSketch::SummaryContainer> temp(n_threads_);
+  auto merge = [&](common::Span<float const> lhs, common::Span<float> out) {
+    CHECK_EQ(lhs.size() % slot_size, 0);
+    auto n = lhs.size() / slot_size;
+    ParallelFor(n, n_threads_, [&](auto i) {
+      auto l_slot = lhs.subspan(i * slot_size, slot_size);
+      auto o_slot = out.subspan(i * slot_size, slot_size);
+      auto l_size = static_cast<std::size_t>(l_slot[0]);
+      if (l_size == 0) {
+        return;
+      }
+      auto o_size = static_cast<std::size_t>(o_slot[0]);
+      auto limit = static_cast<std::size_t>(o_slot[1]);
+      Summary l_summary{const_cast<Entry *>(reinterpret_cast<Entry const *>(l_slot.data() +
+                                                                            kHeader)),
+                        l_size};
+      Summary o_summary{get_entries(o_slot), o_size};
+      auto &combined = temp[omp_get_thread_num()];
+      combined.Reserve(l_size + o_size);
+      combined.SetCombine(l_summary, o_summary);
+      o_summary.SetPrune(combined, limit);
+      o_slot[0] = static_cast<float>(o_summary.size);
+    });
+  };
+  auto const &comm = collective::GlobalCommGroup()->Ctx(ctx, DeviceOrd::CPU());
+  auto rc = collective::Allreduce(comm, Span{slots}, merge);
+  collective::SafeColl(rc);
+
+  ParallelFor(numeric.size(), n_threads_, [&](auto i) {
+    auto fidx = numeric[i];
+    auto slot = Span{slots}.subspan(i * slot_size, slot_size);
+    auto size = static_cast<std::size_t>(slot[0]);
+    reduced[fidx].Reserve(num_cuts[fidx]);
+    reduced[fidx].SetPrune(Summary{get_entries(slot), size}, num_cuts[fidx]);
+  });
+}
+
 template <typename SketchType>
 void AddCutPoint(typename SketchType::SummaryContainer const &summary, int max_bin,
                  HistogramCuts *cuts) {
@@ -516,4 +618,246 @@ void SortedSketchContainer::PushColPage(SparsePage const &page, MetaInfo const &
   });
   monitor_.Stop(__func__);
 }
+
+namespace detail {
+namespace {
+// Map the float to an unsigned integer with the same ordering.
+std::uint32_t SortKey(float v) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &v, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+}  // anonymous namespace
+
+void RadixSort(Span<SketchQEntry> entries, std::vector<SketchQEntry> *p_scratch) {
+  constexpr std::size_t kSmall = 64;
+  auto n = entries.size();
+  if (n <= kSmall) {
+    std::sort(entries.begin(), entries.end());
+    return;
+  }
+
+  constexpr std::uint32_t kBits = 8, kBuckets = 1u << kBits, kPasses = 32 / kBits;
+  // Histograms for all passes are built in a single scan.
+  std::array<std::array<std::size_t, kBuckets>, kPasses> hist{};
+  for (auto const &e : entries) {
+    auto key = SortKey(e.value);
+    for (std::uint32_t p = 0; p < kPasses; ++p) {
+      ++hist[p][(key >> (p * kBits)) & (kBuckets - 1)];
+    }
+  }
+
+  auto &scratch = *p_scratch;
+  scratch.resize(n);
+  auto *src = entries.data();
+  auto *dst = scratch.data();
+  for (std::uint32_t p = 0; p < kPasses; ++p) {
+    auto shift = p * kBits;
+    auto &h = hist[p];
+    // Skip the pass if all keys share the same digit.
+    if (h[(SortKey(src[0].value) >> shift) & (kBuckets - 1)] == n) {
+      continue;
+    }
+    std::size_t sum = 0;
+    for (auto &v : h) {
+      auto cnt = v;
+      v = sum;
+      sum += cnt;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      auto d = (SortKey(src[i].value) >> shift) & (kBuckets - 1);
+      dst[h[d]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != entries.data()) {
+    std::copy_n(src, n, entries.data());
+  }
+}
+}  // namespace detail
+
+bool UseSortSketch() {
+  auto const &method = GlobalConfigThreadLocalStore::Get()->sketch_method;
+  CHECK(method == "wq" || method == "sort")
+      << "Invalid `sketch_method`: " << method << ". Valid values are `wq` and `sort`.";
+  return method == "sort";
+}
+
+SortSketchContainer::SortSketchContainer(Context const *ctx, bst_bin_t max_bins,
+                                         common::Span<FeatureType const> ft,
+                                         std::vector<bst_idx_t> columns_size, bool use_group)
+    : HostSketchContainer{ctx, max_bins, ft, std::move(columns_size), use_group},
+      scratch_(n_threads_) {
+  monitor_.Init(__func__);
+}
+
+void SortSketchContainer::Flush(bst_feature_t fidx) {
+  auto &sketch = sketches_[fidx];
+  auto &queue = sketch.inqueue;
+  if (queue.qtail == 0) {
+    return;
+  }
+  auto entries = Span{queue.queue.data(), queue.qtail};
+  detail::RadixSort(entries, &scratch_[omp_get_thread_num()]);
+
+  // Construct the summary from the sorted queue, duplicated values are merged.
+  auto &out = sketch.temp;
+  out.Reserve(queue.qtail);
+  out.size = 0;
+  float wsum = 0;
+  for (std::size_t i = 0; i < queue.qtail;) {
+    std::size_t j = i + 1;
+    float w = entries[i].weight;
+    while (j < queue.qtail && entries[j].value == entries[i].value) {
+      w += entries[j].weight;
+      ++j;
+    }
+    out.data[out.size++] = WQSketch::Entry{wsum, wsum + w, w, entries[i].value};
+    wsum += w;
+    i = j;
+  }
+  queue.qtail = 0;
+  sketch.PushTemp();
+}
+
+template <typename Batch, typename IsValid>
+void SortSketchContainer::PushBatchImpl(Batch const &batch, std::size_t base_rowid,
+                                        OptionalWeights weights, IsValid is_valid) {
+  monitor_.Start(__func__);
+  auto n_features = static_cast<bst_feature_t>(sketches_.size());
+  auto n_threads = static_cast<std::size_t>(n_threads_);
+  // Rows are transposed in chunks to bound the size of the column buffer.
+  auto n_rows_per_chunk =
+      std::max(kBufferEntries / std::max(n_features, static_cast<bst_feature_t>(1)),
+               static_cast<std::size_t>(1));
+  thread_cnt_.resize(n_threads * n_features);
+  buffer_ptr_.resize(n_features + 1);
+
+  auto is_valid_elem = [&](auto const &elem, float w) {
+    return is_valid(elem) && elem.column_idx < n_features && w != 0.0f;
+  };
+
+  for (std::size_t chunk_beg = 0; chunk_beg < batch.Size(); chunk_beg += n_rows_per_chunk) {
+    auto chunk_end = std::min(chunk_beg + n_rows_per_chunk, batch.Size());
+    auto n_rows_per_thread = DivRoundUp(chunk_end - chunk_beg, n_threads);
+    auto for_each_elem = [&](std::size_t tid, auto &&fn) {
+      auto beg = chunk_beg + tid * n_rows_per_thread;
+      auto end = std::min(beg + n_rows_per_thread, chunk_end);
+      for (auto ridx = beg; ridx < end; ++ridx) {
+        auto const &line = batch.GetLine(ridx);
+        auto w = weights[ridx + base_rowid];
+        for (std::size_t k = 0; k < line.Size(); ++k) {
+          auto const &elem = line.GetElement(k);
+          if (is_valid_elem(elem, w)) {
+            fn(elem, w);
+          }
+        }
+      }
+    };
+
+    // Count the entries of each column for each thread.
+    std::fill(thread_cnt_.begin(), thread_cnt_.end(), 0);
+    ParallelFor(n_threads, n_threads_, [&](auto tid) {
+      auto cnt = thread_cnt_.data() + tid * n_features;
+      for_each_elem(tid, [&](auto const &elem, float) { ++cnt[elem.column_idx]; });
+    });
+    // Column-major offsets, threads write to disjoint ranges inside each column.
+    bst_idx_t n_entries = 0;
+    for (bst_feature_t fidx = 0; fidx < n_features; ++fidx) {
+      buffer_ptr_[fidx] = n_entries;
+      for (std::size_t tid = 0; tid < n_threads; ++tid) {
+        auto cnt = thread_cnt_[tid * n_features + fidx];
+        thread_cnt_[tid * n_features + fidx] = n_entries;
+        n_entries += cnt;
+      }
+    }
+    buffer_ptr_[n_features] = n_entries;
+    buffer_.resize(n_entries);
+    ParallelFor(n_threads, n_threads_, [&](auto tid) {
+      auto offset = thread_cnt_.data() + tid * n_features;
+      for_each_elem(tid, [&](auto const &elem, float w) {
+        buffer_[offset[elem.column_idx]++] = detail::SketchQEntry{elem.value, w};
+      });
+    });
+
+    ParallelFor(n_features, n_threads_, Sched::Guided(), [&](auto fidx) {
+      auto beg = buffer_ptr_[fidx], end = buffer_ptr_[fidx + 1];
+      if (IsCat(feature_types_, fidx)) {
+        for (auto i = beg; i < end; ++i) {
+          categories_[fidx].emplace(buffer_[i].value);
+        }
+        return;
+      }
+      auto &queue = sketches_[fidx].inqueue;
+      for (auto i = beg; i < end; ++i) {
+        if (queue.qtail == queue.queue.size()) {
+          this->Flush(fidx);
+        }
+        queue.queue[queue.qtail++] = buffer_[i];
+      }
+    });
+  }
+  monitor_.Stop(__func__);
+}
+
+template <typename Batch>
+void SortSketchContainer::PushAdapterBatch(Batch const &batch, size_t base_rowid,
+                                           MetaInfo const &info, float missing) {
+  auto const &h_weights =
+      (use_group_ind_ ? detail::UnrollGroupWeights(info) : info.weights_.HostVector());
+  if (!use_group_ind_ && !h_weights.empty()) {
+    CHECK_EQ(h_weights.size(), batch.Size()) << "Invalid size of sample weight.";
+  }
+  this->PushBatchImpl(batch, base_rowid, OptionalWeights{Span<float const>{h_weights}},
+                      data::IsValidFunctor{missing});
+}
+
+void SortSketchContainer::PushRowPage(SparsePage const &page, MetaInfo const &info,
+                                      Span<float const> hessian) {
+  CHECK_EQ(sketches_.size(), info.num_col_);
+  auto const &weights =
+      hessian.empty() ? (use_group_ind_ ? detail::UnrollGroupWeights(info)
+                                        : info.weights_.HostVector())
+                      : MergeWeights(info, hessian, use_group_ind_, n_threads_);
+  if (!weights.empty()) {
+    CHECK_EQ(weights.size(), info.num_row_);
+  }
+  this->PushBatchImpl(data::SparsePageAdapterBatch{page.GetView()}, page.base_rowid,
+                      OptionalWeights{weights}, [](auto) { return true; });
+}
+
+void SortSketchContainer::MakeCuts(Context const *ctx, MetaInfo const &info,
+                                   HistogramCuts *cuts) {
+  // Release the column buffer before merging.
+  buffer_ = decltype(buffer_){};
+  std::vector<double> errors(sketches_.size(), 0.0);
+  ParallelFor(sketches_.size(), n_threads_, Sched::Guided(), [&](auto fidx) {
+    if (IsCat(feature_types_, fidx)) {
+      return;
+    }
+    this->Flush(fidx);
+    WQSketch::SummaryContainer out;
+    sketches_[fidx].GetSummary(&out);
+    if (out.size != 0 && out.MaxRank() > 0) {
+      errors[fidx] = static_cast<double>(out.MaxError()) / out.MaxRank();
+    }
+  });
+  rank_error_ = errors.empty() ? 0.0 : *std::max_element(errors.cbegin(), errors.cend());
+  LOG(DEBUG) << "Sort-based sketch, maximum normalized rank error: " << rank_error_;
+  HostSketchContainer::MakeCuts(ctx, info, cuts);
+}
+
+#define INSTANTIATE(_type)                                          \
+  template void SortSketchContainer::PushAdapterBatch<data::_type>( \
+      data::_type const &batch, size_t base_rowid, MetaInfo const &info, float missing);
+
+INSTANTIATE(ArrayAdapterBatch)
+INSTANTIATE(DenseAdapterBatch)
+INSTANTIATE(CSRArrayAdapterBatch)
+INSTANTIATE(CSCArrayAdapterBatch)
+INSTANTIATE(SparsePageAdapterBatch)
+INSTANTIATE(ColumnarAdapterBatch)
+INSTANTIATE(EncColumnarAdapterBatch)
+
+#undef INSTANTIATE
 }  // namespace xgboost::common
@@ -796,6 +796,8 @@ class SketchContainerImpl {
   bool use_group_ind_{false};
   int32_t n_threads_;
   bool has_categorical_{false};
+  // Use the gather-based merge even if the communicator supports the reduce-scatter.
+  bool gather_merge_{false};
   Monitor monitor_;
 
  public:
@@ -836,6 +838,18 @@ class SketchContainerImpl {
   void AllReduce(Context const *ctx, MetaInfo const &info,
                  std::vector<typename WQSketch::SummaryContainer> *p_reduced,
                  std::vector<int32_t> *p_num_cuts);
+  /**
+   * @brief Merge the local summaries of numeric features with a reduce-scatter.
+   *
+   *   Each worker merges the summaries of a slice of the features, the results are then
+   *   gathered by all workers. A partial merge is pruned at each ring step, the limit of
+   *   these prunes is scaled with the number of workers such that their accumulated rank
+   *   error is bounded by a single prune to the intermediate number of cuts. The merged
+   *   summaries are pruned to `num_cuts` once at the end, same as the gather path.
+   */
+  void ScatterMergeSketches(Context const *ctx, std::vector<std::int32_t> const &num_cuts,
+                            std::vector<bst_idx_t> const &global_column_size,
+                            std::vector<typename WQSketch::SummaryContainer> *p_reduced);
 
   template <typename Batch, typename IsValid>
   void PushRowPageImpl(Batch const &batch, size_t base_rowid, OptionalWeights weights, size_t nnz,
@@ -889,6 +903,11 @@ class SketchContainerImpl {
   void PushRowPage(SparsePage const &page, MetaInfo const &info, Span<float const> hessian = {});
 
   void MakeCuts(Context const *ctx, MetaInfo const &info, HistogramCuts *cuts);
+  /**
+   * @brief Merge the distributed summaries by gathering all of them on each worker. Used
+   *        for testing the reduce-scatter merge.
+   */
+  void SetGatherMerge(bool gather) { this->gather_merge_ = gather; }
 
  private:
   // Merge all categories from other workers.
@@ -907,6 +926,63 @@ class HostSketchContainer : public SketchContainerImpl<WQuantileSketch<float, fl
   void PushAdapterBatch(Batch const &batch, size_t base_rowid, MetaInfo const &info, float missing);
 };
 
+namespace detail {
+using SketchQEntry = WQSummary<float, float>::Queue::QEntry;
+/**
+ * @brief LSD radix sort for the queued sketch entries, ordered by the value.
+ *
+ * @param entries   Entries to be sorted in place.
+ * @param p_scratch Scratch space, resized to the number of entries.
+ */
+void RadixSort(Span<SketchQEntry> entries, std::vector<SketchQEntry> *p_scratch);
+}  // namespace detail
+
+/**
+ * @brief Whether the sort-based sketch is selected by the global `sketch_method` parameter.
+ */
+[[nodiscard]] bool UseSortSketch();
+
+/**
+ * @brief Sort-based alternative to the @ref HostSketchContainer.
+ *
+ *   Instead of having each thread scan all rows for its assigned features, the input is
+ *   transposed into a bounded column buffer one chunk of rows at a time. Each feature then
+ *   fills its sketch queue directly. Full queues are sorted with radix sort and pushed
+ *   into the level hierarchy of the sketch, where summaries are merged pairwise. The
+ *   per-feature memory is the same as the weighted quantile sketch, the queue and the
+ *   levels are sized at construction. The column buffer is shared by all features.
+ */
+class SortSketchContainer : public HostSketchContainer {
+  // Upper bound of entries in the column buffer.
+  static constexpr std::size_t kBufferEntries = static_cast<std::size_t>(1) << 22;
+
+  std::vector<detail::SketchQEntry> buffer_;
+  std::vector<bst_idx_t> buffer_ptr_;
+  std::vector<bst_idx_t> thread_cnt_;
+  std::vector<std::vector<detail::SketchQEntry>> scratch_;
+  double rank_error_{0.0};
+
+  void Flush(bst_feature_t fidx);
+  template <typename Batch, typename IsValid>
+  void PushBatchImpl(Batch const &batch, std::size_t base_rowid, OptionalWeights weights,
+                     IsValid is_valid);
+
+ public:
+  SortSketchContainer(Context const *ctx, bst_bin_t max_bins, common::Span<FeatureType const> ft,
+                      std::vector<bst_idx_t> columns_size, bool use_group);
+
+  template <typename Batch>
+  void PushAdapterBatch(Batch const &batch, size_t base_rowid, MetaInfo const &info, float missing);
+  void PushRowPage(SparsePage const &page, MetaInfo const &info, Span<float const> hessian = {});
+
+  void MakeCuts(Context const *ctx, MetaInfo const &info, HistogramCuts *cuts);
+  /**
+   * @brief The maximum normalized rank error across features of the local sketches,
+   *        available after @ref MakeCuts.
+   */
+  [[nodiscard]] double RankError() const { return rank_error_; }
+};
+
 /**
  * \brief Quantile structure accepts sorted data, extracted from histmaker.
  */
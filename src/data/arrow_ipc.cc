@@ -0,0 +1,440 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ */
+#include "arrow_ipc.h"
+
+#include <algorithm>   // for find_if, transform
+#include <cstring>     // for memcpy, memcmp
+#include <filesystem>  // for file_size
+#include <iterator>    // for distance
+#include <limits>      // for numeric_limits
+#include <utility>     // for move
+
+#include "dmlc/endian.h"          // for DMLC_LITTLE_ENDIAN
+#include "xgboost/logging.h"      // for CHECK
+#include "xgboost/span.h"         // for Span
+#include "xgboost/string_view.h"  // for StringView
+
+namespace xgboost::data {
+namespace {
+using Buffer = common::Span<std::uint8_t const>;
+
+constexpr char kMagic[] = "ARROW1";
+constexpr std::size_t kMagicSize = 6;
+
+// Enums from the Arrow flatbuffers schema.
+enum MessageHeader : std::uint8_t { kSchema = 1, kDictionaryBatch = 2, kRecordBatch = 3 };
+enum TypeId : std::uint8_t { kInt = 2, kFloatingPoint = 3, kUtf8 = 5 };
+
+struct FieldNode {
+  std::int64_t length;
+  std::int64_t null_count;
+};
+
+struct BufferSpec {
+  std::int64_t offset;
+  std::int64_t length;
+};
+
+static_assert(sizeof(ArrowIPCReader::Block) == 24);
+static_assert(sizeof(FieldNode) == 16);
+static_assert(sizeof(BufferSpec) == 16);
+
+[[nodiscard]] StringView ErrMalformed() { return "Malformed Arrow IPC file."; }
+
+template <typename T>
+[[nodiscard]] T ReadScalar(Buffer buf, std::size_t pos) {
+  CHECK_LE(pos + sizeof(T), buf.size()) << ErrMalformed();
+  T v;
+  std::memcpy(&v, buf.data() + pos, sizeof(T));
+  return v;
+}
+
+/**
+ * @brief Minimal read-only accessor for flatbuffers tables.
+ */
+class FbTable {
+  Buffer buf_;
+  std::size_t pos_;
+  std::size_t vtable_;
+  std::uint16_t vsize_;
+
+  // Position of the field, 0 if the field is absent.
+  [[nodiscard]] std::size_t FieldPos(std::int32_t i) const {
+    std::size_t voff = 4 + 2 * i;
+    if (voff + 2 > vsize_) {
+      return 0;
+    }
+    auto off = ReadScalar<std::uint16_t>(buf_, vtable_ + voff);
+    return off == 0 ? 0 : pos_ + off;
+  }
+  // Follow the unsigned offset stored at `pos`.
+  [[nodiscard]] std::size_t Deref(std::size_t pos) const {
+    return pos + ReadScalar<std::uint32_t>(buf_, pos);
+  }
+
+ public:
+  FbTable(Buffer buf, std::size_t pos) : buf_{buf}, pos_{pos} {
+    auto soff = ReadScalar<std::int32_t>(buf_, pos_);
+    auto vtable = static_cast<std::int64_t>(pos_) - soff;
+    CHECK(vtable >= 0 && static_cast<std::size_t>(vtable) < buf_.size()) << ErrMalformed();
+    vtable_ = vtable;
+    vsize_ = ReadScalar<std::uint16_t>(buf_, vtable_);
+  }
+  [[nodiscard]] static FbTable Root(Buffer buf) {
+    return FbTable{buf, ReadScalar<std::uint32_t>(buf, 0)};
+  }
+
+  [[nodiscard]] bool Has(std::int32_t i) const { return this->FieldPos(i) != 0; }
+
+  template <typename T>
+  [[nodiscard]] T Scalar(std::int32_t i, T dft) const {
+    auto pos = this->FieldPos(i);
+    return pos == 0 ? dft : ReadScalar<T>(buf_, pos);
+  }
+  [[nodiscard]] FbTable Table(std::int32_t i) const {
+    auto pos = this->FieldPos(i);
+    CHECK_NE(pos, 0) << ErrMalformed();
+    return FbTable{buf_, this->Deref(pos)};
+  }
+  [[nodiscard]] std::string String(std::int32_t i) const {
+    auto pos = this->FieldPos(i);
+    if (pos == 0) {
+      return {};
+    }
+    pos = this->Deref(pos);
+    auto n = ReadScalar<std::uint32_t>(buf_, pos);
+    CHECK_LE(pos + 4 + n, buf_.size()) << ErrMalformed();
+    return {reinterpret_cast<char const*>(buf_.data() + pos + 4), n};
+  }
+  [[nodiscard]] std::size_t VectorSize(std::int32_t i) const {
+    auto pos = this->FieldPos(i);
+    return pos == 0 ? 0 : ReadScalar<std::uint32_t>(buf_, this->Deref(pos));
+  }
+  // Read the j^th element of a vector of structs.
+  template <typename T>
+  [[nodiscard]] T Struct(std::int32_t i, std::size_t j) const {
+    auto pos = this->Deref(this->FieldPos(i));
+    return ReadScalar<T>(buf_, pos + 4 + j * sizeof(T));
+  }
+  // Read the j^th element of a vector of tables.
+  [[nodiscard]] FbTable TableAt(std::int32_t i, std::size_t j) const {
+    auto pos = this->Deref(this->FieldPos(i)) + 4 + j * 4;
+    return FbTable{buf_, this->Deref(pos)};
+  }
+};
+
+// Field indices of the flatbuffers tables used here.
+namespace fb {
+// Footer
+constexpr std::int32_t kFooterSchema = 1, kFooterDictionaries = 2, kFooterRecordBatches = 3;
+// Schema
+constexpr std::int32_t kSchemaEndianness = 0, kSchemaFields = 1;
+// Field
+constexpr std::int32_t kFieldName = 0, kFieldTypeType = 2, kFieldType = 3, kFieldDictionary = 4,
+                       kFieldChildren = 5;
+// Int
+constexpr std::int32_t kIntBitWidth = 0, kIntIsSigned = 1;
+// FloatingPoint
+constexpr std::int32_t kFloatPrecision = 0;
+// DictionaryEncoding
+constexpr std::int32_t kDictId = 0, kDictIndexType = 1;
+// Message
+constexpr std::int32_t kMessageHeaderType = 1, kMessageHeader = 2;
+// RecordBatch
+constexpr std::int32_t kBatchLength = 0, kBatchNodes = 1, kBatchBuffers = 2,
+                       kBatchCompression = 3;
+// DictionaryBatch
+constexpr std::int32_t kDictBatchId = 0, kDictBatchData = 1, kDictBatchIsDelta = 2;
+}  // namespace fb
+
+[[nodiscard]] std::string IntTypeStr(FbTable const& t) {
+  auto bit_width = t.Scalar<std::int32_t>(fb::kIntBitWidth, 0);
+  auto is_signed = t.Scalar<std::uint8_t>(fb::kIntIsSigned, 0);
+  CHECK(bit_width == 8 || bit_width == 16 || bit_width == 32 || bit_width == 64)
+      << "Invalid integer width: " << bit_width;
+  return std::string{"<"} + (is_signed ? "i" : "u") + std::to_string(bit_width / 8);
+}
+
+[[nodiscard]] std::string ValueTypeStr(std::uint8_t type_id, FbTable const& field) {
+  switch (type_id) {
+    case kInt:
+      return IntTypeStr(field.Table(fb::kFieldType));
+    case kFloatingPoint: {
+      auto precision = field.Table(fb::kFieldType).Scalar<std::int16_t>(fb::kFloatPrecision, 0);
+      CHECK(precision >= 0 && precision <= 2) << ErrMalformed();
+      return std::string{"<f"} + std::to_string(2 << precision);
+    }
+    case kUtf8:
+      return "utf8";
+    default:
+      LOG(FATAL) << "Unsupported Arrow type for field `" << field.String(fb::kFieldName)
+                 << "`: " << static_cast<std::int32_t>(type_id);
+  }
+  return {};
+}
+
+[[nodiscard]] Json MakeArray(void const* data, std::string const& typestr, std::int64_t n) {
+  Json array{Object{}};
+  array["data"] = Array{std::vector<Json>{Json{Integer{reinterpret_cast<std::int64_t>(data)}},
+                                          Json{Boolean{true}}}};
+  array["typestr"] = String{typestr};
+  array["shape"] = Array{std::vector<Json>{Json{Integer{n}}}};
+  array["version"] = Integer{3};
+  return array;
+}
+
+/**
+ * @brief Walk through the buffers of a record batch body.
+ */
+class BodyReader {
+  FbTable batch_;
+  std::uint8_t const* body_;
+  std::int64_t body_len_;
+  std::size_t node_idx_{0};
+  std::size_t buf_idx_{0};
+
+  [[nodiscard]] std::pair<std::uint8_t const*, std::int64_t> NextBuffer() {
+    CHECK_LT(buf_idx_, batch_.VectorSize(fb::kBatchBuffers)) << ErrMalformed();
+    auto spec = batch_.Struct<BufferSpec>(fb::kBatchBuffers, buf_idx_++);
+    // Don't add the offset and the length, the sum can overflow.
+    CHECK(spec.offset >= 0 && spec.length >= 0 && spec.offset <= body_len_ &&
+          spec.length <= body_len_ - spec.offset)
+        << ErrMalformed();
+    return {body_ + spec.offset, spec.length};
+  }
+
+ public:
+  BodyReader(FbTable batch, std::uint8_t const* body, std::int64_t body_len)
+      : batch_{batch}, body_{body}, body_len_{body_len} {
+    CHECK(!batch_.Has(fb::kBatchCompression)) << "Compressed Arrow IPC file is not supported.";
+  }
+  [[nodiscard]] std::int64_t Length() const {
+    return batch_.Scalar<std::int64_t>(fb::kBatchLength, 0);
+  }
+  // Read a primitive array. The validity bitmap is attached as the mask.
+  [[nodiscard]] Json Primitive(std::string const& typestr) {
+    CHECK_LT(node_idx_, batch_.VectorSize(fb::kBatchNodes)) << ErrMalformed();
+    auto node = batch_.Struct<FieldNode>(fb::kBatchNodes, node_idx_++);
+    auto [valid, valid_len] = this->NextBuffer();
+    auto [data, data_len] = this->NextBuffer();
+    CHECK_GE(node.length, 0) << ErrMalformed();
+    CHECK_LE(node.length, data_len / (typestr.back() - '0')) << ErrMalformed();
+    auto array = MakeArray(data, typestr, node.length);
+    if (node.null_count != 0) {
+      CHECK_LE((node.length + 7) / 8, valid_len) << ErrMalformed();
+      array["mask"] = MakeArray(valid, "|t1", node.length);
+    }
+    return array;
+  }
+  // Read a string array. Nulls are not allowed in the category index.
+  [[nodiscard]] Json Utf8() {
+    CHECK_LT(node_idx_, batch_.VectorSize(fb::kBatchNodes)) << ErrMalformed();
+    auto node = batch_.Struct<FieldNode>(fb::kBatchNodes, node_idx_++);
+    CHECK_EQ(node.null_count, 0) << "Null value is not allowed in the category index.";
+    [[maybe_unused]] auto valid = this->NextBuffer();
+    auto [offsets, offsets_len] = this->NextBuffer();
+    auto [values, values_len] = this->NextBuffer();
+    CHECK(node.length >= 0 && node.length < offsets_len / 4) << ErrMalformed();
+    Json names{Object{}};
+    names["offsets"] = MakeArray(offsets, "<i4", node.length + 1);
+    names["values"] = MakeArray(values, "|i1", values_len);
+    return names;
+  }
+};
+
+// Read the encapsulated message at the block, returns the message and the body.
+[[nodiscard]] std::pair<FbTable, std::uint8_t const*> ReadMessage(Buffer file,
+                                                                  ArrowIPCReader::Block const& b) {
+  auto n_bytes = static_cast<std::int64_t>(file.size());
+  CHECK(b.offset >= 0 && b.meta_len >= 8 && b.body_len >= 0 && b.offset <= n_bytes &&
+        b.meta_len <= n_bytes - b.offset && b.body_len <= n_bytes - b.offset - b.meta_len)
+      << ErrMalformed();
+  std::size_t pos = b.offset;
+  auto len = ReadScalar<std::int32_t>(file, pos);
+  if (len == -1) {
+    // Continuation marker.
+    pos += 4;
+    len = ReadScalar<std::int32_t>(file, pos);
+  }
+  pos += 4;
+  CHECK(len > 0 && pos + len <= static_cast<std::size_t>(b.offset + b.meta_len))
+      << ErrMalformed();
+  auto message = FbTable::Root(file.subspan(pos, len));
+  return {message, file.data() + b.offset + b.meta_len};
+}
+}  // anonymous namespace
+
+ArrowIPCReader::ArrowIPCReader(std::string const& path) {
+  CHECK(DMLC_LITTLE_ENDIAN) << "Arrow IPC loader is only supported on little endian platforms.";
+  auto n_bytes = std::filesystem::file_size(path);
+  CHECK_GE(n_bytes, kMagicSize * 2 + 6) << "Invalid Arrow IPC file: " << path;
+  file_ = std::make_shared<common::MmapResource>(StringView{path}, 0, n_bytes);
+  Buffer file{static_cast<std::uint8_t const*>(file_->Data()), file_->Size()};
+
+  CHECK_EQ(std::memcmp(file.data(), kMagic, kMagicSize), 0)
+      << "Invalid Arrow IPC file, use the Feather V2 format: " << path;
+  CHECK_EQ(std::memcmp(file.data() + file.size() - kMagicSize, kMagic, kMagicSize), 0)
+      << "Invalid Arrow IPC file, use the Feather V2 format: " << path;
+  // The footer is followed by its length and the magic string.
+  auto footer_len = ReadScalar<std::int32_t>(file, file.size() - kMagicSize - 4);
+  CHECK(footer_len > 0 && static_cast<std::size_t>(footer_len) + kMagicSize * 2 + 4 <= file.size())
+      << ErrMalformed();
+  auto footer =
+      FbTable::Root(file.subspan(file.size() - kMagicSize - 4 - footer_len, footer_len));
+
+  // Schema
+  auto schema = footer.Table(fb::kFooterSchema);
+  CHECK_EQ(schema.Scalar<std::int16_t>(fb::kSchemaEndianness, 0), 0)
+      << "Big endian Arrow IPC file is not supported.";
+  for (std::size_t i = 0, n = schema.VectorSize(fb::kSchemaFields); i < n; ++i) {
+    auto field = schema.TableAt(fb::kSchemaFields, i);
+    ArrowField f;
+    f.name = field.String(fb::kFieldName);
+    CHECK_EQ(field.VectorSize(fb::kFieldChildren), 0)
+        << "Nested Arrow type is not supported: `" << f.name << "`";
+    auto value_type = ValueTypeStr(field.Scalar<std::uint8_t>(fb::kFieldTypeType, 0), field);
+    if (field.Has(fb::kFieldDictionary)) {
+      auto dict = field.Table(fb::kFieldDictionary);
+      f.dict_id = dict.Scalar<std::int64_t>(fb::kDictId, 0);
+      f.typestr = dict.Has(fb::kDictIndexType) ? IntTypeStr(dict.Table(fb::kDictIndexType)) : "<i4";
+      f.dict_typestr = value_type;
+    } else {
+      CHECK_NE(value_type, "utf8") << "String field must be dictionary-encoded: `" << f.name
+                                   << "`";
+      f.typestr = value_type;
+    }
+    fields_.push_back(std::move(f));
+  }
+
+  // Dictionaries
+  for (std::size_t i = 0, n = footer.VectorSize(fb::kFooterDictionaries); i < n; ++i) {
+    auto block = footer.Struct<Block>(fb::kFooterDictionaries, i);
+    auto [message, body] = ReadMessage(file, block);
+    CHECK_EQ(message.Scalar<std::uint8_t>(fb::kMessageHeaderType, 0), kDictionaryBatch)
+        << ErrMalformed();
+    auto dict = message.Table(fb::kMessageHeader);
+    CHECK_EQ(dict.Scalar<std::uint8_t>(fb::kDictBatchIsDelta, 0), 0)
+        << "Delta dictionary is not supported.";
+    auto id = dict.Scalar<std::int64_t>(fb::kDictBatchId, 0);
+    auto it = std::find_if(fields_.cbegin(), fields_.cend(),
+                           [&](ArrowField const& f) { return f.dict_id == id; });
+    CHECK(it != fields_.cend()) << ErrMalformed();
+    BodyReader reader{dict.Table(fb::kDictBatchData), body, block.body_len};
+    if (it->dict_typestr == "utf8") {
+      dicts_[id] = reader.Utf8();
+    } else {
+      auto names = reader.Primitive(it->dict_typestr);
+      CHECK_EQ(get<Object const>(names).count("mask"), 0)
+          << "Null value is not allowed in the category index.";
+      dicts_[id] = names;
+    }
+  }
+
+  // Record batches
+  for (std::size_t i = 0, n = footer.VectorSize(fb::kFooterRecordBatches); i < n; ++i) {
+    batches_.push_back(footer.Struct<Block>(fb::kFooterRecordBatches, i));
+  }
+}
+
+bst_idx_t ArrowIPCReader::ReadBatch(std::size_t i, std::vector<Json>* p_columns) const {
+  CHECK_LT(i, this->batches_.size());
+  Buffer file{static_cast<std::uint8_t const*>(file_->Data()), file_->Size()};
+  auto const& block = this->batches_[i];
+  auto [message, body] = ReadMessage(file, block);
+  CHECK_EQ(message.Scalar<std::uint8_t>(fb::kMessageHeaderType, 0), kRecordBatch)
+      << ErrMalformed();
+  BodyReader reader{message.Table(fb::kMessageHeader), body, block.body_len};
+
+  auto& columns = *p_columns;
+  columns.clear();
+  for (auto const& f : this->fields_) {
+    auto array = reader.Primitive(f.typestr);
+    if (f.IsCategorical()) {
+      auto it = this->dicts_.find(f.dict_id);
+      CHECK(it != this->dicts_.cend()) << "Missing dictionary for field: `" << f.name << "`";
+      columns.emplace_back(Array{std::vector<Json>{it->second, array}});
+    } else {
+      columns.emplace_back(std::move(array));
+    }
+  }
+  return reader.Length();
+}
+
+ArrowIPCIterator::ArrowIPCIterator(std::string const& path, std::string const& label,
+                                   std::string const& weight)
+    : reader_{path} {
+  auto const& fields = reader_.Fields();
+  auto find = [&](std::string const& name) {
+    if (name.empty()) {
+      return std::numeric_limits<std::size_t>::max();
+    }
+    auto it = std::find_if(fields.cbegin(), fields.cend(),
+                           [&](ArrowField const& f) { return f.name == name; });
+    CHECK(it != fields.cend()) << "Column `" << name << "` is not found in the Arrow file.";
+    CHECK(!it->IsCategorical()) << "Column `" << name << "` must be numeric.";
+    return static_cast<std::size_t>(std::distance(fields.cbegin(), it));
+  };
+  label_idx_ = find(label);
+  weight_idx_ = find(weight);
+
+  for (std::size_t i = 0; i < fields.size(); ++i) {
+    if (i == label_idx_ || i == weight_idx_) {
+      continue;
+    }
+    feature_names_.push_back(fields[i].name);
+    feature_types_.emplace_back(fields[i].IsCategorical() ? "c" : "q");
+  }
+
+  XGProxyDMatrixCreate(&proxy_);
+}
+
+ArrowIPCIterator::~ArrowIPCIterator() { XGDMatrixFree(proxy_); }
+
+int ArrowIPCIterator::Next() {
+  if (iter_ == reader_.NumBatches()) {
+    // Stop iteration
+    return false;
+  }
+  std::vector<Json> columns;
+  reader_.ReadBatch(iter_, &columns);
+  ++iter_;
+
+  auto dump_info = [&](std::size_t idx, std::string* out) {
+    auto const& column = get<Object const>(columns[idx]);
+    CHECK(column.find("mask") == column.cend())
+        << "Null value is not allowed in the column `" << reader_.Fields()[idx].name << "`.";
+    Json::Dump(columns[idx], out);
+  };
+  std::vector<Json> features;
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    if (i == label_idx_) {
+      dump_info(i, &label_);
+    } else if (i == weight_idx_) {
+      dump_info(i, &weight_);
+    } else {
+      features.emplace_back(std::move(columns[i]));
+    }
+  }
+  Json::Dump(Json{Array{std::move(features)}}, &columns_);
+
+  auto check = [](int ret) { CHECK_EQ(ret, 0) << XGBGetLastError(); };
+  check(XGProxyDMatrixSetDataColumnar(proxy_, columns_.c_str()));
+  auto set_str_info = [&](char const* field, std::vector<std::string> const& values) {
+    std::vector<char const*> c_values(values.size());
+    std::transform(values.cbegin(), values.cend(), c_values.begin(),
+                   [](auto const& str) { return str.c_str(); });
+    check(XGDMatrixSetStrFeatureInfo(proxy_, field, c_values.data(), c_values.size()));
+  };
+  set_str_info("feature_name", feature_names_);
+  set_str_info("feature_type", feature_types_);
+  if (label_idx_ != std::numeric_limits<std::size_t>::max()) {
+    check(XGDMatrixSetInfoFromInterface(proxy_, "label", label_.c_str()));
+  }
+  if (weight_idx_ != std::numeric_limits<std::size_t>::max()) {
+    check(XGDMatrixSetInfoFromInterface(proxy_, "weight", weight_.c_str()));
+  }
+  // Continue iteration
+  return true;
+}
+}  // namespace xgboost::data
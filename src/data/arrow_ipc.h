@@ -0,0 +1,119 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ *
+ * @brief Loader for Arrow IPC (Feather V2) files.
+ */
+#ifndef XGBOOST_DATA_ARROW_IPC_H_
+#define XGBOOST_DATA_ARROW_IPC_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int64_t, int32_t
+#include <map>      // for map
+#include <memory>   // for shared_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../common/io.h"   // for MmapResource
+#include "xgboost/base.h"   // for bst_idx_t
+#include "xgboost/c_api.h"  // for DMatrixHandle, DataIterHandle
+#include "xgboost/json.h"   // for Json
+
+namespace xgboost::data {
+/**
+ * @brief A field in the Arrow schema. Nested types are not supported.
+ */
+struct ArrowField {
+  std::string name;
+  // Array interface type string of the values, or of the codes for dictionary-encoded
+  // fields. Empty for string types, which can only be used as dictionary values.
+  std::string typestr;
+  // Type string of the dictionary values, `utf8` for strings.
+  std::string dict_typestr;
+  // Dictionary ID, -1 if the field is not dictionary-encoded.
+  std::int64_t dict_id{-1};
+
+  [[nodiscard]] bool IsCategorical() const { return dict_id >= 0; }
+};
+
+/**
+ * @brief Reader for the Arrow IPC file format.
+ *
+ *   The file is memory mapped and the flatbuffers metadata is decoded without
+ *   dependencies. Buffers of record batches and dictionaries are exposed as array
+ *   interfaces pointing into the mapped file, nothing is copied. Compressed buffers are
+ *   not supported.
+ */
+class ArrowIPCReader {
+ public:
+  // `Block` struct in the footer.
+  struct Block {
+    std::int64_t offset;
+    std::int32_t meta_len;
+    std::int32_t pad;
+    std::int64_t body_len;
+  };
+
+ private:
+  std::shared_ptr<common::MmapResource> file_;
+  std::vector<ArrowField> fields_;
+  std::vector<Block> batches_;
+  // Category index for each dictionary ID, in the format of the columnar adapter.
+  std::map<std::int64_t, Json> dicts_;
+
+ public:
+  explicit ArrowIPCReader(std::string const& path);
+
+  [[nodiscard]] std::size_t NumBatches() const { return batches_.size(); }
+  [[nodiscard]] std::vector<ArrowField> const& Fields() const { return fields_; }
+  /**
+   * @brief Get the columns of a record batch.
+   *
+   * @param i         Index of the record batch.
+   * @param p_columns Array interface for each field. Dictionary-encoded fields are
+   *                  represented as a pair of category index and codes.
+   *
+   * @return Number of rows in the batch.
+   */
+  bst_idx_t ReadBatch(std::size_t i, std::vector<Json>* p_columns) const;
+};
+
+/**
+ * @brief Iterator for feeding record batches of an Arrow IPC file into a DMatrix.
+ */
+class ArrowIPCIterator {
+  ArrowIPCReader reader_;
+  std::size_t label_idx_;
+  std::size_t weight_idx_;
+  std::size_t iter_{0};
+
+  DMatrixHandle proxy_;
+  std::vector<std::string> feature_names_;
+  std::vector<std::string> feature_types_;
+
+  // Storage for the array interface strings.
+  std::string columns_;
+  std::string label_;
+  std::string weight_;
+
+ public:
+  /**
+   * @param path   Path to the Arrow IPC file.
+   * @param label  Name of the label column, empty if there's no label.
+   * @param weight Name of the sample weight column, empty if there's no weight.
+   */
+  ArrowIPCIterator(std::string const& path, std::string const& label, std::string const& weight);
+  ~ArrowIPCIterator();
+
+  int Next();
+  void Reset() { iter_ = 0; }
+
+  auto Proxy() -> decltype(proxy_) { return proxy_; }
+};
+
+namespace arrowipc {
+inline void Reset(DataIterHandle self) { static_cast<ArrowIPCIterator*>(self)->Reset(); }
+
+inline int Next(DataIterHandle self) { return static_cast<ArrowIPCIterator*>(self)->Next(); }
+}  // namespace arrowipc
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_ARROW_IPC_H_
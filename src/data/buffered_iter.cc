@@ -0,0 +1,205 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ */
+#include "buffered_iter.h"
+
+#include <cstring>  // for memcpy
+#include <limits>   // for numeric_limits
+#include <numeric>  // for partial_sum
+#include <utility>  // for move
+
+#include "../common/threading_utils.h"  // for ParallelFor, OmpGetNumThreads
+#include "entry.h"                      // for IsValidFunctor
+#include "proxy_dmatrix.h"              // for DispatchAny, MakeProxy, BatchColumns
+#include "xgboost/linalg.h"             // for Make1dInterface, ArrayInterfaceStr
+#include "xgboost/logging.h"            // for CHECK
+
+namespace xgboost::data {
+namespace {
+[[nodiscard]] std::int32_t IndexBytes(bst_feature_t n_features) {
+  if (n_features <= std::numeric_limits<std::uint8_t>::max() + 1u) {
+    return sizeof(std::uint8_t);
+  } else if (n_features <= std::numeric_limits<std::uint16_t>::max() + 1u) {
+    return sizeof(std::uint16_t);
+  }
+  return sizeof(std::uint32_t);
+}
+
+void PackIndex(bst_feature_t fidx, std::int32_t n_bytes, std::uint8_t* out) {
+  switch (n_bytes) {
+    case sizeof(std::uint8_t): {
+      auto v = static_cast<std::uint8_t>(fidx);
+      std::memcpy(out, &v, sizeof(v));
+      break;
+    }
+    case sizeof(std::uint16_t): {
+      auto v = static_cast<std::uint16_t>(fidx);
+      std::memcpy(out, &v, sizeof(v));
+      break;
+    }
+    default: {
+      std::memcpy(out, &fidx, sizeof(fidx));
+    }
+  }
+}
+
+[[nodiscard]] bst_feature_t UnpackIndex(std::uint8_t const* in, std::int32_t n_bytes) {
+  switch (n_bytes) {
+    case sizeof(std::uint8_t):
+      return *in;
+    case sizeof(std::uint16_t): {
+      std::uint16_t v;
+      std::memcpy(&v, in, sizeof(v));
+      return v;
+    }
+    default: {
+      bst_feature_t v;
+      std::memcpy(&v, in, sizeof(v));
+      return v;
+    }
+  }
+}
+}  // namespace
+
+BufferedDataIter::BufferedDataIter(DataIterHandle iter, DMatrixHandle proxy,
+                                   DataIterResetCallback* reset, XGDMatrixCallbackNext* next,
+                                   float missing, std::int32_t n_threads, std::size_t max_bytes)
+    : iter_{iter},
+      proxy_{proxy},
+      reset_{reset},
+      next_{next},
+      missing_{missing},
+      n_threads_{common::OmpGetNumThreads(n_threads)},
+      max_bytes_{max_bytes} {}
+
+void BufferedDataIter::Push() {
+  auto* proxy = MakeProxy(proxy_);
+  CHECK(proxy->Ctx()->IsCPU()) << "Single-pass construction only supports CPU inputs.";
+  CHECK_EQ(cpu_impl::BatchCats(proxy).n_total_cats, 0)
+      << "Single-pass construction doesn't support inputs with string categories.";
+
+  auto& out = batches_.emplace_back();
+  out.n_features = BatchColumns(proxy);
+  auto is_valid = IsValidFunctor{missing_};
+  cpu_impl::DispatchAny(proxy, [&](auto const& batch) {
+    out.n_samples = batch.Size();
+    std::vector<bst_idx_t> indptr(out.n_samples + 1, 0);
+    common::ParallelFor(out.n_samples, n_threads_, [&](auto i) {
+      auto const& line = batch.GetLine(i);
+      bst_idx_t n_valid = 0;
+      for (std::size_t j = 0; j < line.Size(); ++j) {
+        n_valid += is_valid(line.GetElement(j));
+      }
+      indptr[i + 1] = n_valid;
+    });
+    std::partial_sum(indptr.cbegin(), indptr.cend(), indptr.begin());
+    auto nnz = indptr.back();
+    out.values.resize(nnz);
+
+    if (nnz == out.n_samples * out.n_features) {
+      // No missing value, store the values as a dense array.
+      common::ParallelFor(out.n_samples, n_threads_, [&](auto i) {
+        auto const& line = batch.GetLine(i);
+        for (std::size_t j = 0; j < line.Size(); ++j) {
+          auto elem = line.GetElement(j);
+          if (is_valid(elem)) {
+            out.values[i * out.n_features + elem.column_idx] = elem.value;
+          }
+        }
+      });
+      return;
+    }
+
+    out.index_bytes = IndexBytes(out.n_features);
+    out.indices.resize(nnz * out.index_bytes);
+    common::ParallelFor(out.n_samples, n_threads_, [&](auto i) {
+      auto const& line = batch.GetLine(i);
+      auto k = indptr[i];
+      for (std::size_t j = 0; j < line.Size(); ++j) {
+        auto elem = line.GetElement(j);
+        if (is_valid(elem)) {
+          PackIndex(elem.column_idx, out.index_bytes, out.indices.data() + k * out.index_bytes);
+          out.values[k] = elem.value;
+          ++k;
+        }
+      }
+    });
+    out.indptr = std::move(indptr);
+  });
+  out.info = proxy->Info().Copy();
+  n_bytes_ += out.indptr.size() * sizeof(decltype(out.indptr)::value_type) +
+              out.indices.size() * sizeof(decltype(out.indices)::value_type) +
+              out.values.size() * sizeof(decltype(out.values)::value_type);
+}
+
+void BufferedDataIter::SetProxy(Batch const& batch) {
+  auto* proxy = MakeProxy(proxy_);
+  // Restore the meta info first as it's moved by the DMatrix.
+  proxy->Info() = batch.info.Copy();
+  if (batch.IsDense()) {
+    auto array = linalg::TensorView<float const, 2>{
+        common::Span{batch.values.data(), batch.values.size()},
+        {batch.n_samples, static_cast<bst_idx_t>(batch.n_features)}, DeviceOrd::CPU()};
+    values_ = linalg::ArrayInterfaceStr(array);
+    proxy->SetArray(StringView{values_});
+    return;
+  }
+  auto nnz = batch.values.size();
+  unpacked_.resize(nnz);
+  common::ParallelFor(nnz, n_threads_, [&](auto i) {
+    unpacked_[i] = UnpackIndex(batch.indices.data() + i * batch.index_bytes, batch.index_bytes);
+  });
+  indptr_ = linalg::Make1dInterface(batch.indptr.data(), batch.indptr.size());
+  indices_ = linalg::Make1dInterface(unpacked_.data(), unpacked_.size());
+  values_ = linalg::Make1dInterface(batch.values.data(), batch.values.size());
+  proxy->SetCsr(indptr_.c_str(), indices_.c_str(), values_.c_str(), batch.n_features, true);
+}
+
+int BufferedDataIter::Next() {
+  if (passthrough_) {
+    return next_(iter_);
+  }
+  if (!exhausted_) {
+    if (!next_(iter_)) {
+      exhausted_ = true;
+      return 0;
+    }
+    this->Push();
+    if (n_bytes_ > max_bytes_) {
+      LOG(WARNING) << "The single-pass buffer exceeds the budget of " << max_bytes_
+                   << " bytes, fall back to iterating over the input for each pass.";
+      batches_ = decltype(batches_){};
+      n_bytes_ = 0;
+      passthrough_ = true;
+      // The proxy still holds the current batch from the external iterator.
+      return 1;
+    }
+    // Replace the input with the buffer so that all iterations see the same data.
+    this->SetProxy(batches_.back());
+    ++pos_;
+    return 1;
+  }
+  if (pos_ == batches_.size()) {
+    return 0;
+  }
+  this->SetProxy(batches_[pos_++]);
+  return 1;
+}
+
+void BufferedDataIter::Reset() {
+  if (!exhausted_ && !passthrough_) {
+    if (pos_ == 0) {
+      reset_(iter_);
+      return;
+    }
+    // Drain the external iterator, it won't be reset again unless the buffer exceeds the
+    // budget.
+    while (this->Next()) {
+    }
+  }
+  if (passthrough_) {
+    reset_(iter_);
+  }
+  pos_ = 0;
+}
+}  // namespace xgboost::data
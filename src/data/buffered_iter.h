@@ -0,0 +1,114 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ */
+#ifndef XGBOOST_DATA_BUFFERED_ITER_H_
+#define XGBOOST_DATA_BUFFERED_ITER_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t, uint8_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "xgboost/base.h"   // for bst_idx_t, bst_feature_t
+#include "xgboost/c_api.h"  // for DataIterHandle, DMatrixHandle
+#include "xgboost/data.h"   // for MetaInfo
+
+namespace xgboost::data {
+/**
+ * @brief Wraps an external data iterator such that the external iterator is only
+ *        consumed once.
+ *
+ *   The `QuantileDMatrix` iterates over the input multiple times for obtaining the data
+ *   shape, the sketches, and the gradient index. For slow data sources like a database
+ *   cursor, this wrapper copies each batch into a buffer that contains only valid elements
+ *   during the first iteration. Subsequent iterations replay the buffer by setting it back
+ *   to the proxy DMatrix. The buffer is released along with the wrapper, which is only
+ *   needed during the DMatrix construction.
+ *
+ *   Batches without missing values are stored as dense arrays without any index. Other
+ *   batches are stored as CSR, with the column indices packed into the smallest integer
+ *   type that fits the number of features. The values are kept exact, binning against
+ *   provisional cuts would make the gradient index depend on the batch order and diverge
+ *   from the multi-pass construction.
+ *
+ *   Once the buffer exceeds the byte budget, it's dropped and the wrapper falls back to
+ *   iterating over the external iterator for every pass, like the multi-pass construction.
+ *
+ *   Only CPU inputs without string categories are supported.
+ */
+class BufferedDataIter {
+  struct Batch {
+    // Empty for dense batches.
+    std::vector<bst_idx_t> indptr;
+    // Packed column indices, each takes `index_bytes`. Empty for dense batches.
+    std::vector<std::uint8_t> indices;
+    std::vector<float> values;
+    std::int32_t index_bytes{0};
+    bst_idx_t n_samples{0};
+    bst_feature_t n_features{0};
+    MetaInfo info;
+
+    [[nodiscard]] bool IsDense() const { return indptr.empty(); }
+  };
+
+  DataIterHandle iter_;
+  DMatrixHandle proxy_;
+  DataIterResetCallback* reset_;
+  XGDMatrixCallbackNext* next_;
+  float missing_;
+  std::int32_t n_threads_;
+  std::size_t max_bytes_;
+
+  std::vector<Batch> batches_;
+  std::size_t n_bytes_{0};
+  // Whether the external iterator has been exhausted.
+  bool exhausted_{false};
+  // Whether the buffer has exceeded the budget and the external iterator is used directly.
+  bool passthrough_{false};
+  std::size_t pos_{0};
+
+  // Unpacked column indices of the current batch.
+  std::vector<bst_feature_t> unpacked_;
+  // Storage for the array interface strings.
+  std::string indptr_;
+  std::string indices_;
+  std::string values_;
+
+  void Push();
+  void SetProxy(Batch const& batch);
+
+ public:
+  /**
+   * @param max_bytes Budget for the buffer, see @ref MemCostBytes.
+   */
+  BufferedDataIter(DataIterHandle iter, DMatrixHandle proxy, DataIterResetCallback* reset,
+                   XGDMatrixCallbackNext* next, float missing, std::int32_t n_threads,
+                   std::size_t max_bytes = DefaultMaxBytes());
+
+  static constexpr std::size_t DefaultMaxBytes() {
+    return static_cast<std::size_t>(4) * 1024 * 1024 * 1024;
+  }
+
+  int Next();
+  void Reset();
+  /**
+   * @brief Number of batches buffered so far.
+   */
+  [[nodiscard]] std::size_t NumBatches() const { return batches_.size(); }
+  /**
+   * @brief Size of the buffered arrays in bytes, the meta info is excluded.
+   */
+  [[nodiscard]] std::size_t MemCostBytes() const { return n_bytes_; }
+  /**
+   * @brief Whether the buffer has been dropped for exceeding the budget.
+   */
+  [[nodiscard]] bool Passthrough() const { return passthrough_; }
+};
+
+namespace bufiter {
+inline void Reset(DataIterHandle self) { static_cast<BufferedDataIter*>(self)->Reset(); }
+
+inline int Next(DataIterHandle self) { return static_cast<BufferedDataIter*>(self)->Next(); }
+}  // namespace bufiter
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_BUFFERED_ITER_H_
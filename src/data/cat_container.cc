@@ -3,9 +3,11 @@
  */
 #include "cat_container.h"
 
-#include <algorithm>  // for copy
+#include <algorithm>  // for copy, equal
+#include <atomic>     // for atomic
 #include <cstddef>    // for size_t
-#include <memory>     // for make_unique
+#include <cstdint>    // for uint64_t, uint8_t, uintptr_t
+#include <memory>     // for make_unique, make_shared
 #include <utility>    // for move
 #include <vector>     // for vector
 
@@ -267,6 +269,221 @@ void CatContainer::Load(Json const& in) {
   LoadJson<std::int32_t>(in["sorted_idx"], &h_sorted_idx);
 
   this->cpu_impl_->Finalize();
+  this->Touch();
+}
+
+namespace cpu_impl {
+namespace {
+// FNV-1a, the fingerprint is verified by the cache.
+class Fnv1a {
+  std::uint64_t hash_{14695981039346656037ull};
+
+ public:
+  template <typename T>
+  void UpdateBytes(common::Span<T const> data) {
+    auto ptr = reinterpret_cast<std::uint8_t const*>(data.data());
+    for (std::size_t i = 0, n = data.size_bytes(); i < n; ++i) {
+      hash_ ^= ptr[i];
+      hash_ *= 1099511628211ull;
+    }
+  }
+  template <typename T>
+  void UpdateValue(T v) {
+    this->UpdateBytes(common::Span<T const>{&v, 1});
+  }
+  [[nodiscard]] std::uint64_t Get() const { return hash_; }
+};
+
+template <typename T>
+[[nodiscard]] bool SpanEqual(common::Span<T const> l, common::Span<T const> r) {
+  return std::equal(l.data(), l.data() + l.size(), r.data(), r.data() + r.size());
+}
+
+[[nodiscard]] bool CatsEqual(enc::HostColumnsView const& l, enc::HostColumnsView const& r) {
+  if (l.n_total_cats != r.n_total_cats || l.Size() != r.Size() ||
+      !SpanEqual(l.feature_segments, r.feature_segments)) {
+    return false;
+  }
+  for (std::size_t f_idx = 0, n = l.Size(); f_idx < n; ++f_idx) {
+    auto const& r_col = r[f_idx];
+    if (l[f_idx].index() != r_col.index()) {
+      return false;
+    }
+    auto equal = std::visit(enc::Overloaded{[&](enc::CatStrArrayView const& l_str) {
+                                              auto r_str = std::get<enc::CatStrArrayView>(r_col);
+                                              return SpanEqual(l_str.offsets, r_str.offsets) &&
+                                                     SpanEqual(l_str.values, r_str.values);
+                                            },
+                                            [&](auto&& l_values) {
+                                              using T = std::decay_t<decltype(l_values)>;
+                                              return SpanEqual(l_values, std::get<T>(r_col));
+                                            }},
+                            l[f_idx]);
+    if (!equal) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // anonymous namespace
+
+std::uint64_t Fingerprint(enc::HostColumnsView const& cats) {
+  Fnv1a hasher;
+  hasher.UpdateValue(cats.n_total_cats);
+  hasher.UpdateBytes(cats.feature_segments);
+  for (std::size_t f_idx = 0, n = cats.Size(); f_idx < n; ++f_idx) {
+    auto const& col = cats[f_idx];
+    hasher.UpdateValue(static_cast<std::uint64_t>(col.index()));
+    std::visit(enc::Overloaded{[&](enc::CatStrArrayView const& str) {
+                                 hasher.UpdateBytes(str.offsets);
+                                 hasher.UpdateBytes(str.values);
+                               },
+                               [&](auto&& values) {
+                                 hasher.UpdateBytes(values);
+                               }},
+               col);
+  }
+  return hasher.Get();
+}
+
+RecodeCache::SourceT ViewSource(enc::HostColumnsView const& cats) {
+  // Tag for views, containers use 0.
+  RecodeCache::SourceT source{1, static_cast<std::uint64_t>(cats.n_total_cats)};
+  auto push_span = [&](auto const& span) {
+    source.push_back(reinterpret_cast<std::uintptr_t>(span.data()));
+    source.push_back(span.size());
+  };
+  // The segments are small and often created for each batch, use the values.
+  source.insert(source.end(), cats.feature_segments.cbegin(), cats.feature_segments.cend());
+  for (std::size_t f_idx = 0, n = cats.Size(); f_idx < n; ++f_idx) {
+    auto const& col = cats[f_idx];
+    source.push_back(col.index());
+    std::visit(enc::Overloaded{[&](enc::CatStrArrayView const& str) {
+                                 push_span(str.offsets);
+                                 push_span(str.values);
+                               },
+                               [&](auto&& values) {
+                                 push_span(values);
+                               }},
+               col);
+  }
+  return source;
+}
+
+RecodeCache::MappingT RecodeCache::Find(std::uint64_t key, enc::HostColumnsView const& cats) {
+  std::lock_guard guard{lock_};
+  auto it = this->entries_.find(key);
+  if (it == this->entries_.cend() || !CatsEqual(it->second.cats->HostView(), cats)) {
+    return nullptr;
+  }
+  return it->second.mapping;
+}
+
+void RecodeCache::Insert(std::uint64_t key, enc::HostColumnsView const& cats, MappingT mapping) {
+  auto copy = std::make_shared<CatContainer const>(cats, false);
+  std::lock_guard guard{lock_};
+  if (this->entries_.size() >= kMaxEntries) {
+    this->entries_.clear();
+  }
+  this->entries_[key] = Entry{std::move(copy), std::move(mapping)};
+}
+
+RecodeCache::MappingT RecodeCache::FindSource(SourceT const& source) {
+  std::lock_guard guard{lock_};
+  auto it = this->sources_.find(source);
+  if (it == this->sources_.cend()) {
+    return nullptr;
+  }
+  CHECK(!it->second.cats);
+  return it->second.mapping;
+}
+
+void RecodeCache::InsertSource(SourceT source, MappingT mapping) {
+  std::lock_guard guard{lock_};
+  if (this->sources_.size() >= kMaxEntries) {
+    this->sources_.clear();
+  }
+  this->sources_[std::move(source)] = Entry{nullptr, std::move(mapping)};
+}
+
+RecodeCache::MappingT RecodeCache::FindView(SourceT const& source,
+                                            enc::HostColumnsView const& cats) {
+  std::lock_guard guard{lock_};
+  auto it = this->sources_.find(source);
+  // The buffers might have been refilled with different categories.
+  if (it == this->sources_.cend() || !CatsEqual(it->second.cats->HostView(), cats)) {
+    return nullptr;
+  }
+  return it->second.mapping;
+}
+
+void RecodeCache::InsertView(SourceT source, enc::HostColumnsView const& cats,
+                             MappingT mapping) {
+  auto copy = std::make_shared<CatContainer const>(cats, false);
+  std::lock_guard guard{lock_};
+  if (this->sources_.size() >= kMaxEntries) {
+    this->sources_.clear();
+  }
+  this->sources_[std::move(source)] = Entry{std::move(copy), std::move(mapping)};
+}
+
+void RecodeCache::Clear() {
+  std::lock_guard guard{lock_};
+  this->entries_.clear();
+  this->sources_.clear();
+}
+
+std::size_t RecodeCache::Size() {
+  std::lock_guard guard{lock_};
+  return this->entries_.size();
+}
+}  // namespace cpu_impl
+
+std::uint64_t CatContainer::NextId() {
+  static std::atomic<std::uint64_t> id{0};
+  return id++;
+}
+
+cpu_impl::RecodeCache::MappingT CatContainer::HostMapping(
+    Context const* ctx, enc::HostColumnsView const& new_enc) const {
+  // Registered views.
+  auto mapping = this->recode_cache_->FindView(cpu_impl::ViewSource(new_enc), new_enc);
+  if (mapping) {
+    return mapping;
+  }
+  auto key = cpu_impl::Fingerprint(new_enc);
+  mapping = this->recode_cache_->Find(key, new_enc);
+  if (mapping) {
+    return mapping;
+  }
+
+  auto cpu_ctx = ctx->MakeCPU();
+  std::vector<std::int32_t> h_mapping(new_enc.n_total_cats);
+  auto sorted_idx = this->RefSortedIndex(&cpu_ctx);
+  auto orig_enc = this->HostView();
+  enc::Recode(cpu_impl::EncPolicy, orig_enc, sorted_idx, new_enc, common::Span{h_mapping});
+  mapping = std::make_shared<std::vector<std::int32_t> const>(std::move(h_mapping));
+  this->recode_cache_->Insert(key, new_enc, mapping);
+  return mapping;
+}
+
+cpu_impl::RecodeCache::MappingT CatContainer::HostMapping(Context const* ctx,
+                                                          CatContainer const& new_cats) const {
+  auto source = new_cats.Source();
+  auto mapping = this->recode_cache_->FindSource(source);
+  if (mapping) {
+    return mapping;
+  }
+  mapping = this->HostMapping(ctx, new_cats.HostView());
+  this->recode_cache_->InsertSource(std::move(source), mapping);
+  return mapping;
+}
+
+cpu_impl::RecodeCache::MappingT CatContainer::RegisterHostMapping(
+    Context const* ctx, enc::HostColumnsView const& new_enc) const {
+  auto mapping = this->HostMapping(ctx, new_enc);
+  this->recode_cache_->InsertView(cpu_impl::ViewSource(new_enc), new_enc, mapping);
+  return mapping;
 }
 
 #if !defined(XGBOOST_USE_CUDA)
@@ -278,6 +495,7 @@ void CatContainer::Copy(Context const* ctx, CatContainer const& that) {
   [[maybe_unused]] auto h_view = that.HostView();
   this->CopyCommon(ctx, that);
   this->cpu_impl_->Copy(that.cpu_impl_.get());
+  this->Touch();
 }
 
 [[nodiscard]] enc::HostColumnsView CatContainer::HostView() const { return this->HostViewImpl(); }
@@ -293,6 +511,7 @@ void CatContainer::Sort(Context const* ctx) {
   auto view = this->HostView();
   this->sorted_idx_.HostVector().resize(view.n_total_cats);
   enc::SortNames(enc::Policy<EncErrorPolicy>{}, view, this->sorted_idx_.HostSpan());
+  this->Touch();
 }
 #endif  // !defined(XGBOOST_USE_CUDA)
 
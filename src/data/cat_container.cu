@@ -233,6 +233,7 @@ void CatContainer::Copy(Context const* ctx, CatContainer const& that) {
   }
   CHECK_EQ(this->Empty(), that.Empty());
   CHECK_EQ(this->NumCatsTotal(), that.NumCatsTotal());
+  this->Touch();
 }
 
 [[nodiscard]] bool CatContainer::Empty() const {
@@ -263,6 +264,7 @@ void CatContainer::Sort(Context const* ctx) {
     this->sorted_idx_.Resize(view.n_total_cats);
     enc::SortNames(cuda_impl::EncPolicy, view, this->sorted_idx_.DeviceSpan());
   }
+  this->Touch();
 }
 
 [[nodiscard]] enc::HostColumnsView CatContainer::HostView() const {
@@ -3,13 +3,15 @@
  */
 #pragma once
 
-#include <cstdint>  // for int32_t, int8_t
-#include <memory>   // for unique_ptr
-#include <mutex>    // for mutex
-#include <string>   // for string
-#include <tuple>    // for tuple
-#include <utility>  // for move
-#include <vector>   // for vector
+#include <cstdint>        // for int32_t, int8_t, uint64_t
+#include <map>            // for map
+#include <memory>         // for unique_ptr, shared_ptr
+#include <mutex>          // for mutex
+#include <string>         // for string
+#include <tuple>          // for tuple
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
 
 #include "../common/categorical.h"       // for AsCat
 #include "../encoder/ordinal.h"          // for CatStrArrayView
@@ -96,6 +98,71 @@ struct CatContainerImpl {
 using EncPolicyT = enc::Policy<EncErrorPolicy>;
 
 inline EncPolicyT EncPolicy = EncPolicyT{};
+
+/**
+ * @brief Cache for the mapping from the categories of an inference input to the
+ *        categories of the training data.
+ *
+ *   Inplace prediction on small batches pays for the re-coding on every call, even
+ *   though the batches usually share the same categories. Lookups go through two
+ *   levels:
+ *
+ *   - The identity of the source. For a @ref CatContainer, it's the container ID and its
+ *     version, which costs O(1). For a view into user buffers, it's the addresses and the
+ *     sizes of the buffers, only used when the view is registered. The buffers can be
+ *     refilled by the caller, a hit is verified against a copy of the categories.
+ *   - A fingerprint of the input categories when the source is not known. A copy of the
+ *     input categories is kept along with the mapping to guard against hash collisions.
+ */
+class RecodeCache {
+ public:
+  using MappingT = std::shared_ptr<std::vector<std::int32_t> const>;
+  using SourceT = std::vector<std::uint64_t>;
+
+ private:
+  struct Entry {
+    std::shared_ptr<CatContainer const> cats;
+    MappingT mapping;
+  };
+
+  std::mutex lock_;
+  std::unordered_map<std::uint64_t, Entry> entries_;
+  // Mappings keyed by the identity of the source, checked before the fingerprint. Only
+  // views have a copy of the categories.
+  std::map<SourceT, Entry> sources_;
+
+ public:
+  // The cache is dropped once it's full, we don't expect many different dictionaries.
+  static constexpr std::size_t kMaxEntries = 64;
+
+  /**
+   * @brief Find the mapping for the input categories, returns nullptr if not found.
+   */
+  [[nodiscard]] MappingT Find(std::uint64_t key, enc::HostColumnsView const& cats);
+  void Insert(std::uint64_t key, enc::HostColumnsView const& cats, MappingT mapping);
+  /**
+   * @brief Find the mapping by the identity of a container, returns nullptr if not found.
+   */
+  [[nodiscard]] MappingT FindSource(SourceT const& source);
+  void InsertSource(SourceT source, MappingT mapping);
+  /**
+   * @brief Find the mapping by the identity of a view, returns nullptr if not found or if
+   *        the categories have changed since the view was inserted.
+   */
+  [[nodiscard]] MappingT FindView(SourceT const& source, enc::HostColumnsView const& cats);
+  void InsertView(SourceT source, enc::HostColumnsView const& cats, MappingT mapping);
+  void Clear();
+  [[nodiscard]] std::size_t Size();
+};
+
+/**
+ * @brief Fingerprint of the categories, including the type and the ordering.
+ */
+[[nodiscard]] std::uint64_t Fingerprint(enc::HostColumnsView const& cats);
+/**
+ * @brief Identity of a view by the addresses and the sizes of the underlying buffers.
+ */
+[[nodiscard]] RecodeCache::SourceT ViewSource(enc::HostColumnsView const& cats);
 };  // namespace cpu_impl
 
 namespace cuda_impl {
@@ -156,7 +223,10 @@ class CatContainer {
   [[nodiscard]] bool DeviceCanRead() const { return this->feature_segments_.DeviceCanRead(); }
 
   // Mostly used for testing.
-  void Push(cpu_impl::ColumnType const& column) { this->cpu_impl_->columns.emplace_back(column); }
+  void Push(cpu_impl::ColumnType const& column) {
+    this->cpu_impl_->columns.emplace_back(column);
+    this->Touch();
+  }
   /**
    * @brief Wether the container is initialized at all. If the input is not a DataFrame,
    *        this method returns True.
@@ -202,6 +272,41 @@ class CatContainer {
    * @brief Get a view to the CPU storage.
    */
   [[nodiscard]] enc::HostColumnsView HostView() const;
+  /**
+   * @brief Get the mapping from the input categories to the categories in this container.
+   *
+   *   Results are cached. Registered views are found by the address of the buffers and
+   *   verified with a comparison, otherwise, subsequent calls with the same categories cost
+   *   a fingerprint and a comparison instead of a full re-coding. The container must be
+   *   sorted.
+   */
+  [[nodiscard]] cpu_impl::RecodeCache::MappingT HostMapping(
+      Context const* ctx, enc::HostColumnsView const& new_enc) const;
+  /**
+   * @brief Same as the other overload, but the cache is keyed by the identity of the
+   *        input container. Only the first call for each version of the input computes
+   *        the fingerprint.
+   */
+  [[nodiscard]] cpu_impl::RecodeCache::MappingT HostMapping(Context const* ctx,
+                                                            CatContainer const& new_cats) const;
+  /**
+   * @brief Compute the mapping for a view and cache it by the address of the buffers.
+   *
+   *   Subsequent lookups with the same buffers skip the fingerprint, the categories are
+   *   still compared with a copy so that refilled buffers don't get a stale mapping.
+   */
+  [[nodiscard]] cpu_impl::RecodeCache::MappingT RegisterHostMapping(
+      Context const* ctx, enc::HostColumnsView const& new_enc) const;
+  /**
+   * @brief Identity of this container, changes whenever the categories are modified.
+   */
+  [[nodiscard]] cpu_impl::RecodeCache::SourceT Source() const {
+    return {kContainerSource, this->id_, this->version_};
+  }
+  /**
+   * @brief Number of cached mappings, used for testing.
+   */
+  [[nodiscard]] std::size_t NumCachedMappings() const { return this->recode_cache_->Size(); }
 
 #if defined(XGBOOST_USE_CUDA)
   /**
@@ -216,6 +321,20 @@ class CatContainer {
   bst_cat_t n_total_cats_{0};
 
   std::unique_ptr<cpu_impl::CatContainerImpl> cpu_impl_;
+  // Mappings of inference inputs, invalidated whenever the categories change.
+  std::unique_ptr<cpu_impl::RecodeCache> recode_cache_{std::make_unique<cpu_impl::RecodeCache>()};
+  // Tag of the source, distinguishes containers from views.
+  static constexpr std::uint64_t kContainerSource = 0;
+  // Unique ID of the container and the number of modifications, used as the cache key.
+  std::uint64_t id_{NextId()};
+  std::uint64_t version_{0};
+
+  [[nodiscard]] static std::uint64_t NextId();
+  // Called by all methods that modify the categories.
+  void Touch() {
+    ++this->version_;
+    this->recode_cache_->Clear();
+  }
 
   HostDeviceVector<bst_cat_t> sorted_idx_;
 #if defined(XGBOOST_USE_CUDA)
@@ -277,5 +396,28 @@ inline auto MakeCatAccessor(Context const* ctx, enc::HostColumnsView const& new_
   auto acc = CatAccessor{cats_mapping};
   return std::tuple{acc, std::move(mapping)};
 }
+
+/**
+ * @brief Same as @ref MakeCatAccessor, but the mapping is obtained from the cache of the
+ *        original categories.
+ */
+inline auto MakeCachedCatAccessor(Context const* ctx, enc::HostColumnsView const& new_enc,
+                                  CatContainer const* orig_cats) {
+  auto mapping = orig_cats->HostMapping(ctx, new_enc);
+  CHECK_EQ(new_enc.feature_segments.size(), orig_cats->HostView().feature_segments.size());
+  auto cats_mapping = enc::MappingView{new_enc.feature_segments, common::Span{*mapping}};
+  auto acc = CatAccessor{cats_mapping};
+  return std::tuple{acc, std::move(mapping)};
+}
+
+inline auto MakeCachedCatAccessor(Context const* ctx, CatContainer const* new_cats,
+                                  CatContainer const* orig_cats) {
+  auto mapping = orig_cats->HostMapping(ctx, *new_cats);
+  auto new_enc = new_cats->HostView();
+  CHECK_EQ(new_enc.feature_segments.size(), orig_cats->HostView().feature_segments.size());
+  auto cats_mapping = enc::MappingView{new_enc.feature_segments, common::Span{*mapping}};
+  auto acc = CatAccessor{cats_mapping};
+  return std::tuple{acc, std::move(mapping)};
+}
 }  // namespace cpu_impl
 }  // namespace xgboost
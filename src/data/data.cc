@@ -48,6 +48,7 @@
 #include "gradient_index.h"                   // for GHistIndexMatrix
 #include "simple_dmatrix.h"                   // for SimpleDMatrix
 #include "sparse_page_writer.h"               // for SparsePageFormatReg
+#include "text_parser.h"                      // for CreateTextParser
 #include "validation.h"                       // for LabelsCheck, WeightsCheck, ValidateQueryGroup
 #include "xgboost/base.h"                     // for bst_group_t, bst_idx_t, bst_float, bst_ulong
 #include "xgboost/context.h"                  // for Context
@@ -901,6 +902,16 @@ DMatrix* TryLoadBinary(std::string fname, bool silent) {
   if (fi != nullptr) {
     common::PeekableInStream is(fi.get());
     if (is.PeekRead(&magic, sizeof(magic)) == sizeof(magic)) {
+      // The `QuantileDMatrix` snapshot uses native byte order and is memory mapped.
+      if (static_cast<std::uint32_t>(magic) == data::IterativeDMatrix::kMagic) {
+        DMatrix* dmat = data::IterativeDMatrix::Load(StringView{fname}, 0);
+        if (!silent) {
+          LOG(INFO) << dmat->Info().num_row_ << 'x' << dmat->Info().num_col_
+                    << " QuantileDMatrix with " << dmat->Info().num_nonzero_
+                    << " entries loaded from " << fname;
+        }
+        return dmat;
+      }
       if (!DMLC_IO_NO_ENDIAN_SWAP) {
         dmlc::ByteSwap(&magic, sizeof(magic), 1);
       }
@@ -938,8 +949,7 @@ DMatrix* DMatrix::Load(const std::string& uri, bool silent, DataSplitMode data_s
   });
 
   fname = data::ValidateFileFormat(fname);
-  std::unique_ptr<dmlc::Parser<std::uint32_t>> parser(
-      dmlc::Parser<std::uint32_t>::Create(fname.c_str(), partid, npart, "auto"));
+  auto parser = data::CreateTextParser(fname, partid, npart, Context{}.Threads());
   data::FileAdapter adapter(parser.get());
   return DMatrix::Create(&adapter, std::numeric_limits<float>::quiet_NaN(), Context{}.Threads(), "",
                          data_split_mode);
@@ -26,7 +26,8 @@ ExtMemQuantileDMatrix::ExtMemQuantileDMatrix(DataIterHandle iter_handle, DMatrix
                                              XGDMatrixCallbackNext *next, bst_bin_t max_bin,
                                              std::int64_t max_quantile_blocks,
                                              ExtMemConfig const &config)
-    : cache_prefix_{config.cache}, on_host_{config.on_host} {
+    : cache_prefix_{config.cache}, on_host_{config.on_host}, io_backend_{config.io_backend},
+      resident_budget_{std::make_shared<ResidentBudget>(config.resident_cache_bytes)} {
   cache_prefix_ = MakeCachePrefix(cache_prefix_);
   auto iter = std::make_shared<DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>>(
       iter_handle, reset, next);
@@ -42,7 +43,7 @@ ExtMemQuantileDMatrix::ExtMemQuantileDMatrix(DataIterHandle iter_handle, DMatrix
   BatchParam p{max_bin, tree::TrainParam::DftSparseThreshold()};
   if (ctx.IsCPU()) {
     CHECK(detail::HostRatioIsAuto(config.cache_host_ratio)) << error::CacheHostRatioNotImpl();
-    this->InitFromCPU(&ctx, iter, proxy, p, config.missing, ref);
+    this->InitFromCPU(&ctx, iter, proxy, p, config.missing, ref, config.compress_cache);
   } else {
     p.n_prefetch_batches = ::xgboost::cuda_impl::DftPrefetchBatches();
     this->InitFromCUDA(&ctx, iter, proxy, p, ref, max_quantile_blocks, config);
@@ -71,7 +72,8 @@ BatchSet<ExtSparsePage> ExtMemQuantileDMatrix::GetExtBatches(Context const *, Ba
 void ExtMemQuantileDMatrix::InitFromCPU(
     Context const *ctx,
     std::shared_ptr<DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>> iter,
-    DMatrixHandle proxy_handle, BatchParam const &p, float missing, std::shared_ptr<DMatrix> ref) {
+    DMatrixHandle proxy_handle, BatchParam const &p, float missing, std::shared_ptr<DMatrix> ref,
+    bool compress) {
   xgboost_NVTX_FN_RANGE();
 
   auto proxy = MakeProxy(proxy_handle);
@@ -96,7 +98,10 @@ void ExtMemQuantileDMatrix::InitFromCPU(
    */
   auto id = MakeCache(this, ".gradient_index.page", false, cache_prefix_, &cache_info_);
   this->ghist_index_source_ = std::make_unique<ExtGradientIndexPageSource>(
-      ctx, missing, &this->info_, cache_info_.at(id), p, cuts, iter, proxy, ext_info.base_rowids);
+      ctx, missing, &this->info_, cache_info_.at(id), p, cuts, iter, proxy, ext_info.base_rowids,
+      compress);
+  ConfigureCacheIO(this->io_backend_, this->resident_budget_,
+                   this->ghist_index_source_.get());
 
   /**
    * Force initialize the cache and do some sanity checks along the way
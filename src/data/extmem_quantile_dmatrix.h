@@ -39,7 +39,8 @@ class ExtMemQuantileDMatrix : public QuantileDMatrix {
   void InitFromCPU(
       Context const *ctx,
       std::shared_ptr<DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>> iter,
-      DMatrixHandle proxy, BatchParam const &p, float missing, std::shared_ptr<DMatrix> ref);
+      DMatrixHandle proxy, BatchParam const &p, float missing, std::shared_ptr<DMatrix> ref,
+      bool compress);
   void InitFromCUDA(
       Context const *ctx,
       std::shared_ptr<DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>> iter,
@@ -66,6 +67,9 @@ class ExtMemQuantileDMatrix : public QuantileDMatrix {
   std::map<std::string, std::shared_ptr<Cache>> cache_info_;
   std::string cache_prefix_;
   bool const on_host_;
+  std::string const io_backend_;
+  // Shared by all page sources.
+  std::shared_ptr<ResidentBudget> resident_budget_;
   BatchParam batch_;
   bst_idx_t n_batches_{0};
 
@@ -10,7 +10,9 @@
 #include <utility>    // for move
 
 #include "dmlc/data.h"        // for RowBlock, Parser
+#include "text_parser.h"      // for CreateTextParser
 #include "xgboost/c_api.h"    // for XGDMatrixFree, XGProxyDMatrixCreate
+#include "xgboost/context.h"  // for Context
 
 namespace xgboost::data {
 [[nodiscard]] std::string ValidateFileFormat(std::string const& uri);
@@ -54,7 +56,7 @@ class FileIterator {
   auto Proxy() -> decltype(proxy_) { return proxy_; }
 
   void Reset() {
-    parser_.reset(dmlc::Parser<uint32_t>::Create(uri_.c_str(), part_idx_, n_parts_, "auto"));
+    parser_ = CreateTextParser(uri_, part_idx_, n_parts_, Context{}.Threads());
   }
 };
 
@@ -4,8 +4,10 @@
  */
 #include "gradient_index.h"
 
+#include <algorithm>  // for copy_n
 #include <limits>
 #include <memory>
+#include <numeric>  // for partial_sum
 #include <utility>  // for forward
 
 #include "../common/column_matrix.h"
@@ -56,6 +58,57 @@ GHistIndexMatrix::GHistIndexMatrix(Context const *ctx, DMatrix *p_fmat, bst_bin_
   }
 }
 
+GHistIndexMatrix::GHistIndexMatrix(Context const *ctx, GHistIndexMatrix const &that,
+                                   common::Span<bst_idx_t const> ridxs, double sparse_thresh)
+    : cut{that.cut},
+      max_numeric_bins_per_feat{that.max_numeric_bins_per_feat},
+      base_rowid{0},
+      isDense_{that.IsDense()} {
+  CHECK_EQ(that.base_rowid, 0) << "Slicing is not supported for external memory.";
+  auto n_threads = ctx->Threads();
+  auto n_samples = ridxs.size();
+
+  this->row_ptr = common::MakeFixedVecWithMalloc(n_samples + 1, std::size_t{0});
+  common::ParallelFor(n_samples, n_threads, [&](auto i) {
+    auto ridx = ridxs[i];
+    CHECK_LT(ridx, that.Size());
+    this->row_ptr[i + 1] = that.row_ptr[ridx + 1] - that.row_ptr[ridx];
+  });
+  std::partial_sum(this->row_ptr.cbegin(), this->row_ptr.cend(), this->row_ptr.begin());
+
+  // Use the same bin type as the input.
+  auto bin_type = that.index.GetBinTypeSize();
+  auto n_index = this->row_ptr[n_samples];
+  this->data = common::MakeFixedVecWithMalloc(n_index * bin_type, std::uint8_t{0});
+  this->index =
+      common::Index{common::Span{data.data(), static_cast<size_t>(data.size())}, bin_type};
+  if (this->IsDense()) {
+    this->index.SetBinOffset(this->cut.Ptrs());
+  }
+
+  auto n_bins_total = this->cut.TotalBins();
+  this->hit_count = common::MakeFixedVecWithMalloc(n_bins_total, std::size_t{0});
+  this->hit_count_tloc_.resize(n_threads * n_bins_total, 0);
+  common::DispatchBinType(bin_type, [&](auto t) {
+    using T = decltype(t);
+    auto in = that.index.data<T>();
+    auto out = this->index.data<T>();
+    common::ParallelFor(n_samples, n_threads, [&](auto i) {
+      auto tid = omp_get_thread_num();
+      auto ibegin = that.row_ptr[ridxs[i]];
+      auto n = this->row_ptr[i + 1] - this->row_ptr[i];
+      std::copy_n(in + ibegin, n, out + this->row_ptr[i]);
+      for (std::size_t j = this->row_ptr[i]; j < this->row_ptr[i + 1]; ++j) {
+        this->hit_count_tloc_[tid * n_bins_total + this->index[j]]++;
+      }
+    });
+  });
+  this->GatherHitCount(n_threads, n_bins_total);
+
+  this->columns_ = std::make_unique<common::ColumnMatrix>(*this, sparse_thresh);
+  this->columns_->InitFromGHist(ctx, *this);
+}
+
 GHistIndexMatrix::GHistIndexMatrix(MetaInfo const &info, common::HistogramCuts &&cuts,
                                    bst_bin_t max_bin_per_feat)
     : row_ptr{common::MakeFixedVecWithMalloc(info.num_row_ + 1, std::size_t{0})},
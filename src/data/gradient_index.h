@@ -198,6 +198,16 @@ class GHistIndexMatrix {
                    common::HistogramCuts cuts, bst_bin_t max_bins_per_feat, bool is_dense,
                    double sparse_thresh, std::int32_t n_threads);
   GHistIndexMatrix();  // also for ext mem, empty ctor so that we can read the cache back.
+  /**
+   * @brief Constructor for a row subset of an existing gradient index. The bin index is
+   *        gathered from the input without quantizing the data again.
+   *
+   * @param that          The gradient index to slice from. Must be a single page.
+   * @param ridxs         Row indices of the subset.
+   * @param sparse_thresh Sparse threshold for the column matrix.
+   */
+  GHistIndexMatrix(Context const* ctx, GHistIndexMatrix const& that,
+                   common::Span<bst_idx_t const> ridxs, double sparse_thresh);
 
   /**
    * @brief Push a single batch into the gradient index.
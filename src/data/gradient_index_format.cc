@@ -3,18 +3,82 @@
  */
 #include "gradient_index_format.h"
 
+#include <algorithm>    // for max_element
 #include <cstddef>      // for size_t
-#include <cstdint>      // for uint8_t
+#include <cstdint>      // for uint8_t, uint64_t
 #include <type_traits>  // for underlying_type_t
 #include <vector>       // for vector
 
-#include "../common/hist_util.h"          // for HistogramCuts
-#include "../common/io.h"                 // for AlignedResourceReadStream
-#include "../common/nvtx_utils.h"         // for xgboost_NVTX_FN_RANGE
-#include "../common/ref_resource_view.h"  // for ReadVec, WriteVec
-#include "gradient_index.h"               // for GHistIndexMatrix
+#include "../common/compressed_iterator.h"  // for CompressedBufferWriter, CompressedIterator
+#include "../common/hist_util.h"            // for HistogramCuts, DispatchBinType
+#include "../common/io.h"                   // for AlignedResourceReadStream
+#include "../common/nvtx_utils.h"           // for xgboost_NVTX_FN_RANGE
+#include "../common/ref_resource_view.h"    // for ReadVec, WriteVec, MakeFixedVecWithMalloc
+#include "../common/threading_utils.h"      // for ParallelFor
+#include "gradient_index.h"                 // for GHistIndexMatrix
 
 namespace xgboost::data {
+namespace {
+using BinTypeT = std::underlying_type_t<common::BinTypeSize>;
+// Flag in the bin type byte for a bit-packed index. Bin type sizes are 1, 2, and 4.
+constexpr BinTypeT kPackedFlag = 0x80;
+// Maximum symbol size supported by the compressed buffer writer.
+constexpr std::uint64_t kMaxPackedSymbols = static_cast<std::uint64_t>(1) << 28;
+
+[[nodiscard]] bool ReadPackedIndex(common::BinTypeSize size_type, std::int32_t n_threads,
+                                   GHistIndexMatrix* page, common::AlignedResourceReadStream* fi) {
+  std::uint64_t n_symbols{0}, n_elements{0};
+  if (!fi->Read(&n_symbols) || !fi->Read(&n_elements)) {
+    return false;
+  }
+  common::RefResourceView<common::CompressedByteT> packed;
+  if (!common::ReadVec(fi, &packed)) {
+    return false;
+  }
+  page->data = common::MakeFixedVecWithMalloc(n_elements * size_type, std::uint8_t{0});
+  common::DispatchBinType(size_type, [&](auto t) {
+    using T = decltype(t);
+    auto out = reinterpret_cast<T*>(page->data.data());
+    auto in = common::CompressedIterator<T>{packed.data(), n_symbols};
+    common::ParallelFor(n_elements, n_threads, [&](std::uint64_t i) { out[i] = in[i]; });
+  });
+  return true;
+}
+
+// Number of symbols required for packing the index, the maximum bin plus one.
+[[nodiscard]] std::uint64_t NumSymbols(GHistIndexMatrix const& page) {
+  std::uint64_t n_symbols = 1;
+  common::DispatchBinType(page.index.GetBinTypeSize(), [&](auto t) {
+    using T = decltype(t);
+    auto beg = page.index.data<T>();
+    auto end = beg + page.index.Size();
+    if (beg != end) {
+      n_symbols = static_cast<std::uint64_t>(*std::max_element(beg, end)) + 1;
+    }
+  });
+  return n_symbols;
+}
+
+[[nodiscard]] std::size_t WritePackedIndex(GHistIndexMatrix const& page, std::uint64_t n_symbols,
+                                           common::AlignedFileWriteStream* fo) {
+  CHECK_LE(n_symbols, kMaxPackedSymbols);
+  std::size_t bytes = 0;
+  common::DispatchBinType(page.index.GetBinTypeSize(), [&](auto t) {
+    using T = decltype(t);
+    auto n_elements = static_cast<std::uint64_t>(page.index.Size());
+    auto beg = page.index.data<T>();
+    auto end = beg + n_elements;
+    std::vector<common::CompressedByteT> packed(
+        common::CompressedBufferWriter::CalculateBufferSize(n_elements, n_symbols), 0);
+    common::CompressedBufferWriter{n_symbols}.Write(packed.data(), beg, end);
+    bytes += fo->Write(n_symbols);
+    bytes += fo->Write(n_elements);
+    bytes += common::WriteVec(fo, packed);
+  });
+  return bytes;
+}
+}  // anonymous namespace
+
 [[nodiscard]] bool GHistIndexRawFormat::Read(GHistIndexMatrix* page,
                                              common::AlignedResourceReadStream* fi) {
   xgboost_NVTX_FN_RANGE();
@@ -29,13 +93,18 @@ namespace xgboost::data {
   // data
   // - bin type
   // Old gcc doesn't support reading from enum.
-  std::underlying_type_t<common::BinTypeSize> uint_bin_type{0};
+  BinTypeT uint_bin_type{0};
   if (!fi->Read(&uint_bin_type)) {
     return false;
   }
-  common::BinTypeSize size_type = static_cast<common::BinTypeSize>(uint_bin_type);
+  bool packed = (uint_bin_type & kPackedFlag) != 0;
+  common::BinTypeSize size_type = static_cast<common::BinTypeSize>(uint_bin_type & ~kPackedFlag);
   // - index buffer
-  if (!common::ReadVec(fi, &page->data)) {
+  if (packed) {
+    if (!ReadPackedIndex(size_type, this->n_threads_, page, fi)) {
+      return false;
+    }
+  } else if (!common::ReadVec(fi, &page->data)) {
     return false;
   }
   // - index
@@ -75,13 +144,23 @@ namespace xgboost::data {
 
   // data
   // - bin type
-  std::underlying_type_t<common::BinTypeSize> uint_bin_type = page.index.GetBinTypeSize();
+  BinTypeT uint_bin_type = page.index.GetBinTypeSize();
+  // Pages with more bins than the packed format supports are written in the raw layout.
+  std::uint64_t n_symbols = this->compress_ ? NumSymbols(page) : 0;
+  bool packed = this->compress_ && n_symbols <= kMaxPackedSymbols;
+  if (packed) {
+    uint_bin_type |= kPackedFlag;
+  }
   bytes += fo->Write(uint_bin_type);
   // - index buffer
-  std::vector<std::uint8_t> data(page.index.begin(), page.index.end());
-  bytes += fo->Write(static_cast<std::uint64_t>(data.size()));
-  if (!data.empty()) {
-    bytes += fo->Write(data.data(), data.size());
+  if (packed) {
+    bytes += WritePackedIndex(page, n_symbols, fo);
+  } else {
+    std::vector<std::uint8_t> data(page.index.begin(), page.index.end());
+    bytes += fo->Write(static_cast<std::uint64_t>(data.size()));
+    if (!data.empty()) {
+      bytes += fo->Write(data.data(), data.size());
+    }
   }
 
   // hit count
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t
 #include <utility>  // for move
 
 #include "../common/hist_util.h"  // for HistogramCuts
@@ -16,14 +17,26 @@ class HistogramCuts;
 }
 
 namespace xgboost::data {
+/**
+ * @brief Format for the gradient index page.
+ *
+ *   When `compress` is true, the bin index is bit-packed using the smallest number of
+ *   bits that can represent the maximum bin in the page. The page is unpacked during
+ *   read with `n_threads` threads. Pages with too many bins for packing are written in
+ *   the uncompressed layout, which remains unchanged.
+ */
 class GHistIndexRawFormat : public SparsePageFormat<GHistIndexMatrix> {
   common::HistogramCuts cuts_;
+  bool compress_;
+  std::int32_t n_threads_;
 
  public:
   [[nodiscard]] bool Read(GHistIndexMatrix* page, common::AlignedResourceReadStream* fi) override;
   [[nodiscard]] std::size_t Write(GHistIndexMatrix const& page,
                                   common::AlignedFileWriteStream* fo) override;
 
-  explicit GHistIndexRawFormat(common::HistogramCuts cuts) : cuts_{std::move(cuts)} {}
+  explicit GHistIndexRawFormat(common::HistogramCuts cuts, bool compress = false,
+                               std::int32_t n_threads = 1)
+      : cuts_{std::move(cuts)}, compress_{compress}, n_threads_{n_threads} {}
 };
 }  // namespace xgboost::data
@@ -26,17 +26,25 @@ template <typename S>
 class GHistIndexFormatPolicy {
  protected:
   common::HistogramCuts cuts_;
+  // Whether the bin index should be bit-packed in the cache.
+  bool compress_{false};
+  // Number of threads for unpacking the bin index.
+  std::int32_t n_threads_{1};
 
  public:
   using FormatT = SparsePageFormat<GHistIndexMatrix>;
 
  public:
   [[nodiscard]] auto CreatePageFormat(BatchParam const&) const {
-    std::unique_ptr<FormatT> fmt{new GHistIndexRawFormat{cuts_}};
+    std::unique_ptr<FormatT> fmt{new GHistIndexRawFormat{cuts_, compress_, n_threads_}};
     return fmt;
   }
 
   void SetCuts(common::HistogramCuts cuts) { std::swap(cuts_, cuts); }
+  void SetCompress(bool compress, std::int32_t n_threads) {
+    this->compress_ = compress;
+    this->n_threads_ = n_threads;
+  }
 };
 
 class GradientIndexPageSource
@@ -52,7 +60,7 @@ class GradientIndexPageSource
                           bst_idx_t n_batches, std::shared_ptr<Cache> cache, BatchParam param,
                           common::HistogramCuts cuts, bool is_dense,
                           common::Span<FeatureType const> feature_types,
-                          std::shared_ptr<SparsePageSource> source)
+                          std::shared_ptr<SparsePageSource> source, bool compress)
       : PageSourceIncMixIn(missing, nthreads, n_features, n_batches, cache,
                            std::isnan(param.sparse_thresh)),
         is_dense_{is_dense},
@@ -61,6 +69,7 @@ class GradientIndexPageSource
         sparse_thresh_{param.sparse_thresh} {
     this->source_ = source;
     this->SetCuts(std::move(cuts));
+    this->SetCompress(compress, nthreads);
     if (this->cuts_.HasCategorical()) {
       CHECK(!this->feature_types_.empty());
     }
@@ -86,7 +95,7 @@ class ExtGradientIndexPageSource
       Context const* ctx, float missing, MetaInfo* info, std::shared_ptr<Cache> cache,
       BatchParam param, common::HistogramCuts cuts,
       std::shared_ptr<DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>> source,
-      DMatrixProxy* proxy, std::vector<bst_idx_t> base_rows)
+      DMatrixProxy* proxy, std::vector<bst_idx_t> base_rows, bool compress)
       : ExtQantileSourceMixin{missing, ctx->Threads(), static_cast<bst_feature_t>(info->num_col_),
                               source, cache},
         p_{std::move(param)},
@@ -98,6 +107,7 @@ class ExtGradientIndexPageSource
     this->source_->Reset();
     CHECK(this->source_->Next());
     this->SetCuts(std::move(cuts));
+    this->SetCompress(compress, ctx->Threads());
     this->Fetch();
   }
 
@@ -3,18 +3,24 @@
  */
 #include "iterative_dmatrix.h"
 
-#include <algorithm>  // for copy
-#include <cstddef>    // for size_t
-#include <memory>     // for shared_ptr
-#include <utility>    // for move
-#include <vector>     // for vector
+#include <algorithm>    // for copy
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint32_t, uint64_t
+#include <filesystem>   // for file_size, u8path
+#include <memory>       // for shared_ptr
+#include <string>       // for string
+#include <type_traits>  // for underlying_type_t
+#include <utility>      // for move
+#include <vector>       // for vector
 
 #include "../common/categorical.h"  // for IsCat
 #include "../common/hist_util.h"    // for HistogramCuts
+#include "../common/io.h"           // for AlignedResourceReadStream, PrivateMmapConstStream
 #include "../tree/param.h"          // FIXME(jiamingy): Find a better way to share this parameter.
 #include "batch_utils.h"            // for RegenGHist
 #include "cat_container.h"          // for SyncCategories
 #include "gradient_index.h"         // for GHistIndexMatrix
+#include "gradient_index_format.h"  // for GHistIndexRawFormat
 #include "proxy_dmatrix.h"          // for DataIterProxy, DispatchAny
 #include "quantile_dmatrix.h"       // for GetCutsFromRef
 #include "quantile_dmatrix.h"       // for GetDataShape, MakeSketches
@@ -23,6 +29,11 @@
 #include "xgboost/logging.h"
 
 namespace xgboost::data {
+namespace {
+// Type of the page stored in the binary snapshot.
+enum class QdmPageType : std::uint8_t { kGHist = 0, kEllpack = 1 };
+}  // anonymous namespace
+
 IterativeDMatrix::IterativeDMatrix(DataIterHandle iter_handle, DMatrixHandle proxy,
                                    std::shared_ptr<DMatrix> ref, DataIterResetCallback* reset,
                                    XGDMatrixCallbackNext* next, float missing, int nthread,
@@ -57,6 +68,38 @@ IterativeDMatrix::IterativeDMatrix(DataIterHandle iter_handle, DMatrixHandle pro
             << this->Info().num_col_ << ", " << this->info_.num_nonzero_ << ").";
 }
 
+IterativeDMatrix::IterativeDMatrix(common::HistogramCuts cuts, MetaInfo const& info,
+                                   bst_bin_t max_bin)
+    : proxy_{nullptr} {
+  CHECK_EQ(info.num_row_, 0) << "The reference QuantileDMatrix must be empty.";
+  CHECK_EQ(cuts.NumFeatures(), info.num_col_) << "Inconsistent number of features.";
+  this->info_.num_col_ = info.num_col_;
+  this->info_.feature_types.Resize(info.feature_types.Size());
+  this->info_.feature_types.Copy(info.feature_types);
+  this->info_.feature_type_names = info.feature_type_names;
+
+  this->batch_ = BatchParam{max_bin, tree::TrainParam::DftSparseThreshold()};
+  this->ghist_ = std::make_shared<GHistIndexMatrix>(this->info_, std::move(cuts), max_bin);
+}
+
+IterativeDMatrix::IterativeDMatrix(std::shared_ptr<GHistIndexMatrix> ghist)
+    : ghist_{std::move(ghist)} {}
+
+DMatrix* IterativeDMatrix::Slice(common::Span<std::int32_t const> ridxs) {
+  CHECK(this->ghist_) << "Slicing `QuantileDMatrix` is only supported for CPU inputs.";
+  auto ctx = this->fmat_ctx_.MakeCPU();
+  std::vector<bst_idx_t> h_ridx(ridxs.data(), ridxs.data() + ridxs.size());
+  auto ghist = std::make_shared<GHistIndexMatrix>(&ctx, *this->ghist_, common::Span{h_ridx},
+                                                  tree::TrainParam::DftSparseThreshold());
+  auto nnz = ghist->row_ptr.back();
+  auto out = new IterativeDMatrix{std::move(ghist)};
+  out->info_ = this->Info().Slice(&ctx, h_ridx, nnz);
+  out->info_.Cats()->Copy(&ctx, *this->Info().Cats());
+  out->fmat_ctx_ = this->fmat_ctx_;
+  out->batch_ = this->batch_;
+  return out;
+}
+
 void IterativeDMatrix::InitFromCPU(
     Context const* ctx, BatchParam const& p,
     DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext>&& iter, float missing,
@@ -209,13 +252,105 @@ BatchSet<EllpackPage> IterativeDMatrix::GetEllpackBatches(Context const*, BatchP
   return BatchSet<EllpackPage>(BatchIterator<EllpackPage>(begin_iter));
 }
 
-void IterativeDMatrix::Save(common::AlignedFileWriteStream*) const {
-  LOG(FATAL) << "Not implemented";
+void IterativeDMatrix::SaveEllpack(common::AlignedFileWriteStream*) const {
+  common::AssertGPUSupport();
 }
 
-IterativeDMatrix* IterativeDMatrix::Load(common::AlignedResourceReadStream*) {
-  LOG(FATAL) << "Not implemented";
+std::shared_ptr<EllpackPage> IterativeDMatrix::LoadEllpack(common::AlignedResourceReadStream*) {
+  common::AssertGPUSupport();
   return nullptr;
 }
 #endif  // !defined(XGBOOST_USE_CUDA)
+
+void IterativeDMatrix::Save(common::AlignedFileWriteStream* fo) const {
+  CHECK(fo);
+  CHECK(this->ellpack_ || this->ghist_) << "`QuantileDMatrix` not initialized.";
+  // Prefer the page that's native to the DMatrix.
+  auto type = (this->ellpack_ && (this->fmat_ctx_.IsCUDA() || !this->ghist_))
+                  ? QdmPageType::kEllpack
+                  : QdmPageType::kGHist;
+
+  CHECK_GE(fo->Write(kMagic), sizeof(kMagic));
+  CHECK_GE(fo->Write(kFormatVersion), sizeof(kFormatVersion));
+  CHECK_GE(fo->Write(static_cast<std::underlying_type_t<QdmPageType>>(type)), sizeof(type));
+  CHECK_GE(fo->Write(this->batch_.max_bin), sizeof(this->batch_.max_bin));
+
+  // Meta info is small compared to the gradient index, it's stored with the legacy binary
+  // format and copied during load.
+  std::string info_buf;
+  common::MemoryBufferStream info_fo{&info_buf};
+  this->Info().SaveBinary(&info_fo);
+  CHECK_GE(fo->Write(static_cast<std::uint64_t>(info_buf.size())), sizeof(std::uint64_t));
+  CHECK_GE(fo->Write(info_buf.data(), info_buf.size()), info_buf.size());
+
+  switch (type) {
+    case QdmPageType::kGHist: {
+      this->ghist_->cut.Save(fo);
+      GHistIndexRawFormat fmt{this->ghist_->cut};
+      auto n_bytes = fmt.Write(*this->ghist_, fo);
+      CHECK_GE(n_bytes, this->ghist_->row_ptr.size_bytes());
+      break;
+    }
+    case QdmPageType::kEllpack: {
+      this->SaveEllpack(fo);
+      break;
+    }
+  }
+}
+
+IterativeDMatrix* IterativeDMatrix::Load(common::AlignedResourceReadStream* fi) {
+  CHECK(fi);
+  std::uint32_t magic{0};
+  CHECK(fi->Read(&magic) && magic == kMagic)
+      << "Invalid `QuantileDMatrix` snapshot, magic number mismatch.";
+  std::uint32_t version{0};
+  CHECK(fi->Read(&version));
+  CHECK_EQ(version, kFormatVersion) << "Unsupported `QuantileDMatrix` snapshot version.";
+  std::underlying_type_t<QdmPageType> type{0};
+  CHECK(fi->Read(&type));
+  bst_bin_t max_bin{0};
+  CHECK(fi->Read(&max_bin));
+
+  std::uint64_t n_info_bytes{0};
+  CHECK(fi->Read(&n_info_bytes));
+  auto [info_ptr, info_bytes] = fi->Consume(n_info_bytes);
+  CHECK_EQ(info_bytes, n_info_bytes) << "Invalid `QuantileDMatrix` snapshot, truncated file.";
+  common::MemoryFixSizeBuffer info_fi{info_ptr, info_bytes};
+  MetaInfo info;
+  info.LoadBinary(&info_fi);
+
+  std::unique_ptr<IterativeDMatrix> p_fmat;
+  switch (static_cast<QdmPageType>(type)) {
+    case QdmPageType::kGHist: {
+      std::unique_ptr<common::HistogramCuts> p_cuts{common::HistogramCuts::Load(fi)};
+      GHistIndexRawFormat fmt{std::move(*p_cuts)};
+      auto ghist = std::make_shared<GHistIndexMatrix>();
+      CHECK(fmt.Read(ghist.get(), fi)) << "Invalid `QuantileDMatrix` snapshot, truncated file.";
+      p_fmat.reset(new IterativeDMatrix{std::move(ghist)});
+      break;
+    }
+    case QdmPageType::kEllpack: {
+      p_fmat.reset(new IterativeDMatrix{LoadEllpack(fi)});
+      break;
+    }
+    default:
+      LOG(FATAL) << "Invalid `QuantileDMatrix` snapshot, unknown page type: "
+                 << static_cast<std::int32_t>(type);
+  }
+
+  p_fmat->info_ = std::move(info);
+  p_fmat->batch_ = BatchParam{max_bin, tree::TrainParam::DftSparseThreshold()};
+  return p_fmat.release();
+}
+
+IterativeDMatrix* IterativeDMatrix::Load(StringView path, std::int32_t n_threads) {
+  auto fs_path = std::filesystem::u8path(std::string{path});
+  auto n_bytes = std::filesystem::file_size(fs_path);
+  auto fi = std::make_unique<common::PrivateMmapConstStream>(path, 0, n_bytes);
+  auto p_fmat = Load(fi.get());
+  if (p_fmat->ghist_) {
+    p_fmat->fmat_ctx_.Init(Args{{"nthread", std::to_string(n_threads)}});
+  }
+  return p_fmat;
+}
 }  // namespace xgboost::data
@@ -142,9 +142,9 @@ BatchSet<EllpackPage> IterativeDMatrix::GetEllpackBatches(Context const* ctx,
   return BatchSet<EllpackPage>(begin_iter);
 }
 
-void IterativeDMatrix::Save(common::AlignedFileWriteStream* fo) const {
+void IterativeDMatrix::SaveEllpack(common::AlignedFileWriteStream* fo) const {
   CHECK(fo);
-  CHECK(this->ellpack_) << "Not implemented";
+  CHECK(this->ellpack_);
   // Save cuts
   auto const& p_cuts = this->ellpack_->Impl()->CutsShared();
   p_cuts->Save(fo);
@@ -155,7 +155,7 @@ void IterativeDMatrix::Save(common::AlignedFileWriteStream* fo) const {
   CHECK_GE(n_bytes, this->ellpack_->Impl()->MemCostBytes());
 }
 
-IterativeDMatrix* IterativeDMatrix::Load(common::AlignedResourceReadStream* fi) {
+std::shared_ptr<EllpackPage> IterativeDMatrix::LoadEllpack(common::AlignedResourceReadStream* fi) {
   CHECK(fi);
   // Load cuts
   std::shared_ptr<common::HistogramCuts> p_cuts{common::HistogramCuts::Load(fi)};
@@ -164,6 +164,6 @@ IterativeDMatrix* IterativeDMatrix::Load(common::AlignedResourceReadStream* fi)
                                                     BatchParam{}, false);
   auto ellpack = std::make_shared<EllpackPage>();
   CHECK(fmt->Read(ellpack.get(), fi));
-  return new IterativeDMatrix{std::move(ellpack)};
+  return ellpack;
 }
 }  // namespace xgboost::data
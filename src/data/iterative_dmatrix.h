@@ -6,6 +6,7 @@
 #ifndef XGBOOST_DATA_ITERATIVE_DMATRIX_H_
 #define XGBOOST_DATA_ITERATIVE_DMATRIX_H_
 
+#include <cstdint>  // for uint32_t
 #include <memory>   // for shared_ptr
 #include <utility>  // for move
 
@@ -14,6 +15,7 @@
 #include "xgboost/c_api.h"        // for DataIterHandle, DMatrixHandle
 #include "xgboost/context.h"      // for Context
 #include "xgboost/data.h"         // for BatchSet
+#include "xgboost/string_view.h"  // for StringView
 
 namespace xgboost {
 namespace common {
@@ -36,7 +38,7 @@ class IterativeDMatrix : public QuantileDMatrix {
   std::shared_ptr<GHistIndexMatrix> ghist_;
   BatchParam batch_;
 
-  DMatrixHandle proxy_;
+  DMatrixHandle proxy_{nullptr};
 
   void InitFromCUDA(Context const *ctx, BatchParam const &p, std::int64_t max_quantile_blocks,
                     DataIterProxy<DataIterResetCallback, XGDMatrixCallbackNext> &&iter,
@@ -48,6 +50,12 @@ class IterativeDMatrix : public QuantileDMatrix {
   explicit IterativeDMatrix(std::shared_ptr<EllpackPage> ellpack) : ellpack_{std::move(ellpack)} {
     this->fmat_ctx_.UpdateAllowUnknown(Args{{"device", DeviceSym::CUDA()}});
   }
+  explicit IterativeDMatrix(std::shared_ptr<GHistIndexMatrix> ghist);
+
+  // Ellpack IO, defined in the CUDA source.
+  void SaveEllpack(common::AlignedFileWriteStream *fo) const;
+  [[nodiscard]] static std::shared_ptr<EllpackPage> LoadEllpack(
+      common::AlignedResourceReadStream *fi);
 
  public:
   explicit IterativeDMatrix(DataIterHandle iter_handle, DMatrixHandle proxy,
@@ -58,18 +66,62 @@ class IterativeDMatrix : public QuantileDMatrix {
    * @param Directly construct a QDM from an existing one.
    */
   IterativeDMatrix(std::shared_ptr<EllpackPage> ellpack, MetaInfo const &info, BatchParam batch);
+  /**
+   * @brief Create an empty QDM that holds only the quantile cuts. It's used as the
+   *        reference for constructing other QDMs without sketching.
+   *
+   * @param cuts    Quantile cuts, usually stored in a booster.
+   * @param info    Meta info providing the number of features and the feature types.
+   * @param max_bin The `max_bin` used to generate the cuts.
+   */
+  IterativeDMatrix(common::HistogramCuts cuts, MetaInfo const &info, bst_bin_t max_bin);
 
   ~IterativeDMatrix() override = default;
 
   [[nodiscard]] bool EllpackExists() const override { return static_cast<bool>(ellpack_); }
   [[nodiscard]] bool GHistIndexExists() const override { return static_cast<bool>(ghist_); }
 
+  /**
+   * @brief Create a row subset of the QDM, used for cross validation. The quantile cuts
+   *        are reused and the histogram index is gathered from this QDM without
+   *        quantizing the data again. Only the CPU histogram index is supported.
+   *
+   *   The result is not a view. It owns a copy of the bin index for the selected rows
+   *   and a new column matrix, a k-fold cross validation holds about k times the
+   *   histogram index of this QDM.
+   */
+  DMatrix *Slice(common::Span<std::int32_t const> ridxs) override;
+
   BatchSet<GHistIndexMatrix> GetGradientIndex(Context const *ctx, BatchParam const &param) override;
   BatchSet<EllpackPage> GetEllpackBatches(Context const *ctx, const BatchParam &param) override;
   BatchSet<ExtSparsePage> GetExtBatches(Context const *ctx, BatchParam const &param) override;
 
+  /**
+   * @brief Magic number for the binary snapshot of the QDM.
+   */
+  static constexpr std::uint32_t kMagic = 0xffffab03;
+  /**
+   * @brief Version of the binary snapshot format, bump it when the layout changes.
+   */
+  static constexpr std::uint32_t kFormatVersion = 1;
+  /**
+   * @brief Save the QDM into a binary snapshot.
+   *
+   * Layout: magic, format version, page type, max_bin, `MetaInfo`, then the page with
+   * its cuts. All sections are aligned to `common::IOAlignment()` so that the snapshot
+   * can be memory mapped and used in-place by @ref Load.
+   */
   void Save(common::AlignedFileWriteStream *fo) const;
+  /**
+   * @brief Load a QDM from a binary snapshot. The histogram index and the column matrix
+   *        reference the resource held by the input stream without copying.
+   */
   [[nodiscard]] static IterativeDMatrix *Load(common::AlignedResourceReadStream *fi);
+  /**
+   * @brief Load a QDM from a snapshot file with mmap. The pages are shared between
+   *        processes loading the same file through the OS page cache.
+   */
+  [[nodiscard]] static IterativeDMatrix *Load(StringView path, std::int32_t n_threads);
 };
 }  // namespace data
 }  // namespace xgboost
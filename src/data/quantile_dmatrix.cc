@@ -3,11 +3,14 @@
  */
 #include "quantile_dmatrix.h"
 
-#include <numeric>  // for accumulate
+#include <memory>       // for unique_ptr, make_unique
+#include <numeric>      // for accumulate
+#include <type_traits>  // for remove_reference_t
 
 #include "../collective/allreduce.h"         // for Allreduce
 #include "../collective/communicator-inl.h"  // for IsDistributed
 #include "../common/error_msg.h"             // for InconsistentCategories
+#include "../common/quantile.h"              // for HostSketchContainer, SortSketchContainer
 #include "../common/threading_utils.h"       // for ParallelFor
 #include "proxy_dmatrix.h"                   // for DispatchAny
 #include "cat_container.h"                   // for CatContainer
@@ -151,20 +154,17 @@ void MakeSketches(Context const* ctx,
                   DMatrixProxy* proxy, std::shared_ptr<DMatrix> ref, float missing,
                   common::HistogramCuts* cuts, BatchParam const& p, MetaInfo const& info,
                   ExternalDataInfo const& ext_info, std::vector<FeatureType>* p_h_ft) {
-  std::unique_ptr<common::HostSketchContainer> p_sketch;
   auto& h_ft = *p_h_ft;
   bst_idx_t accumulated_rows = 0;
-  if (ref) {
-    GetCutsFromRef(ctx, ref, info.num_col_, p, cuts);
-    h_ft = ref->Info().feature_types.HostVector();
-  } else {
+  auto push_batches = [&](auto& p_sketch) {
+    using Container = typename std::remove_reference_t<decltype(p_sketch)>::element_type;
     size_t i = 0;
     while (iter->Next()) {
       if (!p_sketch) {
         h_ft = proxy->Info().feature_types.ConstHostVector();
         cpu_impl::SyncFeatureType(ctx, &h_ft);
-        p_sketch = std::make_unique<common::HostSketchContainer>(
-            ctx, p.max_bin, h_ft, ext_info.column_sizes, !proxy->Info().group_ptr_.empty());
+        p_sketch = std::make_unique<Container>(ctx, p.max_bin, h_ft, ext_info.column_sizes,
+                                               !proxy->Info().group_ptr_.empty());
       }
       DispatchAny(proxy, [&](auto const& batch) {
         proxy->Info().num_nonzero_ = ext_info.batch_nnz[i];
@@ -180,6 +180,17 @@ void MakeSketches(Context const* ctx,
 
     CHECK(p_sketch);
     p_sketch->MakeCuts(ctx, info, cuts);
+  };
+
+  if (ref) {
+    GetCutsFromRef(ctx, ref, info.num_col_, p, cuts);
+    h_ft = ref->Info().feature_types.HostVector();
+  } else if (common::UseSortSketch()) {
+    std::unique_ptr<common::SortSketchContainer> p_sketch;
+    push_batches(p_sketch);
+  } else {
+    std::unique_ptr<common::HostSketchContainer> p_sketch;
+    push_batches(p_sketch);
   }
 
   if (!h_ft.empty()) {
@@ -37,7 +37,7 @@ class QuantileDMatrix : public DMatrix {
   }
 
  public:
-  DMatrix *Slice(common::Span<std::int32_t const>) final {
+  DMatrix *Slice(common::Span<std::int32_t const>) override {
     LOG(FATAL) << "Slicing DMatrix is not supported for external memory.";
     return nullptr;
   }
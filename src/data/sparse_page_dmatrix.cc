@@ -35,7 +35,10 @@ SparsePageDMatrix::SparsePageDMatrix(DataIterHandle iter_handle, DMatrixHandle p
       cache_prefix_{config.cache},
       on_host_{config.on_host},
       cache_host_ratio_{config.cache_host_ratio},
-      min_cache_page_bytes_{config.min_cache_page_bytes} {
+      min_cache_page_bytes_{config.min_cache_page_bytes},
+      compress_cache_{config.compress_cache},
+      io_backend_{config.io_backend},
+      resident_budget_{std::make_shared<ResidentBudget>(config.resident_cache_bytes)} {
   CHECK(detail::HostRatioIsAuto(config.cache_host_ratio)) << error::CacheHostRatioNotImpl();
   Context ctx;
   ctx.Init(Args{{"nthread", std::to_string(config.n_threads)}});
@@ -117,6 +120,7 @@ void SparsePageDMatrix::InitializeSparsePage(Context const *ctx) {
   sparse_page_source_ = std::make_shared<SparsePageSource>(
       std::move(iter), proxy, this->missing_, ctx->Threads(), this->info_.num_col_,
       this->ext_info_.n_batches, cache_info_.at(id));
+  ConfigureCacheIO(this->io_backend_, this->resident_budget_, sparse_page_source_.get());
 }
 
 BatchSet<SparsePage> SparsePageDMatrix::GetRowBatchesImpl(Context const *ctx) {
@@ -137,6 +141,7 @@ BatchSet<CSCPage> SparsePageDMatrix::GetColumnBatches(Context const *ctx) {
     column_source_ = std::make_shared<CSCPageSource>(this->missing_, ctx->Threads(),
                                                      this->Info().num_col_, this->NumBatches(),
                                                      cache_info_.at(id), sparse_page_source_);
+    ConfigureCacheIO(this->io_backend_, this->resident_budget_, column_source_.get());
   } else {
     column_source_->Reset({});
   }
@@ -151,6 +156,7 @@ BatchSet<SortedCSCPage> SparsePageDMatrix::GetSortedColumnBatches(Context const
     sorted_column_source_ = std::make_shared<SortedCSCPageSource>(
         this->missing_, ctx->Threads(), this->Info().num_col_, this->NumBatches(),
         cache_info_.at(id), sparse_page_source_);
+    ConfigureCacheIO(this->io_backend_, this->resident_budget_, sorted_column_source_.get());
   } else {
     sorted_column_source_->Reset({});
   }
@@ -180,7 +186,9 @@ BatchSet<GHistIndexMatrix> SparsePageDMatrix::GetGradientIndex(Context const *ct
     auto ft = this->info_.feature_types.ConstHostSpan();
     ghist_index_source_.reset(new GradientIndexPageSource(
         this->missing_, ctx->Threads(), this->Info().num_col_, this->NumBatches(),
-        cache_info_.at(id), param, std::move(cuts), this->IsDense(), ft, sparse_page_source_));
+        cache_info_.at(id), param, std::move(cuts), this->IsDense(), ft, sparse_page_source_,
+        this->compress_cache_));
+    ConfigureCacheIO(this->io_backend_, this->resident_budget_, ghist_index_source_.get());
   } else {
     CHECK(ghist_index_source_);
     ghist_index_source_->Reset(param);
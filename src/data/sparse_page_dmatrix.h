@@ -76,6 +76,10 @@ class SparsePageDMatrix : public DMatrix {
   bool const on_host_;
   float const cache_host_ratio_;
   std::int64_t const min_cache_page_bytes_;
+  bool const compress_cache_;
+  std::string const io_backend_;
+  // Shared by all page sources.
+  std::shared_ptr<ResidentBudget> resident_budget_;
   ExternalDataInfo ext_info_;
 
   // sparse page is the source to other page types, we make a special member function.
@@ -115,6 +119,10 @@ class SparsePageDMatrix : public DMatrix {
   [[nodiscard]] auto SparsePageFetchCount() const {
     return this->sparse_page_source_->FetchCount();
   }
+  // For testing, getter for the I/O statistics of the sparse page source.
+  [[nodiscard]] auto SparsePageIOStats() const { return this->sparse_page_source_->GetIOStats(); }
+  // Number of bytes held by resident pages of all sources.
+  [[nodiscard]] std::int64_t ResidentBytes() const { return this->resident_budget_->Used(); }
 
  private:
   BatchSet<SparsePage> GetRowBatches() override;
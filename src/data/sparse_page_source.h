@@ -1,27 +1,30 @@
 /**
- *  Copyright 2014-2024, XGBoost Contributors
+ *  Copyright 2014-2025, XGBoost Contributors
  * \file sparse_page_source.h
  */
 #ifndef XGBOOST_DATA_SPARSE_PAGE_SOURCE_H_
 #define XGBOOST_DATA_SPARSE_PAGE_SOURCE_H_
 
-#include <algorithm>  // for min
-#include <atomic>     // for atomic
-#include <cstdint>    // for uint64_t
-#include <future>     // for future
-#include <limits>     // for numeric_limits
-#include <map>        // for map
-#include <memory>     // for unique_ptr
-#include <mutex>      // for mutex
-#include <string>     // for string
-#include <utility>    // for pair, move
-#include <vector>     // for vector
+#include <algorithm>    // for min
+#include <atomic>       // for atomic
+#include <chrono>       // for duration_cast, nanoseconds
+#include <cstdint>      // for uint64_t
+#include <cstring>      // for memcpy
+#include <future>       // for future
+#include <limits>       // for numeric_limits
+#include <map>          // for map
+#include <memory>       // for unique_ptr
+#include <mutex>        // for mutex, lock_guard
+#include <string>       // for string
+#include <type_traits>  // for is_same_v
+#include <utility>      // for pair, move
+#include <vector>       // for vector
 
 #if !defined(XGBOOST_USE_CUDA)
 #include "../common/common.h"  // for AssertGPUSupport
 #endif                         // !defined(XGBOOST_USE_CUDA)
 
-#include "../common/io.h"           // for PrivateMmapConstStream
+#include "../common/io.h"           // for PrivateMmapConstStream, PreadFileReadStream
 #include "../common/threadpool.h"   // for ThreadPool
 #include "../common/timer.h"        // for Monitor, Timer
 #include "proxy_dmatrix.h"          // for DMatrixProxy
@@ -191,9 +194,14 @@ std::unique_ptr<WriterT> DftCreateWriterImpl(StringView name, std::uint32_t iter
 
 /**
  * @brief Default implementation of the stream creater.
+ *
+ *   Pages are read using mmap by default. Optionally, they can be loaded eagerly with
+ *   large `pread` calls.
  */
 template <typename S, template <typename> typename F>
 class DefaultFormatStreamPolicy : public F<S> {
+  bool pread_{false};
+
  public:
   using WriterT = common::AlignedFileWriteStream;
   using ReaderT = common::AlignedResourceReadStream;
@@ -205,8 +213,13 @@ class DefaultFormatStreamPolicy : public F<S> {
 
   std::unique_ptr<ReaderT> CreateReader(StringView name, std::uint64_t offset,
                                         std::uint64_t length) const {
+    if (this->pread_) {
+      return std::make_unique<common::PreadFileReadStream>(std::string{name}, offset, length);
+    }
     return std::make_unique<common::PrivateMmapConstStream>(std::string{name}, offset, length);
   }
+
+  void SetPread(bool pread) { this->pread_ = pread; }
 };
 
 template <typename S, template <typename> typename F>
@@ -226,6 +239,56 @@ class MemBufFileReadFormatStreamPolicy : public F<S> {
   }
 };
 
+/**
+ * @brief Host memory budget for resident pages, shared by all page sources of a DMatrix.
+ */
+class ResidentBudget {
+  std::int64_t const limit_;
+  std::atomic<std::int64_t> n_bytes_{0};
+
+ public:
+  explicit ResidentBudget(std::int64_t limit) : limit_{limit} { CHECK_GE(limit, 0); }
+  /**
+   * @brief Reserve n_bytes from the budget.
+   *
+   * @return Whether the bytes fit in the remaining budget.
+   */
+  [[nodiscard]] bool Reserve(std::int64_t n_bytes) {
+    auto cur = this->n_bytes_.load();
+    do {
+      if (cur + n_bytes > this->limit_) {
+        return false;
+      }
+    } while (!this->n_bytes_.compare_exchange_weak(cur, cur + n_bytes));
+    return true;
+  }
+  void Release(std::int64_t n_bytes) { this->n_bytes_ -= n_bytes; }
+
+  [[nodiscard]] std::int64_t Limit() const { return this->limit_; }
+  [[nodiscard]] std::int64_t Used() const { return this->n_bytes_.load(); }
+};
+
+/**
+ * @brief Configure how a page source using the default stream policy reads the cache,
+ *        see @ref ExtMemConfig.
+ *
+ *   The `pread` backend loads each page with large reads into memory buffers instead of
+ *   relying on page faults, and allows the prefetch depth to grow when the caller is
+ *   stalled by I/O.
+ *
+ * @param budget Host memory budget for keeping pages resident, shared with the other
+ *               sources of the same DMatrix.
+ */
+template <typename Source>
+void ConfigureCacheIO(std::string const& backend, std::shared_ptr<ResidentBudget> budget,
+                      Source* source) {
+  if (backend == "pread") {
+    source->SetPread(true);
+    source->SetDeepPrefetch();
+  }
+  source->SetResidentBudget(std::move(budget));
+}
+
 /**
  * @brief Default implementatioin of the format creator.
  */
@@ -271,6 +334,27 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
   std::uint32_t count_{0};
   // How we pre-fetch the data.
   BatchParam param_;
+  // The current number of pages being prefetched, adapted to the I/O and compute time.
+  std::int32_t n_prefetches_{0};
+  // Upper bound of the prefetch depth, 0 if it's specified by the batch parameter.
+  std::int32_t max_prefetches_{0};
+  // I/O counters, updated by the prefetch workers.
+  std::atomic<std::uint64_t> n_read_bytes_{0};
+  std::atomic<std::uint64_t> read_ns_{0};
+  // Serialized pages kept in the host memory, indexed by the page index.
+  std::vector<std::shared_ptr<common::ResourceHandler>> resident_;
+  std::mutex resident_lock_;
+  std::shared_ptr<ResidentBudget> resident_budget_;
+  // Number of bytes held by this source, the budget is shared with other sources.
+  std::int64_t resident_bytes_{0};
+  // Whether each page in the ring is loaded from a resident page.
+  std::vector<bool> is_resident_;
+  std::uint64_t n_hits_{0};
+  std::uint64_t n_misses_{0};
+  // Time spent by the caller waiting for pages and processing pages.
+  common::Timer::DurationT wait_{common::Timer::DurationT::zero()};
+  common::Timer::DurationT compute_{common::Timer::DurationT::zero()};
+  common::Timer::TimePointT last_page_;
 
   std::shared_ptr<Cache> cache_info_;
 
@@ -293,12 +377,15 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
       ring_->resize(n_batches);
     }
 
-    std::int32_t n_prefetches =
-        std::min(this->workers_.NumWorkers(), this->param_.n_prefetch_batches);
-    n_prefetches = std::max(n_prefetches, 1);
-    std::int32_t n_prefetch_batches = std::min(static_cast<bst_idx_t>(n_prefetches), n_batches);
+    auto max_prefetches = this->MaxPrefetches();
+    if (this->n_prefetches_ == 0) {
+      this->n_prefetches_ =
+          std::max(std::min(this->workers_.NumWorkers(), this->param_.n_prefetch_batches), 1);
+    }
+    CHECK_LE(this->n_prefetches_, max_prefetches);
+    std::int32_t n_prefetch_batches =
+        std::min(static_cast<bst_idx_t>(this->n_prefetches_), n_batches);
     CHECK_GT(n_prefetch_batches, 0);
-    CHECK_LE(n_prefetch_batches, this->param_.n_prefetch_batches);
     std::size_t fetch_it = this->count_;
 
     exce_.Rethrow();
@@ -320,15 +407,39 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
         this->param_.prefetch_copy = true;
       }
       auto p = this->param_;
-      ring_->at(fetch_it) = this->workers_.Submit([fetch_it, self, p, this] {
+      std::shared_ptr<common::ResourceHandler> resident;
+      if constexpr (kSupportResident) {
+        resident = this->FindResident(fetch_it);
+      }
+      this->is_resident_.resize(n_batches, false);
+      this->is_resident_[fetch_it] = static_cast<bool>(resident);
+      ring_->at(fetch_it) = this->workers_.Submit([fetch_it, self, p, resident, this] {
         auto page = std::make_shared<S>();
         this->exce_.Run([&] {
+          common::Timer timer;
           std::unique_ptr<typename FormatStreamPolicy::FormatT> fmt{self->CreatePageFormat(p)};
           auto name = self->cache_info_->ShardName();
           auto [offset, length] = self->cache_info_->View(fetch_it);
-          std::unique_ptr<typename FormatStreamPolicy::ReaderT> fi{
-              self->CreateReader(name, offset, length)};
+          std::unique_ptr<typename FormatStreamPolicy::ReaderT> fi;
+          if constexpr (kSupportResident) {
+            if (resident) {
+              fi = std::make_unique<common::AlignedResourceReadStream>(resident);
+              CHECK(fmt->Read(page.get(), fi.get()));
+              return;
+            }
+          }
+          fi = self->CreateReader(name, offset, length);
+          if constexpr (kSupportResident) {
+            auto resident = this->Admit(fetch_it, fi.get());
+            if (resident) {
+              fi = std::make_unique<common::AlignedResourceReadStream>(resident);
+            }
+          }
           CHECK(fmt->Read(page.get(), fi.get()));
+          timer.Stop();
+          this->n_read_bytes_ += length;
+          this->read_ns_ +=
+              std::chrono::duration_cast<std::chrono::nanoseconds>(timer.elapsed).count();
         });
         return page;
       });
@@ -339,16 +450,118 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
              n_prefetch_batches)
         << "Sparse DMatrix assumes forward iteration.";
 
+    // Report the cache hit rate by timing the wait for resident and non-resident pages.
+    bool is_resident = this->is_resident_.at(count_);
+    auto hit_label = is_resident ? "Wait-ResidentHit" : "Wait-ResidentMiss";
+    if (this->HasResidentBudget()) {
+      monitor_.Start(hit_label);
+    }
     monitor_.Start("Wait-" + std::to_string(count_));
     CHECK((*ring_)[count_].valid());
+    auto wait_start = common::Timer::ClockT::now();
     page_ = (*ring_)[count_].get();
+    auto now = common::Timer::ClockT::now();
     monitor_.Stop("Wait-" + std::to_string(count_));
+    if (this->HasResidentBudget()) {
+      monitor_.Stop(hit_label);
+    }
+    if (is_resident) {
+      this->n_hits_++;
+    } else {
+      this->n_misses_++;
+    }
 
     exce_.Rethrow();
 
+    this->AdaptPrefetch(now - wait_start, now);
     return true;
   }
 
+  // Only the streams backed by a resource can be kept in the host memory.
+  static constexpr bool kSupportResident =
+      std::is_same_v<typename FormatStreamPolicy::ReaderT, common::AlignedResourceReadStream>;
+
+  [[nodiscard]] bool HasResidentBudget() const {
+    return this->resident_budget_ && this->resident_budget_->Limit() > 0;
+  }
+
+  [[nodiscard]] std::shared_ptr<common::ResourceHandler> FindResident(std::size_t i) {
+    std::lock_guard<std::mutex> guard{this->resident_lock_};
+    if (i < this->resident_.size()) {
+      return this->resident_[i];
+    }
+    return nullptr;
+  }
+  /**
+   * @brief Keep the page in the host memory if it fits in the budget.
+   *
+   *   Pages are accessed in a cyclic scan. Evicting the least recently used page means
+   *   evicting the page that's needed next, hence no page is evicted once admitted. The
+   *   first pages that fit in the budget remain resident, the rest are read from disk in
+   *   every iteration.
+   *
+   *   The bytes are reserved from the budget before copying, the copy is made without
+   *   holding the lock to not block the other prefetch workers.
+   *
+   * @return The resident copy of the page, null if the page is not admitted.
+   */
+  [[nodiscard]] std::shared_ptr<common::ResourceHandler> Admit(
+      std::size_t i, common::AlignedResourceReadStream* fi) {
+    auto res = fi->Share();
+    auto n_bytes = static_cast<std::int64_t>(res->Size());
+    {
+      std::lock_guard<std::mutex> guard{this->resident_lock_};
+      if (i < this->resident_.size() && this->resident_[i]) {
+        return this->resident_[i];
+      }
+    }
+    if (!this->HasResidentBudget() || !this->resident_budget_->Reserve(n_bytes)) {
+      return nullptr;
+    }
+    if (res->Type() != common::ResourceHandler::kMalloc) {
+      // Copy the page out of the mmap, which is backed by the disk.
+      auto copy = std::make_shared<common::MallocResource>(res->Size());
+      std::memcpy(copy->Data(), res->Data(), res->Size());
+      res = copy;
+    }
+    std::lock_guard<std::mutex> guard{this->resident_lock_};
+    if (this->resident_.size() <= i) {
+      this->resident_.resize(i + 1);
+    }
+    if (this->resident_[i]) {
+      // Admitted by another worker in the meantime.
+      this->resident_budget_->Release(n_bytes);
+      return this->resident_[i];
+    }
+    this->resident_[i] = res;
+    this->resident_bytes_ += n_bytes;
+    return res;
+  }
+
+  [[nodiscard]] std::int32_t MaxPrefetches() const {
+    auto n = this->max_prefetches_ == 0 ? this->param_.n_prefetch_batches : this->max_prefetches_;
+    return std::max(std::min(this->workers_.NumWorkers(), n), 1);
+  }
+  /**
+   * @brief Increase the prefetch depth if the caller is stalled by I/O.
+   *
+   *   The compute time is the duration between two page requests, excluding the time
+   *   waiting for the page. If waiting takes a significant portion of the compute time,
+   *   the pages are not prefetched early enough. The depth is never decreased within an
+   *   iteration as the ring assumes forward iteration.
+   */
+  void AdaptPrefetch(common::Timer::DurationT wait, common::Timer::TimePointT now) {
+    if (this->count_ != 0) {
+      auto compute = (now - this->last_page_) - wait;
+      this->compute_ += compute;
+      if (wait * 10 > compute && this->n_prefetches_ < this->MaxPrefetches()) {
+        this->n_prefetches_++;
+      }
+    }
+    this->wait_ += wait;
+    this->last_page_ = now;
+  }
+
   void WriteCache() {
     CHECK(!cache_info_->written);
     common::Timer timer;
@@ -391,6 +604,10 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
         fu.get();
       }
     }
+    // Return the resident pages to the shared budget.
+    if (this->resident_budget_) {
+      this->resident_budget_->Release(this->resident_bytes_);
+    }
   }
 
   [[nodiscard]] std::uint32_t Iter() const { return count_; }
@@ -409,6 +626,17 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
   }
   // Call this at the last iteration (it == n_batches).
   virtual void EndIter() {
+    if (this->n_read_bytes_ != 0) {
+      auto read_sec = static_cast<double>(this->read_ns_) / 1e9;
+      LOG(DEBUG) << common::HumanMemUnit(this->n_read_bytes_) << " read in " << read_sec
+                 << " seconds, waited " << common::Timer::SecondsT{this->wait_}.count()
+                 << " seconds, prefetch depth: " << this->n_prefetches_ << ".";
+    }
+    if (this->HasResidentBudget()) {
+      auto n_fetches = std::max(this->n_hits_ + this->n_misses_, static_cast<std::uint64_t>(1));
+      LOG(DEBUG) << "Resident pages: " << common::HumanMemUnit(this->resident_bytes_)
+                 << ", hit rate: " << static_cast<double>(this->n_hits_) / n_fetches << ".";
+    }
     this->cache_info_->Commit();
     if (this->cache_info_->Size() != 0) {
       CHECK_EQ(this->count_, this->cache_info_->Size());
@@ -431,11 +659,57 @@ class SparsePageSourceImpl : public BatchIteratorImpl<S>, public FormatStreamPol
     if (!at_end || changed) {
       // The last iteration did not get to the end, clear the ring to start from 0.
       this->ring_ = std::make_unique<Ring>();
+      this->n_prefetches_ = 0;
     }
     this->Fetch();  // Get the 0^th page, prefetch the next page.
   }
 
   [[nodiscard]] auto FetchCount() const { return this->fetch_cnt_; }
+  /**
+   * @brief Allow the prefetch depth to grow up to the number of workers when the caller
+   *        is stalled by I/O.
+   */
+  void SetDeepPrefetch() { this->max_prefetches_ = this->workers_.NumWorkers(); }
+  /**
+   * @brief Set the budget for serialized pages that can be kept in the host memory to
+   *        avoid reading them from disk again.
+   */
+  void SetResidentBudget(std::shared_ptr<ResidentBudget> budget) {
+    CHECK(budget);
+    CHECK_EQ(this->resident_bytes_, 0);
+    this->resident_budget_ = std::move(budget);
+  }
+
+  struct IOStats {
+    // Number of bytes read from the cache.
+    std::uint64_t n_read_bytes;
+    // Accumulated time used by the prefetch workers for reading pages.
+    double read_sec;
+    // Time the caller spent waiting for pages.
+    double wait_sec;
+    // Time the caller spent processing pages.
+    double compute_sec;
+    // Current prefetch depth.
+    std::int32_t n_prefetches;
+    // Number of page fetches served by resident pages.
+    std::uint64_t n_hits;
+    // Number of page fetches served by the disk.
+    std::uint64_t n_misses;
+    // Number of bytes held by resident pages.
+    std::int64_t resident_bytes;
+
+    // Throughput of the prefetch workers in bytes per second.
+    [[nodiscard]] double Throughput() const { return read_sec > 0 ? n_read_bytes / read_sec : 0; }
+  };
+  [[nodiscard]] IOStats GetIOStats() const {
+    return {this->n_read_bytes_, static_cast<double>(this->read_ns_) / 1e9,
+            common::Timer::SecondsT{this->wait_}.count(),
+            common::Timer::SecondsT{this->compute_}.count(),
+            this->n_prefetches_,
+            this->n_hits_,
+            this->n_misses_,
+            this->resident_bytes_};
+  }
 };
 
 #if defined(XGBOOST_USE_CUDA)
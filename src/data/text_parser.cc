@@ -0,0 +1,323 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ */
+#include "text_parser.h"
+
+#include <algorithm>     // for min, max, find_if, min_element, copy_n
+#include <charconv>      // for from_chars
+#include <cstdlib>       // for strtof
+#include <cstring>       // for memchr
+#include <filesystem>    // for file_size, is_regular_file
+#include <system_error>  // for errc
+#include <utility>       // for move
+
+#include "../common/charconv.h"         // for from_chars
+#include "../common/common.h"           // for Split
+#include "../common/threading_utils.h"  // for ParallelFor
+#include "xgboost/logging.h"            // for CHECK
+#include "xgboost/string_view.h"        // for StringView
+
+namespace xgboost::data {
+DMLC_REGISTER_PARAMETER(TextParserParam);
+
+void TextBlock::Clear() {
+  offset.resize(1);
+  offset.front() = 0;
+  label.clear();
+  weight.clear();
+  qid.clear();
+  index.clear();
+  value.clear();
+}
+
+namespace {
+[[nodiscard]] bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+// Return the beginning of the first line that starts at or after `p`.
+[[nodiscard]] char const* AlignToLine(char const* base, char const* p, char const* end) {
+  if (p == base || p >= end || *(p - 1) == '\n') {
+    return std::min(p, end);
+  }
+  auto eol = static_cast<char const*>(std::memchr(p, '\n', end - p));
+  return eol == nullptr ? end : eol + 1;
+}
+
+[[nodiscard]] float ParseFloat(char const* beg, char const* end) {
+  if (beg != end && *beg == '+') {
+    ++beg;
+  }
+  float v{0};
+  auto res = xgboost::from_chars(beg, end, v);
+  if (res.ec == std::errc{} && res.ptr == end) {
+    return v;
+  }
+  // The round-trip parser doesn't handle mantissa with more than 9 digits, `nan`, or
+  // `inf`. Fall back to the C library.
+  std::string str{beg, end};
+  char* endptr{nullptr};
+  v = std::strtof(str.c_str(), &endptr);
+  CHECK(!str.empty() && endptr == str.c_str() + str.size())
+      << "Invalid floating point value: `" << str << "`";
+  return v;
+}
+
+template <typename T>
+[[nodiscard]] T ParseUInt(char const* beg, char const* end) {
+  T v{0};
+  auto res = std::from_chars(beg, end, v);
+  CHECK(res.ec == std::errc{} && res.ptr == end)
+      << "Invalid integer value: `" << std::string{beg, end} << "`";
+  return v;
+}
+
+// Find the first occurrence of `c` in [beg, end), returns `end` if not found.
+[[nodiscard]] char const* Find(char const* beg, char const* end, char c) {
+  auto p = static_cast<char const*>(std::memchr(beg, c, end - beg));
+  return p == nullptr ? end : p;
+}
+}  // anonymous namespace
+
+TextParser::TextParser(std::string const& path, TextParserParam param, std::uint32_t part_idx,
+                       std::uint32_t n_parts, std::int32_t n_threads, std::size_t chunk_bytes)
+    : param_{std::move(param)},
+      n_threads_{std::max(n_threads, 1)},
+      chunk_bytes_{std::max(chunk_bytes, static_cast<std::size_t>(1))} {
+  CHECK(param_.format == "csv" || param_.format == "libsvm")
+      << "Unsupported text format: " << param_.format;
+  if (param_.format == "csv") {
+    CHECK_EQ(param_.delimiter.size(), 1) << "The delimiter must be a single character.";
+  }
+  CHECK_LT(part_idx, n_parts);
+  auto n_bytes = std::filesystem::file_size(path);
+  if (n_bytes != 0) {
+    file_ = std::make_shared<common::MmapResource>(StringView{path}, 0, n_bytes);
+  }
+  auto base = file_ ? static_cast<char const*>(file_->Data()) : nullptr;
+  auto file_end = base + n_bytes;
+  // Split the file into equal parts, a line belongs to the part where it starts.
+  std::size_t step = n_bytes / n_parts + !!(n_bytes % n_parts);
+  auto p_begin = std::min(step * part_idx, static_cast<std::size_t>(n_bytes));
+  auto p_end = std::min(p_begin + step, static_cast<std::size_t>(n_bytes));
+  begin_ = AlignToLine(base, base + p_begin, file_end);
+  end_ = AlignToLine(base, base + p_end, file_end);
+  cur_ = begin_;
+  tloc_.resize(n_threads_);
+}
+
+void TextParser::BeforeFirst() { cur_ = begin_; }
+
+bool TextParser::Next() {
+  block_.Clear();
+  while (cur_ < end_ && block_.Size() == 0) {
+    auto chunk_end = AlignToLine(begin_, cur_ + std::min(chunk_bytes_,
+                                                         static_cast<std::size_t>(end_ - cur_)),
+                                 end_);
+    this->ParseChunk(cur_, chunk_end);
+    cur_ = chunk_end;
+  }
+
+  row_block_.size = block_.Size();
+  row_block_.offset = block_.offset.data();
+  row_block_.label = block_.label.empty() ? nullptr : block_.label.data();
+  row_block_.weight = block_.weight.empty() ? nullptr : block_.weight.data();
+  row_block_.qid = block_.qid.empty() ? nullptr : block_.qid.data();
+  row_block_.field = nullptr;
+  row_block_.index = block_.index.data();
+  row_block_.value = block_.value.data();
+  return block_.Size() != 0;
+}
+
+void TextParser::ParseChunk(char const* begin, char const* end) {
+  // Divide the chunk among threads at line boundaries.
+  std::vector<char const*> bounds(n_threads_ + 1);
+  std::size_t step = (end - begin) / n_threads_ + 1;
+  bounds.front() = begin;
+  for (std::int32_t t = 1; t < n_threads_; ++t) {
+    auto p = begin + std::min(step * t, static_cast<std::size_t>(end - begin));
+    bounds[t] = AlignToLine(begin, std::max(p, bounds[t - 1]), end);
+  }
+  bounds.back() = end;
+
+  bool is_csv = param_.format == "csv";
+  common::ParallelFor(n_threads_, n_threads_, [&](auto t) {
+    auto& out = tloc_[t];
+    out.Clear();
+    if (is_csv) {
+      this->ParseCSV(bounds[t], bounds[t + 1], &out);
+    } else {
+      this->ParseLibSVM(bounds[t], bounds[t + 1], &out);
+    }
+  });
+
+  // Merge the thread-local blocks.
+  std::vector<std::size_t> row_ptr(n_threads_ + 1, 0), nnz_ptr(n_threads_ + 1, 0);
+  bool has_weight{false}, has_qid{false};
+  for (std::int32_t t = 0; t < n_threads_; ++t) {
+    row_ptr[t + 1] = row_ptr[t] + tloc_[t].Size();
+    nnz_ptr[t + 1] = nnz_ptr[t] + tloc_[t].index.size();
+    has_weight |= !tloc_[t].weight.empty();
+    has_qid |= !tloc_[t].qid.empty();
+  }
+  for (auto const& b : tloc_) {
+    CHECK(!has_weight || b.weight.size() == b.Size())
+        << "Instance weight must be specified for all rows or none.";
+    CHECK(!has_qid || b.qid.size() == b.Size()) << "qid must be specified for all rows or none.";
+  }
+  auto n_rows = row_ptr.back();
+  auto n_nnz = nnz_ptr.back();
+  block_.offset.resize(n_rows + 1);
+  block_.label.resize(n_rows);
+  block_.weight.resize(has_weight ? n_rows : 0);
+  block_.qid.resize(has_qid ? n_rows : 0);
+  block_.index.resize(n_nnz);
+  block_.value.resize(n_nnz);
+
+  common::ParallelFor(n_threads_, n_threads_, [&](auto t) {
+    auto const& b = tloc_[t];
+    auto r = row_ptr[t];
+    for (std::size_t i = 1; i < b.offset.size(); ++i) {
+      block_.offset[r + i] = b.offset[i] + nnz_ptr[t];
+    }
+    std::copy_n(b.label.cbegin(), b.label.size(), block_.label.begin() + r);
+    if (has_weight) {
+      std::copy_n(b.weight.cbegin(), b.weight.size(), block_.weight.begin() + r);
+    }
+    if (has_qid) {
+      std::copy_n(b.qid.cbegin(), b.qid.size(), block_.qid.begin() + r);
+    }
+    std::copy_n(b.index.cbegin(), b.index.size(), block_.index.begin() + nnz_ptr[t]);
+    std::copy_n(b.value.cbegin(), b.value.size(), block_.value.begin() + nnz_ptr[t]);
+  });
+
+  if (is_csv || block_.index.empty()) {
+    return;
+  }
+  // Convert LIBSVM indices to 0-based.
+  bool one_based = param_.indexing_mode > 0;
+  if (param_.indexing_mode < 0) {
+    one_based = *std::min_element(block_.index.cbegin(), block_.index.cend()) > 0;
+  }
+  if (one_based) {
+    common::ParallelFor(block_.index.size(), n_threads_, [&](auto i) {
+      CHECK_GT(block_.index[i], 0) << "Feature index 0 found in 1-based data.";
+      block_.index[i] -= 1;
+    });
+  }
+}
+
+void TextParser::ParseLibSVM(char const* begin, char const* end, TextBlock* p_out) const {
+  auto& out = *p_out;
+  auto skip_blank = [&](char const* p, char const* eol) {
+    return std::find_if(p, eol, [](char c) { return !IsBlank(c); });
+  };
+  auto token_end = [&](char const* p, char const* eol) {
+    return std::find_if(p, eol, [](char c) { return IsBlank(c); });
+  };
+
+  for (auto line = begin; line < end;) {
+    auto eol = Find(line, end, '\n');
+    auto next = eol == end ? end : eol + 1;
+    // Ignore comments.
+    eol = Find(line, eol, '#');
+    auto p = skip_blank(line, eol);
+    line = next;
+    if (p == eol) {
+      continue;
+    }
+    // label[:weight]
+    auto q = token_end(p, eol);
+    auto colon = Find(p, q, ':');
+    out.label.push_back(ParseFloat(p, colon));
+    if (colon != q) {
+      out.weight.push_back(ParseFloat(colon + 1, q));
+    }
+    for (p = skip_blank(q, eol); p != eol; p = skip_blank(q, eol)) {
+      q = token_end(p, eol);
+      colon = Find(p, q, ':');
+      if (colon - p == 3 && std::equal(p, colon, "qid")) {
+        out.qid.push_back(ParseUInt<std::uint64_t>(colon + 1, q));
+        continue;
+      }
+      out.index.push_back(ParseUInt<std::uint32_t>(p, colon));
+      out.value.push_back(colon == q ? 1.0f : ParseFloat(colon + 1, q));
+    }
+    out.offset.push_back(out.index.size());
+  }
+}
+
+void TextParser::ParseCSV(char const* begin, char const* end, TextBlock* p_out) const {
+  auto& out = *p_out;
+  auto delimiter = param_.delimiter.front();
+  for (auto line = begin; line < end;) {
+    auto eol = Find(line, end, '\n');
+    auto next = eol == end ? end : eol + 1;
+    while (eol != line && IsBlank(*(eol - 1))) {
+      --eol;
+    }
+    auto p = line;
+    line = next;
+    if (p == eol) {
+      continue;
+    }
+    float label{0};
+    std::int32_t column{0};
+    std::uint32_t fidx{0};
+    while (true) {
+      auto q = Find(p, eol, delimiter);
+      auto beg = std::find_if(p, q, [](char c) { return !IsBlank(c); });
+      // Same as the dmlc parser, an empty field is parsed as 0.
+      auto v = beg == q ? 0.0f : ParseFloat(beg, q);
+      if (column == param_.label_column) {
+        label = v;
+      } else if (column == param_.weight_column) {
+        out.weight.push_back(v);
+      } else {
+        out.index.push_back(fidx++);
+        out.value.push_back(v);
+      }
+      ++column;
+      // A delimiter at the end of the line doesn't start a new field.
+      if (q == eol || q + 1 == eol) {
+        break;
+      }
+      p = q + 1;
+    }
+    out.label.push_back(label);
+    out.offset.push_back(out.index.size());
+  }
+}
+
+std::unique_ptr<dmlc::Parser<std::uint32_t>> CreateTextParser(std::string const& uri,
+                                                              std::uint32_t part_idx,
+                                                              std::uint32_t n_parts,
+                                                              std::int32_t n_threads) {
+  auto fallback = [&] {
+    return std::unique_ptr<dmlc::Parser<std::uint32_t>>{
+        dmlc::Parser<std::uint32_t>::Create(uri.c_str(), part_idx, n_parts, "auto")};
+  };
+  // Cache specification is handled by dmlc.
+  if (uri.find('#') != std::string::npos) {
+    return fallback();
+  }
+  auto name_args = common::Split(uri, '?');
+  if (name_args.size() != 2 || !std::filesystem::is_regular_file(name_args[0])) {
+    return fallback();
+  }
+  Args args;
+  for (auto const& kv : common::Split(name_args[1], '&')) {
+    auto pair = common::Split(kv, '=');
+    if (pair.size() != 2) {
+      return fallback();
+    }
+    args.emplace_back(pair[0], pair[1]);
+  }
+  TextParserParam param;
+  auto unknown = param.UpdateAllowUnknown(args);
+  if (!unknown.empty() || (param.format != "csv" && param.format != "libsvm")) {
+    return fallback();
+  }
+  n_threads = std::max(n_threads, 1);
+  return std::make_unique<TextParser>(name_args[0], param, part_idx, n_parts, n_threads,
+                                      TextParser::DftThreadChunkBytes() * n_threads);
+}
+}  // namespace xgboost::data
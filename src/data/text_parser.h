@@ -0,0 +1,120 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ *
+ * @brief Built-in parallel parser for local CSV and LIBSVM files.
+ */
+#ifndef XGBOOST_DATA_TEXT_PARSER_H_
+#define XGBOOST_DATA_TEXT_PARSER_H_
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, int32_t, uint64_t
+#include <memory>   // for shared_ptr, unique_ptr
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../common/io.h"       // for MmapResource
+#include "dmlc/data.h"          // for Parser, RowBlock
+#include "xgboost/parameter.h"  // for XGBoostParameter
+
+namespace xgboost::data {
+struct TextParserParam : public XGBoostParameter<TextParserParam> {
+  std::string format;
+  // Only used by LIBSVM. >0: 1-based, 0: 0-based, <0: detected from the data.
+  std::int32_t indexing_mode{0};
+  // Only used by CSV.
+  std::int32_t label_column{-1};
+  std::int32_t weight_column{-1};
+  std::string delimiter;
+
+  DMLC_DECLARE_PARAMETER(TextParserParam) {
+    DMLC_DECLARE_FIELD(format).describe("File format, either csv or libsvm.");
+    DMLC_DECLARE_FIELD(indexing_mode)
+        .set_default(0)
+        .describe(
+            "If >0, treat all feature indices as 1-based. If =0, treat all feature indices as "
+            "0-based. If <0, use heuristic to automatically detect mode of indexing.");
+    DMLC_DECLARE_FIELD(label_column).set_default(-1).describe("Column index of the label.");
+    DMLC_DECLARE_FIELD(weight_column).set_default(-1).describe("Column index of the weight.");
+    DMLC_DECLARE_FIELD(delimiter).set_default(",").describe("Delimiter for CSV.");
+  }
+};
+
+/**
+ * @brief Rows parsed from a chunk of text, in the layout of `dmlc::RowBlock`.
+ */
+struct TextBlock {
+  std::vector<std::size_t> offset{0};
+  std::vector<float> label;
+  std::vector<float> weight;
+  std::vector<std::uint64_t> qid;
+  std::vector<std::uint32_t> index;
+  std::vector<float> value;
+
+  [[nodiscard]] std::size_t Size() const { return offset.size() - 1; }
+  void Clear();
+};
+
+/**
+ * @brief Parallel parser for local CSV and LIBSVM files.
+ *
+ *   The file is memory mapped and split into chunks at line boundaries. Each chunk is
+ *   further divided among threads, lines are located with `memchr` and numbers are parsed
+ *   with the round-trip `from_chars` from `charconv.h`. Rows from all threads are then
+ *   merged into a single block without going through any intermediate format.
+ *
+ *   Like the dmlc parser, the automatic detection of the indexing mode is done for each
+ *   block.
+ */
+class TextParser : public dmlc::Parser<std::uint32_t> {
+  TextParserParam param_;
+  std::int32_t n_threads_;
+  std::size_t chunk_bytes_;
+
+  std::shared_ptr<common::MmapResource> file_;
+  // Range of bytes for the current part, aligned to line boundaries.
+  char const* begin_{nullptr};
+  char const* end_{nullptr};
+  char const* cur_{nullptr};
+
+  std::vector<TextBlock> tloc_;
+  TextBlock block_;
+  dmlc::RowBlock<std::uint32_t> row_block_;
+
+  void ParseLibSVM(char const* begin, char const* end, TextBlock* out) const;
+  void ParseCSV(char const* begin, char const* end, TextBlock* out) const;
+  void ParseChunk(char const* begin, char const* end);
+
+ public:
+  /**
+   * @param path      Path to the file, without the URI arguments.
+   * @param param     Parser parameters decoded from the URI arguments.
+   * @param part_idx  Index of the part read by this parser, used for distributed loading.
+   * @param n_parts   Total number of parts.
+   * @param n_threads Number of threads used for parsing.
+   * @param chunk_bytes Number of bytes parsed for each batch.
+   */
+  TextParser(std::string const& path, TextParserParam param, std::uint32_t part_idx,
+             std::uint32_t n_parts, std::int32_t n_threads, std::size_t chunk_bytes);
+
+  void BeforeFirst() override;
+  bool Next() override;
+  [[nodiscard]] dmlc::RowBlock<std::uint32_t> const& Value() const override {
+    return row_block_;
+  }
+  [[nodiscard]] std::size_t BytesRead() const override { return cur_ - begin_; }
+
+  // Default number of bytes parsed by each thread in one batch.
+  static constexpr std::size_t DftThreadChunkBytes() { return static_cast<std::size_t>(1) << 24; }
+};
+
+/**
+ * @brief Create a parser for text input. Local CSV and LIBSVM files are handled by the
+ *        built-in @ref TextParser, other inputs fall back to the dmlc parser.
+ *
+ * @param uri The URI returned by `ValidateFileFormat`.
+ */
+[[nodiscard]] std::unique_ptr<dmlc::Parser<std::uint32_t>> CreateTextParser(
+    std::string const& uri, std::uint32_t part_idx, std::uint32_t n_parts,
+    std::int32_t n_threads);
+}  // namespace xgboost::data
+#endif  // XGBOOST_DATA_TEXT_PARSER_H_
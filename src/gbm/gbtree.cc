@@ -23,7 +23,8 @@
 #include "../common/random.h"
 #include "../common/threading_utils.h"
 #include "../common/timer.h"
-#include "../data/proxy_dmatrix.h"  // for DMatrixProxy, HostAdapterDispatch
+#include "../data/gradient_index.h"  // for GHistIndexMatrix
+#include "../data/proxy_dmatrix.h"    // for DMatrixProxy, HostAdapterDispatch
 #include "gbtree_model.h"
 #include "xgboost/base.h"
 #include "xgboost/data.h"
@@ -273,9 +274,34 @@ void GBTree::DoBoost(DMatrix* p_fmat, linalg::Matrix<GradientPair>* in_gpair,
   }
 
   monitor_.Stop("BoostNewTrees");
+  if (tparam_.save_cuts) {
+    this->SaveCuts(p_fmat);
+  }
   this->CommitModel(std::move(new_trees));
 }
 
+void GBTree::SaveCuts(DMatrix* p_fmat) {
+  if (this->model_.Cuts()) {
+    return;
+  }
+  // The approx tree method re-sketches the data in each iteration with hessian as weights,
+  // the cuts are not reusable.
+  bool is_hist = tparam_.tree_method == TreeMethod::kHist ||
+                 tparam_.tree_method == TreeMethod::kAuto;
+  if (!is_hist || !p_fmat->PageExists<GHistIndexMatrix>()) {
+    if (this->model_.BoostedRounds() == 0) {
+      LOG(WARNING) << "`save_cuts` is only supported by the CPU `hist` tree method.";
+    }
+    return;
+  }
+  // Use an empty batch parameter to avoid regenerating the gradient index.
+  for (auto const& page : p_fmat->GetBatches<GHistIndexMatrix>(ctx_, BatchParam{})) {
+    this->model_.Cuts(std::make_shared<common::HistogramCuts>(page.cut),
+                      page.max_numeric_bins_per_feat);
+    break;
+  }
+}
+
 void GBTree::BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat, int bst_group,
                            std::vector<HostDeviceVector<bst_node_t>>* out_position,
                            TreesOneGroup* ret) {
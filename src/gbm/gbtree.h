@@ -57,6 +57,8 @@ struct GBTreeTrainParam : public XGBoostParameter<GBTreeTrainParam> {
   TreeProcessType process_type;
   // tree construction method
   TreeMethod tree_method;
+  // whether the quantile cuts should be stored in the model
+  bool save_cuts;
   // declare parameters
   DMLC_DECLARE_PARAMETER(GBTreeTrainParam) {
     DMLC_DECLARE_FIELD(updater_seq).describe("Tree updater sequence.").set_default("");
@@ -74,6 +76,11 @@ struct GBTreeTrainParam : public XGBoostParameter<GBTreeTrainParam> {
         .add_enum("exact",     TreeMethod::kExact)
         .add_enum("hist",      TreeMethod::kHist)
         .describe("Choice of tree construction method.");
+    DMLC_DECLARE_FIELD(save_cuts)
+        .set_default(false)
+        .describe(
+            "Save the quantile cuts used by the `hist` tree method into the model. A "
+            "`QuantileDMatrix` can later be created from the booster without sketching.");
   }
 };
 
@@ -282,6 +289,10 @@ class GBTree : public GradientBooster {
   }
 
   [[nodiscard]] CatContainer const* Cats() const override { return this->model_.Cats(); }
+  [[nodiscard]] common::HistogramCuts const* Cuts(bst_bin_t* max_bin) const override {
+    *max_bin = this->model_.CutsMaxBin();
+    return this->model_.Cuts();
+  }
 
   void PredictLeaf(DMatrix* p_fmat,
                    HostDeviceVector<bst_float>* out_preds,
@@ -318,6 +329,10 @@ class GBTree : public GradientBooster {
   }
 
  protected:
+  /**
+   * @brief Keep a copy of the histogram cuts from the training data in the model.
+   */
+  void SaveCuts(DMatrix* p_fmat);
   void BoostNewTrees(linalg::Matrix<GradientPair>* gpair, DMatrix* p_fmat, int bst_group,
                      std::vector<HostDeviceVector<bst_node_t>>* out_position,
                      std::vector<std::unique_ptr<RegTree>>* ret);
@@ -8,6 +8,7 @@
 #include <numeric>    // for partial_sum
 #include <utility>    // for move, pair
 
+#include "../common/hist_util.h"         // for HistogramCuts
 #include "../common/threading_utils.h"  // for ParallelFor
 #include "xgboost/context.h"            // for Context
 #include "xgboost/json.h"               // for Json, get, Integer, Array, FromJson, ToJson, Json...
@@ -75,6 +76,11 @@ void GBTreeModel::SaveModel(Json* p_out) const {
   out["iteration_indptr"] = Array{std::move(jiteration_indptr)};
 
   this->Cats()->Save(&out["cats"]);
+
+  if (this->cuts_) {
+    this->cuts_->Save(&out["cuts"]);
+    out["cuts"]["max_bin"] = Integer{static_cast<Integer::Int>(this->cuts_max_bin_)};
+  }
 }
 
 void GBTreeModel::LoadModel(Json const& in) {
@@ -120,6 +126,15 @@ void GBTreeModel::LoadModel(Json const& in) {
     p_cats->Load(cat_it->second);
   }
   this->cats_ = std::move(p_cats);
+
+  auto cuts_it = jmodel.find("cuts");
+  if (cuts_it != jmodel.cend()) {
+    this->cuts_.reset(common::HistogramCuts::Load(cuts_it->second));
+    this->cuts_max_bin_ = get<Integer const>(cuts_it->second["max_bin"]);
+  } else {
+    this->cuts_.reset();
+    this->cuts_max_bin_ = 0;
+  }
   Validate(*this);
 }
 
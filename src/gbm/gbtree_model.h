@@ -26,6 +26,10 @@ namespace xgboost {
 
 class Json;
 
+namespace common {
+class HistogramCuts;
+}  // namespace common
+
 namespace gbm {
 /**
  * \brief Container for all trees built (not update) for one group.
@@ -142,11 +146,23 @@ struct GBTreeModel : public Model {
   [[nodiscard]] std::shared_ptr<CatContainer> CatsShared() const { return this->cats_; }
   void Cats(std::shared_ptr<CatContainer> cats) { this->cats_ = cats; }
 
+  [[nodiscard]] common::HistogramCuts const* Cuts() const { return this->cuts_.get(); }
+  [[nodiscard]] bst_bin_t CutsMaxBin() const { return this->cuts_max_bin_; }
+  void Cuts(std::shared_ptr<common::HistogramCuts const> cuts, bst_bin_t max_bin) {
+    this->cuts_ = std::move(cuts);
+    this->cuts_max_bin_ = max_bin;
+  }
+
  private:
   /**
    * @brief Categories in the training data.
    */
   std::shared_ptr<CatContainer> cats_{std::make_shared<CatContainer>()};
+  /**
+   * @brief Quantile cuts used for training, only available when `save_cuts` is set.
+   */
+  std::shared_ptr<common::HistogramCuts const> cuts_{nullptr};
+  bst_bin_t cuts_max_bin_{0};
   Context const* ctx_;
 };
 }  // namespace gbm
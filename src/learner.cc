@@ -699,6 +699,10 @@ class LearnerConfiguration : public Intercept {
     this->CheckModelInitialized();
     return this->gbm_->Cats();
   }
+  [[nodiscard]] common::HistogramCuts const* Cuts(bst_bin_t* max_bin) const override {
+    this->CheckModelInitialized();
+    return this->gbm_->Cuts(max_bin);
+  }
 
   std::vector<std::string> GetAttrNames() const override {
     std::vector<std::string> out;
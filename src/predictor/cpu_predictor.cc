@@ -225,7 +225,7 @@ bool ShouldUseBlock(DMatrix *p_fmat) {
   return blocked;
 }
 
-using cpu_impl::MakeCatAccessor;
+using cpu_impl::MakeCachedCatAccessor;
 
 // Convert a single sample in batch view to FVec
 template <typename BatchView>
@@ -396,7 +396,8 @@ class AdapterView : public DataToFeatVec<AdapterView<Adapter, EncAccessor>> {
 // Ordinal re-coder.
 struct EncAccessorPolicy {
  private:
-  std::vector<int32_t> mapping_;
+  // Shared with the recoding cache of the model.
+  cpu_impl::RecodeCache::MappingT mapping_;
 
  public:
   EncAccessorPolicy() = default;
@@ -407,9 +408,11 @@ struct EncAccessorPolicy {
   EncAccessorPolicy &operator=(EncAccessorPolicy &&that) = default;
   EncAccessorPolicy(EncAccessorPolicy &&that) = default;
 
-  [[nodiscard]] auto MakeAccessor(Context const *ctx, enc::HostColumnsView new_enc,
+  // The input is a view into user buffers, or a container owned by a DMatrix.
+  template <typename Cats>
+  [[nodiscard]] auto MakeAccessor(Context const *ctx, Cats const &new_cats,
                                   gbm::GBTreeModel const &model) {
-    auto [acc, mapping] = MakeCatAccessor(ctx, new_enc, model.Cats());
+    auto [acc, mapping] = MakeCachedCatAccessor(ctx, new_cats, model.Cats());
     this->mapping_ = std::move(mapping);
     return acc;
   }
@@ -451,7 +454,7 @@ struct LaunchConfig : public Args... {
   // Helper for running prediction with DMatrix inputs.
   template <typename Fn>
   void ForEachBatch(Fn &&fn) {
-    auto acc = this->MakeAccessor(ctx, p_fmat->Cats()->HostView(), model);
+    auto acc = this->MakeAccessor(ctx, p_fmat->Cats(), model);
 
     if (!p_fmat->PageExists<SparsePage>()) {
       auto ft = p_fmat->Info().feature_types.ConstHostVector();
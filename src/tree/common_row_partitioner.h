@@ -28,6 +28,18 @@ namespace xgboost::tree {
 
 static constexpr size_t kPartitionBlockSize = 2048;
 
+/**
+ * @brief Default callback for @ref CommonRowPartitioner::UpdatePosition, does nothing.
+ *
+ * The callback is invoked by the thread that merges a partitioned block back into the row
+ * set, with the index of the node in the input set and the rows that went to the left and
+ * the right child.
+ */
+struct NoopMergeFn {
+  void operator()(std::size_t, common::Span<bst_idx_t const>,
+                  common::Span<bst_idx_t const>) const {}
+};
+
 class ColumnSplitHelper {
  public:
   ColumnSplitHelper() = default;
@@ -193,15 +205,37 @@ class CommonRowPartitioner {
     }
   }
 
+  /**
+   * @brief The parallel space used to partition the rows of @p nodes. Tasks in the space
+   *        are assigned to threads in the same way as @ref common::ParallelFor2d.
+   */
   template <typename ExpandEntry>
+  [[nodiscard]] common::BlockedSpace2d PartitionSpace(std::vector<ExpandEntry> const& nodes) const {
+    return common::BlockedSpace2d{
+        nodes.size(),
+        [&](std::size_t node_in_set) {
+          auto nid = nodes[node_in_set].nid;
+          return row_set_collection_[nid].Size();
+        },
+        kPartitionBlockSize};
+  }
+
+  /**
+   * @brief Partition the rows of @p nodes into their children.
+   *
+   * @param merge_fn Callback invoked on each partitioned block, see @ref NoopMergeFn. It
+   *                 allows the caller to consume the rows while they are still hot in cache.
+   */
+  template <typename ExpandEntry, typename MergeFn = NoopMergeFn>
   void UpdatePosition(Context const* ctx, GHistIndexMatrix const& gmat,
-                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree) {
+                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree,
+                      MergeFn&& merge_fn = MergeFn{}) {
     auto const& column_matrix = gmat.Transpose();
     if (column_matrix.IsInitialized()) {
       if (gmat.cut.HasCategorical()) {
-        this->template UpdatePosition<true>(ctx, gmat, column_matrix, nodes, p_tree);
+        this->template UpdatePosition<true>(ctx, gmat, column_matrix, nodes, p_tree, merge_fn);
       } else {
-        this->template UpdatePosition<false>(ctx, gmat, column_matrix, nodes, p_tree);
+        this->template UpdatePosition<false>(ctx, gmat, column_matrix, nodes, p_tree, merge_fn);
       }
     } else {
       /* ColumnMatrix is not initilized.
@@ -209,36 +243,43 @@ class CommonRowPartitioner {
        * any_missing and any_cat don't metter in this case.
        * Jump directly to the main method.
        */
-      this->template UpdatePosition<uint8_t, true, true>(ctx, gmat, column_matrix, nodes, p_tree);
+      this->template UpdatePosition<uint8_t, true, true>(ctx, gmat, column_matrix, nodes, p_tree,
+                                                         merge_fn);
     }
   }
 
-  template <bool any_cat, typename ExpandEntry>
+  template <bool any_cat, typename ExpandEntry, typename MergeFn = NoopMergeFn>
   void UpdatePosition(Context const* ctx, GHistIndexMatrix const& gmat,
                       const common::ColumnMatrix& column_matrix,
-                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree) {
+                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree,
+                      MergeFn&& merge_fn = MergeFn{}) {
     if (column_matrix.AnyMissing()) {
-      this->template UpdatePosition<true, any_cat>(ctx, gmat, column_matrix, nodes, p_tree);
+      this->template UpdatePosition<true, any_cat>(ctx, gmat, column_matrix, nodes, p_tree,
+                                                   merge_fn);
     } else {
-      this->template UpdatePosition<false, any_cat>(ctx, gmat, column_matrix, nodes, p_tree);
+      this->template UpdatePosition<false, any_cat>(ctx, gmat, column_matrix, nodes, p_tree,
+                                                    merge_fn);
     }
   }
 
-  template <bool any_missing, bool any_cat, typename ExpandEntry>
+  template <bool any_missing, bool any_cat, typename ExpandEntry, typename MergeFn = NoopMergeFn>
   void UpdatePosition(Context const* ctx, GHistIndexMatrix const& gmat,
                       const common::ColumnMatrix& column_matrix,
-                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree) {
+                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree,
+                      MergeFn&& merge_fn = MergeFn{}) {
     common::DispatchBinType(column_matrix.GetTypeSize(), [&](auto t) {
       using T = decltype(t);
       this->template UpdatePosition<T, any_missing, any_cat>(ctx, gmat, column_matrix, nodes,
-                                                             p_tree);
+                                                             p_tree, merge_fn);
     });
   }
 
-  template <typename BinIdxType, bool any_missing, bool any_cat, typename ExpandEntry>
+  template <typename BinIdxType, bool any_missing, bool any_cat, typename ExpandEntry,
+            typename MergeFn = NoopMergeFn>
   void UpdatePosition(Context const* ctx, GHistIndexMatrix const& gmat,
                       const common::ColumnMatrix& column_matrix,
-                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree) {
+                      std::vector<ExpandEntry> const& nodes, RegTree const* p_tree,
+                      MergeFn&& merge_fn = MergeFn{}) {
     // 1. Find split condition for each split
     size_t n_nodes = nodes.size();
 
@@ -249,13 +290,7 @@ class CommonRowPartitioner {
     }
 
     // 2.1 Create a blocked space of size SUM(samples in each node)
-    common::BlockedSpace2d space(
-        n_nodes,
-        [&](std::size_t node_in_set) {
-          auto nid = nodes[node_in_set].nid;
-          return row_set_collection_[nid].Size();
-        },
-        kPartitionBlockSize);
+    auto space = this->PartitionSpace(nodes);
 
     // 2.2 Initialize the partition builder
     // allocate buffers for storage intermediate results by each thread
@@ -290,10 +325,12 @@ class CommonRowPartitioner {
     partition_builder_.CalculateRowOffsets();
 
     // 4. Copy elements from partition_builder_ to row_set_collection_ back
-    // with updated row-indexes for each tree-node
+    // with updated row-indexes for each tree-node, then pass the block to the caller.
     common::ParallelFor2d(space, ctx->Threads(), [&](size_t node_in_set, common::Range1d r) {
       const int32_t nid = nodes[node_in_set].nid;
       partition_builder_.MergeToArray(node_in_set, r.begin(), row_set_collection_[nid].begin());
+      auto [left, right] = partition_builder_.GetTaskRows(node_in_set, r.begin());
+      merge_fn(node_in_set, left, right);
     });
 
     // 5. Add info about splits into row_set_collection_
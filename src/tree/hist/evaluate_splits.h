@@ -4,8 +4,9 @@
 #ifndef XGBOOST_TREE_HIST_EVALUATE_SPLITS_H_
 #define XGBOOST_TREE_HIST_EVALUATE_SPLITS_H_
 
-#include <algorithm>  // for copy
+#include <algorithm>  // for copy, copy_if, nth_element, remove_if, sort
 #include <cstddef>    // for size_t
+#include <iterator>   // for back_inserter
 #include <limits>     // for numeric_limits
 #include <memory>     // for shared_ptr
 #include <numeric>    // for accumulate
@@ -83,6 +84,8 @@ class HistEvaluator {
   std::shared_ptr<common::ColumnSampler> column_sampler_;
   TreeEvaluator tree_evaluator_;
   bool is_col_split_{false};
+  // Feature boundaries of the shards, empty if all features are evaluated locally.
+  std::vector<bst_feature_t> shards_;
   FeatureInteractionConstraintHost interaction_constraints_;
   std::vector<NodeEntry> snode_;
 
@@ -168,6 +171,36 @@ class HistEvaluator {
     p_best->Update(best);
   }
 
+  /**
+   * @brief Keep at most `k` categories with the largest hessian for the partition-based
+   *        split, the gradient of the rest is summed into `p_other`. Empty categories are
+   *        always dropped so that `k` adapts to the node.
+   */
+  static void SelectTopCats(common::ConstGHistRow feat_hist, bst_bin_t k,
+                            std::vector<std::size_t> *p_sorted_idx, GradStats *p_other) {
+    auto &sorted_idx = *p_sorted_idx;
+    auto &other = *p_other;
+    sorted_idx.erase(std::remove_if(sorted_idx.begin(), sorted_idx.end(),
+                                    [&](std::size_t c) {
+                                      auto const &g = feat_hist[c];
+                                      return g.GetGrad() == 0.0 && g.GetHess() == 0.0;
+                                    }),
+                     sorted_idx.end());
+    if (sorted_idx.size() <= static_cast<std::size_t>(k)) {
+      return;
+    }
+    std::nth_element(sorted_idx.begin(), sorted_idx.begin() + k, sorted_idx.end(),
+                     [&](std::size_t l, std::size_t r) {
+                       return feat_hist[l].GetHess() > feat_hist[r].GetHess();
+                     });
+    std::for_each(sorted_idx.begin() + k, sorted_idx.end(), [&](std::size_t c) {
+      other.Add(feat_hist[c].GetGrad(), feat_hist[c].GetHess());
+    });
+    sorted_idx.resize(k);
+    // Keep the order deterministic for the stable sort in the caller.
+    std::sort(sorted_idx.begin(), sorted_idx.end());
+  }
+
   /**
    * \brief Enumerate with partition-based splits.
    *
@@ -183,11 +216,14 @@ class HistEvaluator {
    *   | [CDE] AB | DE [ABC] |
    *   | [DE] ABC | CDE [AB] |
    *   | [E] ABCD | BCDE [A] |
+   *
+   * The `sorted_idx` can be a subset of the categories when `max_cat_per_node` is used,
+   * the gradient of the rest is in `other`, which always resides on the left partition.
    */
   template <int d_step>
   void EnumeratePart(common::HistogramCuts const &cut, common::Span<size_t const> sorted_idx,
-                     common::ConstGHistRow hist, bst_feature_t fidx, bst_node_t nidx,
-                     TreeEvaluator::SplitEvaluator<TrainParam> const &evaluator,
+                     GradStats const &other, common::ConstGHistRow hist, bst_feature_t fidx,
+                     bst_node_t nidx, TreeEvaluator::SplitEvaluator<TrainParam> const &evaluator,
                      SplitEntry *p_best) {
     static_assert(d_step == +1 || d_step == -1, "Invalid step.");
 
@@ -198,27 +234,32 @@ class HistEvaluator {
     bst_bin_t f_begin = cut_ptr[fidx];
     bst_bin_t f_end = cut_ptr[fidx + 1];
     bst_bin_t n_bins_feature{f_end - f_begin};
-    auto n_bins = std::min(param_->max_cat_threshold, n_bins_feature);
+    auto n_cats = static_cast<bst_bin_t>(sorted_idx.size());
+    auto n_bins = std::min(param_->max_cat_threshold, n_cats);
+    if (n_bins < 1) {
+      return;
+    }
 
     // statistics on both sides of split
-    GradStats left_sum;
+    GradStats left_sum{other};
     GradStats right_sum;
     // best split so far
     SplitEntry best;
 
     auto f_hist = hist.subspan(f_begin, n_bins_feature);
+    // Both iterators are local to the current feature.
     bst_bin_t it_begin, it_end;
     if (d_step > 0) {
-      it_begin = f_begin;
+      it_begin = 0;
       it_end = it_begin + n_bins - 1;
     } else {
-      it_begin = f_end - 1;
+      it_begin = n_cats - 1;
       it_end = it_begin - n_bins + 1;
     }
 
     bst_bin_t best_thresh{-1};
     for (bst_bin_t i = it_begin; i != it_end; i += d_step) {
-      auto j = i - f_begin;  // index local to current feature
+      auto j = i;
       if (d_step == 1) {
         right_sum.Add(f_hist[sorted_idx[j]].GetGrad(), f_hist[sorted_idx[j]].GetHess());
         left_sum.SetSubstract(parent.stats, right_sum);  // missing on left
@@ -239,11 +280,19 @@ class HistEvaluator {
     }
 
     if (best_thresh != -1) {
+      bst_bin_t partition = d_step == 1 ? (best_thresh - it_begin + 1) : best_thresh;
+      CHECK_GT(partition, 0);
       auto n = common::CatBitField::ComputeStorageSize(n_bins_feature);
+      if (n_cats != n_bins_feature) {
+        // Size the bit field by the chosen categories instead of the cardinality, the
+        // prediction treats categories beyond the bit field as not chosen.
+        auto max_cat = std::accumulate(
+            sorted_idx.begin(), sorted_idx.begin() + partition, 0.0f,
+            [&](float acc, std::size_t c) { return std::max(acc, cut_val[c + f_begin]); });
+        n = common::CatBitField::ComputeStorageSize(common::AsCat(max_cat) + 1);
+      }
       best.cat_bits = decltype(best.cat_bits)(n, 0);
       common::CatBitField cat_bits{best.cat_bits};
-      bst_bin_t partition = d_step == 1 ? (best_thresh - it_begin + 1) : (best_thresh - f_begin);
-      CHECK_GT(partition, 0);
       std::for_each(sorted_idx.begin(), sorted_idx.begin() + partition, [&](std::size_t c) {
         auto cat = cut_val[c + f_begin];
         cat_bits.Set(cat);
@@ -340,6 +389,18 @@ class HistEvaluator {
       features[nidx_in_set] = column_sampler_->GetFeatureSet(tree.GetDepth(nidx));
     }
     CHECK(!features.empty());
+    if (!shards_.empty()) {
+      // Only the histogram bins of the local shard are synchronized.
+      auto rank = collective::GetRank();
+      auto begin = shards_.at(rank), end = shards_.at(rank + 1);
+      for (auto &p_feat : features) {
+        auto local = std::make_shared<HostDeviceVector<bst_feature_t>>();
+        auto const &h_feat = p_feat->ConstHostVector();
+        std::copy_if(h_feat.cbegin(), h_feat.cend(), std::back_inserter(local->HostVector()),
+                     [&](bst_feature_t fidx) { return fidx >= begin && fidx < end; });
+        p_feat = std::move(local);
+      }
+    }
     const size_t grain_size = std::max<size_t>(1, features.front()->Size() / n_threads);
     common::BlockedSpace2d space(
         entries.size(), [&](size_t nidx_in_set) { return features[nidx_in_set]->Size(); },
@@ -375,14 +436,18 @@ class HistEvaluator {
             std::vector<size_t> sorted_idx(n_bins);
             std::iota(sorted_idx.begin(), sorted_idx.end(), 0);
             auto feat_hist = histogram.subspan(cut_ptrs[fidx], n_bins);
+            GradStats other;
+            if (param_->max_cat_per_node != 0) {
+              SelectTopCats(feat_hist, param_->max_cat_per_node, &sorted_idx, &other);
+            }
             // Sort the histogram to get contiguous partitions.
             std::stable_sort(sorted_idx.begin(), sorted_idx.end(), [&](size_t l, size_t r) {
               auto ret = evaluator.CalcWeightCat(*param_, feat_hist[l]) <
                          evaluator.CalcWeightCat(*param_, feat_hist[r]);
               return ret;
             });
-            EnumeratePart<+1>(cut, sorted_idx, histogram, fidx, nidx, evaluator, best);
-            EnumeratePart<-1>(cut, sorted_idx, histogram, fidx, nidx, evaluator, best);
+            EnumeratePart<+1>(cut, sorted_idx, other, histogram, fidx, nidx, evaluator, best);
+            EnumeratePart<-1>(cut, sorted_idx, other, histogram, fidx, nidx, evaluator, best);
           }
         } else {
           auto grad_stats = EnumerateSplit<+1>(cut, histogram, fidx, nidx, evaluator, best);
@@ -399,9 +464,9 @@ class HistEvaluator {
       }
     }
 
-    if (is_col_split_) {
-      // With column-wise data split, we gather the best splits from all the workers and update the
-      // expand entries accordingly.
+    if (is_col_split_ || !shards_.empty()) {
+      // With column-wise data split or sharded histograms, we gather the best splits from all
+      // the workers and update the expand entries accordingly.
       auto all_entries = AllgatherColumnSplit(ctx_, entries);
       for (auto worker = 0; worker < collective::GetWorldSize(); ++worker) {
         for (std::size_t nidx_in_set = 0; nidx_in_set < entries.size(); ++nidx_in_set) {
@@ -461,6 +526,20 @@ class HistEvaluator {
   [[nodiscard]] auto Evaluator() const { return tree_evaluator_.GetEvaluator(); }
   [[nodiscard]] auto const &Stats() const { return snode_; }
 
+  /**
+   * @brief Evaluate only the features in the shard of the current worker, the best splits
+   *        are then gathered from all workers. See @ref ShardFeatures.
+   *
+   * @param shards Feature boundaries of the shards, empty to evaluate all features.
+   */
+  void SetFeatureShards(std::vector<bst_feature_t> shards) {
+    if (!shards.empty()) {
+      CHECK(!is_col_split_);
+      CHECK_EQ(shards.size(), static_cast<std::size_t>(collective::GetWorldSize()) + 1);
+    }
+    shards_ = std::move(shards);
+  }
+
   float InitRoot(GradStats const &root_sum) {
     snode_.resize(1);
     auto root_evaluator = tree_evaluator_.GetEvaluator();
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>  // for size_t
+#include <cstdint>  // for int32_t
 #include <limits>   // for numeric_limits
 
 #include "xgboost/parameter.h"   // for XGBoostParameter
@@ -24,6 +25,16 @@ struct HistMakerTrainParam : public XGBoostParameter<HistMakerTrainParam> {
 
   bool debug_synchronize{false};
   bool extmem_single_page{false};
+  // Build the histogram of the smaller child during row partitioning.
+  bool fuse_partition_hist{false};
+  // Number of updates between two hessian-weighted sketches for approx.
+  std::int32_t approx_sketch_interval{1};
+  // Exchange a sparse encoding of the histograms in distributed training.
+  bool sparse_hist_sync{false};
+  // Maximum error relative to the largest value in a histogram for the sparse encoding.
+  float hist_sync_max_error{0.0f};
+  // Reduce-scatter the histograms by features and evaluate splits only for the local shard.
+  bool shard_hist_sync{false};
 
   void CheckTreesSynchronized(Context const* ctx, RegTree const* local_tree) const;
 
@@ -44,6 +55,25 @@ struct HistMakerTrainParam : public XGBoostParameter<HistMakerTrainParam> {
         .set_lower_bound(1)
         .describe("Maximum number of nodes in histogram cache.");
     DMLC_DECLARE_FIELD(extmem_single_page).set_default(false);
+    DMLC_DECLARE_FIELD(fuse_partition_hist)
+        .set_default(false)
+        .describe("Build the histogram of the smaller child during row partitioning.");
+    DMLC_DECLARE_FIELD(approx_sketch_interval)
+        .set_default(1)
+        .set_lower_bound(1)
+        .describe("Number of tree updates between re-sketching the data for approx.");
+    DMLC_DECLARE_FIELD(sparse_hist_sync)
+        .set_default(false)
+        .describe("Exchange a sparse encoding of the histograms in distributed training.");
+    DMLC_DECLARE_FIELD(hist_sync_max_error)
+        .set_default(0.0f)
+        .set_range(0.0f, 1.0f)
+        .describe("Maximum error of the histogram values in the sparse encoding, relative to "
+                  "the largest value in a histogram.");
+    DMLC_DECLARE_FIELD(shard_hist_sync)
+        .set_default(false)
+        .describe("Reduce-scatter the histograms by features in distributed training, each "
+                  "worker evaluates splits only for its own features.");
   }
 };
 }  // namespace xgboost::tree
@@ -3,12 +3,23 @@
  */
 #include "histogram.h"
 
-#include <cstddef>  // for size_t
-#include <numeric>  // for accumulate
-#include <utility>  // for swap
-#include <vector>   // for vector
+#include <algorithm>    // for max, min_element, fill, lower_bound, clamp, copy, copy_n
+#include <cmath>        // for abs, lround
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int8_t, int16_t, uint8_t, uint32_t, uint64_t
+#include <cstring>      // for memcpy
+#include <iterator>     // for distance
+#include <limits>       // for numeric_limits
+#include <numeric>      // for accumulate
+#include <type_traits>  // for is_same_v
+#include <utility>      // for swap, move
+#include <vector>       // for vector
 
+#include "../../collective/allreduce.h"       // for Allreduce, RingReduceScatter
+#include "../../collective/coll.h"            // for AllgatherVAlgo
+#include "../../common/common.h"              // for DivRoundUp
 #include "../../common/transform_iterator.h"  // for MakeIndexTransformIter
+#include "../../common/type.h"                // for EraseType, RestoreType
 #include "expand_entry.h"                     // for MultiExpandEntry, CPUExpandEntry
 #include "xgboost/logging.h"                  // for CHECK_NE
 #include "xgboost/span.h"                     // for Span
@@ -60,4 +71,310 @@ void AssignNodes(RegTree const *p_tree, std::vector<CPUExpandEntry> const &candi
     ++n_idx;
   }
 }
+
+namespace {
+enum HistIndexKind : std::uint8_t { kBitmap = 0, kIndices = 1 };
+enum HistValueKind : std::uint8_t { kF64 = 0, kF32 = 1, kI16 = 2 };
+
+struct HistEncodingHeader {
+  std::uint8_t index_kind;
+  std::uint8_t value_kind;
+  std::uint8_t pad[6];
+  std::uint64_t n_bins;
+  std::uint64_t nnz;
+  // Scale for quantized values.
+  double scale;
+};
+static_assert(sizeof(HistEncodingHeader) == 32);
+
+constexpr double kI16Max = std::numeric_limits<std::int16_t>::max();
+// Rounding error of quantization relative to the largest value.
+constexpr double kI16Error = 1.0 / (2.0 * kI16Max);
+// Rounding error of float.
+constexpr double kF32Error = 1.0 / static_cast<double>(1u << 24);
+
+std::size_t IndexBytes(HistEncodingHeader const &header) {
+  auto n_bytes = header.index_kind == kBitmap ? common::DivRoundUp(header.n_bins, 8)
+                                              : header.nnz * sizeof(std::uint32_t);
+  // Align the values.
+  return common::DivRoundUp(n_bytes, 8) * 8;
+}
+
+std::size_t ValueBytes(std::uint8_t value_kind) {
+  switch (value_kind) {
+    case kF64:
+      return sizeof(double);
+    case kF32:
+      return sizeof(float);
+    case kI16:
+      return sizeof(std::int16_t);
+    default:
+      LOG(FATAL) << "Invalid histogram encoding.";
+  }
+  return 0;
+}
+
+template <typename T>
+void WriteValues(common::Span<GradientPairPrecise const> hist,
+                 std::vector<std::uint32_t> const &nz, double scale, std::int8_t *out) {
+  for (std::size_t i = 0; i < nz.size(); ++i) {
+    auto g = hist[nz[i]];
+    T v[2];
+    if constexpr (std::is_same_v<T, std::int16_t>) {
+      v[0] = static_cast<T>(std::lround(g.GetGrad() / scale));
+      v[1] = static_cast<T>(std::lround(g.GetHess() / scale));
+    } else {
+      v[0] = static_cast<T>(g.GetGrad());
+      v[1] = static_cast<T>(g.GetHess());
+    }
+    std::memcpy(out + i * sizeof(v), v, sizeof(v));
+  }
+}
+
+template <typename T>
+GradientPairPrecise ReadValue(std::int8_t const *in, std::size_t i, double scale) {
+  T v[2];
+  std::memcpy(v, in + i * sizeof(v), sizeof(v));
+  if constexpr (std::is_same_v<T, std::int16_t>) {
+    return {static_cast<double>(v[0]) * scale, static_cast<double>(v[1]) * scale};
+  } else {
+    return {static_cast<double>(v[0]), static_cast<double>(v[1])};
+  }
+}
+}  // namespace
+
+void EncodeHist(common::Span<GradientPairPrecise const> hist, double max_error,
+                std::vector<std::int8_t> *p_out) {
+  CHECK_LE(hist.size(), std::numeric_limits<std::uint32_t>::max());
+  std::vector<std::uint32_t> nz;
+  double max_abs = 0.0;
+  for (std::size_t i = 0; i < hist.size(); ++i) {
+    auto g = hist[i];
+    if (g.GetGrad() != 0.0 || g.GetHess() != 0.0) {
+      nz.push_back(static_cast<std::uint32_t>(i));
+      max_abs = std::max({max_abs, std::abs(g.GetGrad()), std::abs(g.GetHess())});
+    }
+  }
+
+  HistEncodingHeader header{};
+  header.n_bins = hist.size();
+  header.nnz = nz.size();
+  header.index_kind = common::DivRoundUp(hist.size(), 8) < nz.size() * sizeof(std::uint32_t)
+                          ? kBitmap
+                          : kIndices;
+  if (max_error >= kI16Error && max_abs > 0.0) {
+    header.value_kind = kI16;
+    header.scale = max_abs / kI16Max;
+  } else if (max_error >= kF32Error && max_abs < std::numeric_limits<float>::max()) {
+    header.value_kind = kF32;
+  } else {
+    header.value_kind = kF64;
+  }
+
+  auto index_bytes = IndexBytes(header);
+  auto value_bytes = ValueBytes(header.value_kind) * 2 * nz.size();
+  auto &out = *p_out;
+  out.assign(sizeof(header) + index_bytes + value_bytes, 0);
+  std::memcpy(out.data(), &header, sizeof(header));
+
+  auto *index = out.data() + sizeof(header);
+  if (header.index_kind == kBitmap) {
+    for (auto i : nz) {
+      index[i / 8] |= static_cast<std::int8_t>(1u << (i % 8));
+    }
+  } else {
+    std::memcpy(index, nz.data(), nz.size() * sizeof(std::uint32_t));
+  }
+
+  auto *values = index + index_bytes;
+  switch (header.value_kind) {
+    case kF64:
+      WriteValues<double>(hist, nz, header.scale, values);
+      break;
+    case kF32:
+      WriteValues<float>(hist, nz, header.scale, values);
+      break;
+    case kI16:
+      WriteValues<std::int16_t>(hist, nz, header.scale, values);
+      break;
+  }
+}
+
+void DecodeHistAdd(common::Span<std::int8_t const> in, common::Span<GradientPairPrecise> out) {
+  HistEncodingHeader header;
+  CHECK_GE(in.size(), sizeof(header));
+  std::memcpy(&header, in.data(), sizeof(header));
+  CHECK_EQ(header.n_bins, out.size()) << "Invalid histogram encoding.";
+  auto index_bytes = IndexBytes(header);
+  CHECK_EQ(in.size(),
+           sizeof(header) + index_bytes + ValueBytes(header.value_kind) * 2 * header.nnz);
+
+  auto const *index = in.data() + sizeof(header);
+  auto const *values = index + index_bytes;
+  auto read = [&](std::size_t i) {
+    switch (header.value_kind) {
+      case kF64:
+        return ReadValue<double>(values, i, header.scale);
+      case kF32:
+        return ReadValue<float>(values, i, header.scale);
+      default:
+        return ReadValue<std::int16_t>(values, i, header.scale);
+    }
+  };
+
+  if (header.index_kind == kBitmap) {
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < header.n_bins; ++i) {
+      if (static_cast<std::uint8_t>(index[i / 8]) & (1u << (i % 8))) {
+        out[i] += read(k++);
+      }
+    }
+    CHECK_EQ(k, header.nnz);
+  } else {
+    for (std::size_t k = 0; k < header.nnz; ++k) {
+      std::uint32_t i;
+      std::memcpy(&i, index + k * sizeof(i), sizeof(i));
+      out[i] += read(k);
+    }
+  }
+}
+
+[[nodiscard]] collective::Result SparseHistAllreduce(Context const *ctx,
+                                                     collective::CommGroup const &comm,
+                                                     common::Span<GradientPairPrecise> hist,
+                                                     double max_error, HistSyncStats *p_stats) {
+  if (!comm.IsDistributed()) {
+    return collective::Success();
+  }
+  std::vector<std::int8_t> encoded;
+  EncodeHist(hist, max_error, &encoded);
+
+  auto world = comm.World();
+  auto const &cctx = comm.Ctx(ctx, DeviceOrd::CPU());
+  auto backend = comm.Backend(DeviceOrd::CPU());
+  std::vector<std::int64_t> sizes(world, 0);
+  sizes[comm.Rank()] = static_cast<std::int64_t>(encoded.size());
+  auto rc = backend->Allgather(cctx, common::EraseType(common::Span{sizes.data(), sizes.size()}));
+  if (!rc.OK()) {
+    return collective::Fail("Failed to gather the size of histogram encodings.", std::move(rc));
+  }
+
+  // All workers must make the same decision, it's based on the worker that receives the most
+  // bytes instead of the local size.
+  auto total = std::accumulate(sizes.cbegin(), sizes.cend(), static_cast<std::int64_t>(0));
+  auto min_size = *std::min_element(sizes.cbegin(), sizes.cend());
+  auto n_max_sparse_bytes = static_cast<std::size_t>(total - min_size);
+  auto n_sparse_bytes = static_cast<std::size_t>(total - sizes[comm.Rank()]);
+  auto n_dense_bytes = 2 * hist.size_bytes() * (world - 1) / world;
+  p_stats->n_dense_bytes += n_dense_bytes;
+  if (n_max_sparse_bytes >= n_dense_bytes) {
+    p_stats->n_bytes += n_dense_bytes;
+    auto data = reinterpret_cast<double *>(hist.data());
+    return collective::Allreduce(ctx, comm, linalg::MakeVec(data, hist.size() * 2),
+                                 collective::Op::kSum);
+  }
+  p_stats->n_bytes += n_sparse_bytes;
+
+  std::vector<std::int64_t> segments(world + 1, 0);
+  std::vector<std::int8_t> recv(total);
+  auto s_encoded = common::Span<std::int8_t const>{encoded.data(), encoded.size()};
+  rc = backend->AllgatherV(cctx, s_encoded, common::Span{sizes.data(), sizes.size()},
+                           common::Span{segments.data(), segments.size()},
+                           common::Span{recv.data(), recv.size()},
+                           collective::AllgatherVAlgo::kRing);
+  if (!rc.OK()) {
+    return collective::Fail("Failed to gather the histogram encodings.", std::move(rc));
+  }
+  // Decode in the order of ranks so that all workers obtain the same result.
+  std::fill(hist.begin(), hist.end(), GradientPairPrecise{});
+  auto s_recv = common::Span{recv.data(), recv.size()};
+  for (std::int32_t r = 0; r < world; ++r) {
+    DecodeHistAdd(s_recv.subspan(segments[r], sizes[r]), hist);
+  }
+  return collective::Success();
+}
+
+[[nodiscard]] std::vector<bst_feature_t> ShardFeatures(common::HistogramCuts const &cut,
+                                                       std::int32_t n_shards) {
+  CHECK_GE(n_shards, 1);
+  auto const &ptrs = cut.Ptrs();
+  CHECK_GE(ptrs.size(), 1);
+  auto n_features = static_cast<bst_feature_t>(ptrs.size() - 1);
+  auto n_bins = static_cast<std::uint64_t>(ptrs.back());
+  std::vector<bst_feature_t> shards(n_shards + 1, 0);
+  for (std::int32_t r = 1; r < n_shards; ++r) {
+    // The feature boundary closest to the even split of bins.
+    auto target = n_bins * r / n_shards;
+    auto it = std::lower_bound(ptrs.cbegin(), ptrs.cend(), target);
+    if (it != ptrs.cbegin() && target - *(it - 1) < *it - target) {
+      --it;
+    }
+    auto fidx = static_cast<bst_feature_t>(std::distance(ptrs.cbegin(), it));
+    shards[r] = std::clamp(fidx, shards[r - 1], n_features);
+  }
+  shards.back() = n_features;
+  return shards;
+}
+
+[[nodiscard]] collective::Result ReduceScatterHist(Context const *ctx,
+                                                   collective::CommGroup const &comm,
+                                                   common::Span<bst_bin_t const> shards,
+                                                   common::Span<GradientPairPrecise> hist,
+                                                   HistSyncStats *p_stats) {
+  if (!comm.IsDistributed()) {
+    return collective::Success();
+  }
+  auto world = comm.World();
+  auto rank = comm.Rank();
+  CHECK_EQ(shards.size(), static_cast<std::size_t>(world) + 1);
+  auto n_bins = static_cast<std::size_t>(shards.back());
+  CHECK_GT(n_bins, 0);
+  CHECK_EQ(hist.size() % n_bins, 0);
+  auto n_nodes = hist.size() / n_bins;
+
+  // Arrange the bins by shards so that each worker receives a contiguous segment.
+  std::vector<GradientPairPrecise> buffer(hist.size());
+  std::vector<std::size_t> seg_ptrs(world + 1, 0);
+  auto out_it = buffer.begin();
+  auto shard = [&](std::int32_t r, std::size_t nidx_in_set) {
+    return hist.subspan(nidx_in_set * n_bins + shards[r], shards[r + 1] - shards[r]);
+  };
+  for (std::int32_t r = 0; r < world; ++r) {
+    for (std::size_t i = 0; i < n_nodes; ++i) {
+      auto in = shard(r, i);
+      out_it = std::copy(in.cbegin(), in.cend(), out_it);
+    }
+    auto n_copied = static_cast<std::size_t>(std::distance(buffer.begin(), out_it));
+    seg_ptrs[r + 1] = n_copied * sizeof(GradientPairPrecise);
+  }
+
+  auto add = [](common::Span<std::int8_t const> lhs, common::Span<std::int8_t> out) {
+    auto lhs_t = common::RestoreType<double const>(lhs);
+    auto out_t = common::RestoreType<double>(out);
+    for (std::size_t i = 0; i < out_t.size(); ++i) {
+      out_t[i] += lhs_t[i];
+    }
+  };
+  auto erased = common::EraseType(common::Span{buffer.data(), buffer.size()});
+  auto rc = collective::cpu_impl::RingReduceScatter(
+      comm.Ctx(ctx, DeviceOrd::CPU()), erased,
+      common::Span<std::size_t const>{seg_ptrs.data(), seg_ptrs.size()}, add);
+  if (!rc.OK()) {
+    return collective::Fail("Failed to reduce-scatter the histograms.", std::move(rc));
+  }
+
+  // Copy the local shard back.
+  auto in_it = buffer.cbegin() + seg_ptrs[rank] / sizeof(GradientPairPrecise);
+  for (std::size_t i = 0; i < n_nodes; ++i) {
+    auto out = shard(rank, i);
+    std::copy_n(in_it, out.size(), out.begin());
+    in_it += out.size();
+  }
+
+  // All segments except the one sent in the first round are received.
+  auto prev = (rank + world - 1) % world;
+  p_stats->n_bytes += seg_ptrs.back() - (seg_ptrs[prev + 1] - seg_ptrs[prev]);
+  p_stats->n_dense_bytes += 2 * hist.size_bytes() * (world - 1) / world;
+  return collective::Success();
+}
 }  // namespace xgboost::tree
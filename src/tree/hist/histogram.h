@@ -4,13 +4,17 @@
 #ifndef XGBOOST_TREE_HIST_HISTOGRAM_H_
 #define XGBOOST_TREE_HIST_HISTOGRAM_H_
 
-#include <algorithm>   // for max
+#include <algorithm>   // for max, min, find, transform
 #include <cstddef>     // for size_t
-#include <cstdint>     // for int32_t
-#include <utility>     // for move
+#include <cstdint>     // for int32_t, uint32_t
+#include <deque>       // for deque
+#include <future>      // for future
+#include <iterator>    // for distance
+#include <utility>     // for move, pair
 #include <vector>      // for vector
 
-#include "../../collective/allreduce.h"    // for Allreduce
+#include "../../collective/allreduce.h"    // for Allreduce, AllreduceAsync
+#include "../../common/common.h"           // for DivRoundUp
 #include "../../common/hist_util.h"        // for GHistRow, ParallelGHi...
 #include "../../common/row_set.h"          // for RowSetCollection
 #include "../../common/threading_utils.h"  // for ParallelFor2d, Range1d, BlockedSpace2d
@@ -39,7 +43,69 @@ void AssignNodes(RegTree const *p_tree, std::vector<MultiExpandEntry> const &val
 void AssignNodes(RegTree const *p_tree, std::vector<CPUExpandEntry> const &candidates,
                  common::Span<bst_node_t> nodes_to_build, common::Span<bst_node_t> nodes_to_sub);
 
+/**
+ * @brief Estimated number of bytes on the wire for synchronizing histograms.
+ */
+struct HistSyncStats {
+  // Bytes received by the current worker.
+  std::size_t n_bytes{0};
+  // Bytes that would be received with the dense allreduce.
+  std::size_t n_dense_bytes{0};
+};
+
+/**
+ * @brief Encode a histogram by its non-zero bins for the distributed sync.
+ *
+ *   Bins are represented by either a bitmap or a list of indices, whichever is smaller.
+ *   Values are downcast to float or quantized to 16-bit integers if the error relative to
+ *   the largest absolute value in the histogram is within `max_error`.
+ */
+void EncodeHist(common::Span<GradientPairPrecise const> hist, double max_error,
+                std::vector<std::int8_t> *p_out);
+
+/**
+ * @brief Decode a histogram encoded by @ref EncodeHist and add it to `out`.
+ */
+void DecodeHistAdd(common::Span<std::int8_t const> in, common::Span<GradientPairPrecise> out);
+
+/**
+ * @brief Allreduce histograms by gathering the encoding from @ref EncodeHist. The dense
+ *        allreduce is used if the encodings from all workers don't save bandwidth.
+ */
+[[nodiscard]] collective::Result SparseHistAllreduce(Context const *ctx,
+                                                     collective::CommGroup const &comm,
+                                                     common::Span<GradientPairPrecise> hist,
+                                                     double max_error, HistSyncStats *p_stats);
+
+/**
+ * @brief Partition the features into contiguous ranges with a similar number of bins, one
+ *        for each shard.
+ *
+ * @return Feature boundaries of the shards, with size `n_shards + 1`. Some ranges might be
+ *         empty if there are more shards than features.
+ */
+[[nodiscard]] std::vector<bst_feature_t> ShardFeatures(common::HistogramCuts const &cut,
+                                                       std::int32_t n_shards);
+
+/**
+ * @brief Reduce-scatter histograms of a batch of nodes. Upon return, each worker has the
+ *        global sum of bins in `[shards[rank], shards[rank + 1])` for every node, other
+ *        bins are left in an unspecified state.
+ *
+ * @param shards Bin boundaries of the shards, the last one is the number of bins per node.
+ */
+[[nodiscard]] collective::Result ReduceScatterHist(Context const *ctx,
+                                                   collective::CommGroup const &comm,
+                                                   common::Span<bst_bin_t const> shards,
+                                                   common::Span<GradientPairPrecise> hist,
+                                                   HistSyncStats *p_stats);
+
 class HistogramBuilder {
+  // Number of batches for splitting the histogram allreduce.
+  constexpr static std::size_t HistSyncBatches() { return 4; }
+  // Maximum number of histogram allreduce running in the background.
+  constexpr static std::size_t MaxInflightHistSync() { return 2; }
+
   /*! \brief culmulative histogram of gradients. */
   common::Monitor monitor_;
   BoundedHistCollection hist_;
@@ -49,6 +115,32 @@ class HistogramBuilder {
   // Whether XGBoost is running in distributed environment.
   bool is_distributed_{false};
   bool is_col_split_{false};
+  bool sparse_sync_{false};
+  double sync_max_error_{0.0};
+  // Bin boundaries of the feature shards, empty if the histograms are not sharded.
+  std::vector<bst_bin_t> shards_;
+
+  [[nodiscard]] std::future<collective::Result> AllreduceHist(
+      Context const *ctx, common::Span<GradientPairPrecise> hist, HistSyncStats *p_stats) {
+    auto n = hist.size() * 2;
+    auto data = reinterpret_cast<double *>(hist.data());
+    if (!shards_.empty()) {
+      auto const *comm = collective::GlobalCommGroup().get();
+      auto shards = common::Span<bst_bin_t const>{shards_.data(), shards_.size()};
+      return comm->Async(
+          [=] { return ReduceScatterHist(ctx, *comm, shards, hist, p_stats); });
+    }
+    if (!sparse_sync_) {
+      return collective::AllreduceAsync(ctx, linalg::MakeVec(data, n), collective::Op::kSum);
+    }
+    auto const *comm = collective::GlobalCommGroup().get();
+    if (!comm->IsDistributed()) {
+      return collective::AllreduceAsync(ctx, linalg::MakeVec(data, n), collective::Op::kSum);
+    }
+    return comm->Async([=, max_error = sync_max_error_] {
+      return SparseHistAllreduce(ctx, *comm, hist, max_error, p_stats);
+    });
+  }
 
  public:
   /**
@@ -66,6 +158,24 @@ class HistogramBuilder {
     buffer_.Init(total_bins);
     is_distributed_ = is_distributed;
     is_col_split_ = is_col_split;
+    sparse_sync_ = param->sparse_hist_sync;
+    sync_max_error_ = param->hist_sync_max_error;
+    shards_.clear();
+  }
+
+  /**
+   * @brief Synchronize only the bins of the features in the local shard, see
+   *        @ref ShardFeatures. Must be called after @ref Reset.
+   *
+   * @param ptrs Feature pointers of the histogram cuts.
+   */
+  void ShardHistogram(std::vector<std::uint32_t> const &ptrs,
+                      std::vector<bst_feature_t> const &feature_shards) {
+    CHECK(is_distributed_ && !is_col_split_);
+    shards_.resize(feature_shards.size());
+    std::transform(feature_shards.cbegin(), feature_shards.cend(), shards_.begin(),
+                   [&](bst_feature_t fidx) { return static_cast<bst_bin_t>(ptrs.at(fidx)); });
+    CHECK_EQ(shards_.back(), buffer_.TotalBins());
   }
 
   template <bool any_missing>
@@ -143,6 +253,42 @@ class HistogramBuilder {
     this->hist_.AllocateHistograms(nodes_to_build, nodes_to_sub);
   }
 
+  /**
+   * @brief Add the local histogram cache to the parallel buffer. Threads are matched to
+   *        nodes according to how @ref common::ParallelFor2d splits the @p space.
+   */
+  void ResetBuffer(common::BlockedSpace2d const &space,
+                   std::vector<bst_node_t> const &nodes_to_build) {
+    auto n_nodes = nodes_to_build.size();
+    std::vector<common::GHistRow> target_hists(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; ++i) {
+      auto const nidx = nodes_to_build[i];
+      target_hists[i] = hist_[nidx];
+    }
+    buffer_.Reset(this->n_threads_, n_nodes, space, target_hists);
+  }
+
+  /**
+   * @brief Accumulate a block of rows into the thread-local histogram of a node. Must be
+   *        called inside a @ref common::ParallelFor2d over the space used to reset the
+   *        buffer, see @ref ResetBuffer.
+   */
+  void BuildBlockHist(std::size_t nidx_in_set, GHistIndexMatrix const &gidx,
+                      common::Span<bst_idx_t const> rid_set,
+                      linalg::VectorView<GradientPair const> gpair,
+                      bool force_read_by_column = false) {
+    const auto tid = static_cast<unsigned>(omp_get_thread_num());
+    auto hist = buffer_.GetInitializedHist(tid, nidx_in_set);
+    if (rid_set.empty()) {
+      return;
+    }
+    if (gidx.IsDense()) {
+      common::BuildHist<false>(gpair.Values(), rid_set, gidx, hist, force_read_by_column);
+    } else {
+      common::BuildHist<true>(gpair.Values(), rid_set, gidx, hist, force_read_by_column);
+    }
+  }
+
   /** Main entry point of this class, build histogram for tree nodes. */
   void BuildHist(std::size_t page_idx, common::BlockedSpace2d const &space,
                  GHistIndexMatrix const &gidx, common::RowSetCollection const &row_set_collection,
@@ -153,13 +299,7 @@ class HistogramBuilder {
 
     if (page_idx == 0) {
       // Add the local histogram cache to the parallel buffer before processing the first page.
-      auto n_nodes = nodes_to_build.size();
-      std::vector<common::GHistRow> target_hists(n_nodes);
-      for (size_t i = 0; i < n_nodes; ++i) {
-        auto const nidx = nodes_to_build[i];
-        target_hists[i] = hist_[nidx];
-      }
-      buffer_.Reset(this->n_threads_, n_nodes, space, target_hists);
+      this->ResetBuffer(space, nodes_to_build);
     }
 
     if (gidx.IsDense()) {
@@ -172,32 +312,17 @@ class HistogramBuilder {
     monitor_.Stop(__func__);
   }
 
-  void SyncHistogram(Context const *ctx, RegTree const *p_tree,
-                     std::vector<bst_node_t> const &nodes_to_build,
-                     std::vector<bst_node_t> const &nodes_to_trick) {
-    auto n_total_bins = buffer_.TotalBins();
-    common::BlockedSpace2d space(
-        nodes_to_build.size(), [&](std::size_t) { return n_total_bins; }, 1024);
-    common::ParallelFor2d(space, this->n_threads_, [&](size_t node, common::Range1d r) {
-      // Merging histograms from each thread.
-      this->buffer_.ReduceHist(node, r.begin(), r.end());
-    });
-    if (is_distributed_ && !is_col_split_) {
-      // The cache is contiguous, we can perform allreduce for all nodes in one go.
-      CHECK(!nodes_to_build.empty());
-      auto first_nidx = nodes_to_build.front();
-      std::size_t n = n_total_bins * nodes_to_build.size() * 2;
-      auto rc = collective::Allreduce(
-          ctx, linalg::MakeVec(reinterpret_cast<double *>(this->hist_[first_nidx].data()), n),
-          collective::Op::kSum);
-      SafeColl(rc);
+  /**
+   * @brief Apply the subtraction trick for nodes in `nodes_to_trick`, the histograms of
+   *        their siblings must be ready.
+   */
+  void SubtractHistogram(RegTree const *p_tree, common::Span<bst_node_t const> nodes_to_trick) {
+    if (nodes_to_trick.empty()) {
+      return;
     }
-
-    common::BlockedSpace2d const &subspace =
-        nodes_to_trick.size() == nodes_to_build.size()
-            ? space
-            : common::BlockedSpace2d{nodes_to_trick.size(),
-                                     [&](std::size_t) { return n_total_bins; }, 1024};
+    auto n_total_bins = buffer_.TotalBins();
+    common::BlockedSpace2d subspace{nodes_to_trick.size(),
+                                    [&](std::size_t) { return n_total_bins; }, 1024};
     common::ParallelFor2d(
         subspace, this->n_threads_, [&](std::size_t nidx_in_set, common::Range1d r) {
           auto subtraction_nidx = nodes_to_trick[nidx_in_set];
@@ -211,6 +336,80 @@ class HistogramBuilder {
         });
   }
 
+  /**
+   * @brief Merge the thread-local histograms for nodes in [begin, end) of the build set.
+   */
+  void ReduceBuffer(std::size_t begin, std::size_t end) {
+    auto n_total_bins = buffer_.TotalBins();
+    common::BlockedSpace2d space(
+        end - begin, [&](std::size_t) { return n_total_bins; }, 1024);
+    common::ParallelFor2d(space, this->n_threads_, [&](size_t node, common::Range1d r) {
+      // Merging histograms from each thread.
+      this->buffer_.ReduceHist(begin + node, r.begin(), r.end());
+    });
+  }
+
+  void SyncHistogram(Context const *ctx, RegTree const *p_tree,
+                     std::vector<bst_node_t> const &nodes_to_build,
+                     std::vector<bst_node_t> const &nodes_to_trick) {
+    if (!is_distributed_ || is_col_split_) {
+      this->ReduceBuffer(0, nodes_to_build.size());
+      this->SubtractHistogram(p_tree, nodes_to_trick);
+      return;
+    }
+    // The cache is contiguous, the allreduce is performed on batches of nodes. Each batch
+    // is reduced in the background while the thread-local buffers of the next batch are
+    // merged and the subtraction trick is applied to nodes whose sibling has been reduced.
+    CHECK(!nodes_to_build.empty());
+    auto n_total_bins = buffer_.TotalBins();
+    auto n_nodes = nodes_to_build.size();
+    auto batch_size = common::DivRoundUp(n_nodes, HistSyncBatches());
+    auto n_batches = common::DivRoundUp(n_nodes, batch_size);
+
+    // Group the subtraction nodes by the batch of their siblings.
+    std::vector<std::vector<bst_node_t>> trick_batches(n_batches);
+    for (auto nidx : nodes_to_trick) {
+      auto parent_id = p_tree->Parent(nidx);
+      auto sibling_nidx =
+          p_tree->IsLeftChild(nidx) ? p_tree->RightChild(parent_id) : p_tree->LeftChild(parent_id);
+      auto it = std::find(nodes_to_build.cbegin(), nodes_to_build.cend(), sibling_nidx);
+      CHECK(it != nodes_to_build.cend());
+      trick_batches[std::distance(nodes_to_build.cbegin(), it) / batch_size].push_back(nidx);
+    }
+
+    std::vector<HistSyncStats> stats(n_batches);
+    std::deque<std::pair<std::future<collective::Result>, std::size_t>> inflight;
+    auto finish = [&] {
+      auto [fut, batch_idx] = std::move(inflight.front());
+      inflight.pop_front();
+      SafeColl(fut.get());
+      this->SubtractHistogram(p_tree, trick_batches[batch_idx]);
+    };
+    for (std::size_t i = 0; i < n_batches; ++i) {
+      auto begin = i * batch_size;
+      auto end = std::min(begin + batch_size, n_nodes);
+      this->ReduceBuffer(begin, end);
+      auto hist = common::Span{this->hist_[nodes_to_build[begin]].data(),
+                               static_cast<std::size_t>(n_total_bins) * (end - begin)};
+      inflight.emplace_back(this->AllreduceHist(ctx, hist, &stats[i]), i);
+      if (inflight.size() > MaxInflightHistSync()) {
+        finish();
+      }
+    }
+    while (!inflight.empty()) {
+      finish();
+    }
+    if (sparse_sync_ || !shards_.empty()) {
+      HistSyncStats total;
+      for (auto const &v : stats) {
+        total.n_bytes += v.n_bytes;
+        total.n_dense_bytes += v.n_dense_bytes;
+      }
+      LOG(DEBUG) << "Histogram sync for " << n_nodes << " nodes received " << total.n_bytes
+                 << " bytes, dense: " << total.n_dense_bytes << " bytes.";
+    }
+  }
+
  public:
   /* Getters for tests. */
   [[nodiscard]] BoundedHistCollection const &Histogram() const { return hist_; }
@@ -246,6 +445,9 @@ common::BlockedSpace2d ConstructHistSpace(Partitioner const &partitioners,
 class MultiHistogramBuilder {
   std::vector<HistogramBuilder> target_builders_;
   Context const *ctx_;
+  // Nodes prepared by `PrepareFusedHist`.
+  std::vector<bst_node_t> fused_nodes_to_build_;
+  std::vector<bst_node_t> fused_nodes_to_sub_;
 
  public:
   /**
@@ -326,6 +528,69 @@ class MultiHistogramBuilder {
     }
   }
 
+  /**
+   * @brief Prepare the histogram of the smaller child for each candidate before the rows
+   *        are partitioned, so that it can be built in the same pass as the partitioning.
+   *        The rest of the nodes are obtained by the subtraction trick in @ref
+   *        SyncFusedHist.
+   *
+   * @param space The space used by the row partitioner, must be created from the
+   *              candidates before the partitioning.
+   *
+   * @return False if the fused build can not be used. No histogram is allocated in that
+   *         case and the caller should fall back to @ref BuildHistLeftRight.
+   */
+  template <typename ExpandEntry>
+  [[nodiscard]] bool PrepareFusedHist(RegTree const *p_tree,
+                                      std::vector<ExpandEntry> const &valid_candidates,
+                                      common::BlockedSpace2d const &space) {
+    // Only single-target trees with a single page are supported.
+    if (target_builders_.size() != 1 || valid_candidates.empty()) {
+      return false;
+    }
+    std::vector<bst_node_t> nodes_to_build(valid_candidates.size());
+    std::vector<bst_node_t> nodes_to_sub(valid_candidates.size());
+    AssignNodes(p_tree, valid_candidates, nodes_to_build, nodes_to_sub);
+    auto &builder = target_builders_.front();
+    // Rearranging the cache might turn subtraction nodes into build nodes, which breaks
+    // the one-to-one mapping between the candidates and the partitioner nodes.
+    if (!builder.Histogram().CanHost(nodes_to_build, nodes_to_sub) ||
+        builder.Histogram().HasExceeded()) {
+      return false;
+    }
+    builder.AddHistRows(p_tree, &nodes_to_build, &nodes_to_sub, true);
+    CHECK_EQ(nodes_to_build.size(), valid_candidates.size());
+    builder.ResetBuffer(space, nodes_to_build);
+
+    fused_nodes_to_build_ = std::move(nodes_to_build);
+    fused_nodes_to_sub_ = std::move(nodes_to_sub);
+    return true;
+  }
+  /**
+   * @brief Merge callback for the row partitioner, builds the histogram for the smaller
+   *        child of the `node_in_set`-th candidate.
+   */
+  void BuildFusedHist(std::size_t node_in_set, RegTree const *p_tree, bst_node_t parent,
+                      GHistIndexMatrix const &gidx, common::Span<bst_idx_t const> left,
+                      common::Span<bst_idx_t const> right,
+                      linalg::MatrixView<GradientPair const> gpair) {
+    auto nidx = fused_nodes_to_build_[node_in_set];
+    auto rid_set = nidx == p_tree->LeftChild(parent) ? left : right;
+    target_builders_.front().BuildBlockHist(node_in_set, gidx, rid_set,
+                                            gpair.Slice(linalg::All(), 0));
+  }
+  /**
+   * @brief Reduce the histograms built by @ref BuildFusedHist and apply the subtraction
+   *        trick.
+   */
+  void SyncFusedHist(Context const *ctx, RegTree const *p_tree) {
+    CHECK(!fused_nodes_to_build_.empty());
+    target_builders_.front().SyncHistogram(ctx, p_tree, fused_nodes_to_build_,
+                                           fused_nodes_to_sub_);
+    fused_nodes_to_build_.clear();
+    fused_nodes_to_sub_.clear();
+  }
+
   [[nodiscard]] auto const &Histogram(bst_target_t t) const {
     return target_builders_[t].Histogram();
   }
@@ -340,6 +605,14 @@ class MultiHistogramBuilder {
       v.Reset(ctx, total_bins, p, is_distributed, is_col_split, param);
     }
   }
+  /**
+   * @brief Shard the histograms by features, only for single-target trees.
+   */
+  void ShardHistogram(std::vector<std::uint32_t> const &ptrs,
+                      std::vector<bst_feature_t> const &feature_shards) {
+    CHECK_EQ(target_builders_.size(), 1) << "Multi-target trees don't support sharding.";
+    target_builders_.front().ShardHistogram(ptrs, feature_shards);
+  }
 };
 }  // namespace xgboost::tree
 #endif  // XGBOOST_TREE_HIST_HISTOGRAM_H_
@@ -40,6 +40,8 @@ struct TrainParam : public XGBoostParameter<TrainParam> {
   uint32_t max_cat_to_onehot{4};
 
   bst_bin_t max_cat_threshold{64};
+  // number of categories kept for partition-based splits in each node, 0 to disable
+  bst_bin_t max_cat_per_node{0};
 
   //----- the rest parameters are less important ----
   // minimum amount of hessian(weight) allowed in a child
@@ -120,6 +122,13 @@ struct TrainParam : public XGBoostParameter<TrainParam> {
         .describe(
             "Maximum number of categories considered for split. Used only by partition-based"
             "splits.");
+    DMLC_DECLARE_FIELD(max_cat_per_node)
+        .set_default(0)
+        .set_lower_bound(0)
+        .describe(
+            "Maximum number of categories kept in each node for partition-based splits, ranked "
+            "by hessian. The rest are bucketed into a single category that goes to the left "
+            "child. 0 to keep all categories.");
     DMLC_DECLARE_FIELD(min_child_weight)
         .set_lower_bound(0.0f)
         .set_default(1.0f)
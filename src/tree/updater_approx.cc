@@ -4,14 +4,16 @@
  * \brief Implementation for the approx tree method.
  */
 #include <algorithm>  // for max, transform, fill_n
+#include <cmath>      // for abs
 #include <cstddef>    // for size_t
+#include <cstdint>    // for int32_t
 #include <map>        // for map
 #include <memory>     // for allocator, unique_ptr, make_shared, make_unique
 #include <utility>    // for move
 #include <vector>     // for vector
 
 #include "../collective/aggregator.h"        // for GlobalSum
-#include "../collective/communicator-inl.h"  // for IsDistributed
+#include "../collective/communicator-inl.h"  // for IsDistributed, IsFederated, GetWorldSize
 #include "../common/hist_util.h"             // for HistogramCuts
 #include "../common/random.h"                // for ColumnSampler
 #include "../common/timer.h"                 // for Monitor
@@ -21,7 +23,7 @@
 #include "driver.h"                          // for Driver
 #include "hist/evaluate_splits.h"            // for HistEvaluator, UpdatePredictionCacheImpl
 #include "hist/expand_entry.h"               // for CPUExpandEntry
-#include "hist/histogram.h"                  // for MultiHistogramBuilder
+#include "hist/histogram.h"                  // for MultiHistogramBuilder, ShardFeatures
 #include "hist/hist_param.h"                 // for HistMakerTrainParam
 #include "hist/sampler.h"                    // for SampleGradient
 #include "param.h"                           // for GradStats, TrainParam
@@ -43,8 +45,8 @@ DMLC_REGISTRY_FILE_TAG(updater_approx);
 
 namespace {
 // Return the BatchParam used by DMatrix.
-auto BatchSpec(TrainParam const &p, common::Span<float> hess, ObjInfo const task) {
-  return BatchParam{p.max_bin, hess, !task.const_hess};
+auto BatchSpec(TrainParam const &p, common::Span<float> hess, ObjInfo const task, bool resketch) {
+  return BatchParam{p.max_bin, hess, !task.const_hess && resketch};
 }
 
 auto BatchSpec(TrainParam const &p, common::Span<float> hess) {
@@ -71,15 +73,16 @@ class GlobalApproxBuilder {
   common::HistogramCuts feature_values_;
 
  public:
-  void InitData(DMatrix *p_fmat, RegTree const *p_tree, common::Span<float> hess) {
+  void InitData(DMatrix *p_fmat, RegTree const *p_tree, common::Span<float> hess,
+                bool resketch) {
     monitor_->Start(__func__);
 
     n_batches_ = 0;
     bst_bin_t n_total_bins = 0;
     partitioner_.clear();
     // Generating the GHistIndexMatrix is quite slow, is there a way to speed it up?
-    for (auto const &page :
-         p_fmat->GetBatches<GHistIndexMatrix>(ctx_, BatchSpec(*param_, hess, *task_))) {
+    for (auto const &page : p_fmat->GetBatches<GHistIndexMatrix>(
+             ctx_, BatchSpec(*param_, hess, *task_, resketch))) {
       if (n_total_bins == 0) {
         n_total_bins = page.cut.TotalBins();
         feature_values_ = page.cut;
@@ -94,6 +97,13 @@ class GlobalApproxBuilder {
     histogram_builder_.Reset(ctx_, n_total_bins, p_tree->NumTargets(), BatchSpec(*param_, hess),
                              collective::IsDistributed(), p_fmat->Info().IsColumnSplit(),
                              hist_param_);
+    std::vector<bst_feature_t> shards;
+    if (hist_param_->shard_hist_sync && collective::IsDistributed() &&
+        !p_fmat->Info().IsColumnSplit() && !collective::IsFederated()) {
+      shards = ShardFeatures(feature_values_, collective::GetWorldSize());
+      histogram_builder_.ShardHistogram(feature_values_.Ptrs(), shards);
+    }
+    evaluator_.SetFeatureShards(std::move(shards));
     monitor_->Stop(__func__);
   }
 
@@ -175,10 +185,14 @@ class GlobalApproxBuilder {
         task_{task},
         monitor_{monitor} {}
 
+  /**
+   * @param resketch Whether the gradient index should be regenerated with the current
+   *                 hessian. Otherwise the existing one from a previous update is reused.
+   */
   void UpdateTree(DMatrix *p_fmat, std::vector<GradientPair> const &gpair, common::Span<float> hess,
-                  RegTree *p_tree, HostDeviceVector<bst_node_t> *p_out_position) {
+                  bool resketch, RegTree *p_tree, HostDeviceVector<bst_node_t> *p_out_position) {
     p_last_tree_ = p_tree;
-    this->InitData(p_fmat, p_tree, hess);
+    this->InitData(p_fmat, p_tree, hess, resketch);
 
     Driver<CPUExpandEntry> driver(*param_);
     auto &tree = *p_tree;
@@ -245,7 +259,7 @@ class GlobalApproxBuilder {
 
 /**
  * \brief Implementation for the approx tree method.  It constructs quantile for every
- *        iteration.
+ *        iteration unless `approx_sketch_interval` is set.
  */
 class GlobalApproxUpdater : public TreeUpdater {
   common::Monitor monitor_;
@@ -256,6 +270,35 @@ class GlobalApproxUpdater : public TreeUpdater {
   std::shared_ptr<common::ColumnSampler> column_sampler_;
   ObjInfo const *task_;
   HistMakerTrainParam hist_param_;
+  // Number of updates since the last sketch, used with `approx_sketch_interval`.
+  std::int32_t n_since_sketch_{0};
+  // Hessian used for the last sketch, kept for reporting how much it has drifted.
+  std::vector<float> sketch_hess_;
+
+  /**
+   * @brief Decide whether the data should be sketched again for this update.
+   */
+  bool ShouldResketch(DMatrix const *m, common::Span<float const> hess) {
+    auto interval = hist_param_.approx_sketch_interval;
+    if (m != cached_ || sketch_hess_.size() != hess.size() || n_since_sketch_ + 1 >= interval) {
+      n_since_sketch_ = 0;
+      if (interval > 1) {
+        sketch_hess_.assign(hess.cbegin(), hess.cend());
+      }
+      return true;
+    }
+    ++n_since_sketch_;
+    // Report the relative L1 change of hessian since the sketch to help choosing the
+    // interval. The larger it is, the further the cuts are from the weighted quantiles.
+    double diff{0}, total{0};
+    for (std::size_t i = 0; i < hess.size(); ++i) {
+      diff += std::abs(static_cast<double>(hess[i]) - sketch_hess_[i]);
+      total += sketch_hess_[i];
+    }
+    LOG(DEBUG) << "Reusing the approx sketch from " << n_since_sketch_
+               << " update(s) ago, relative hessian change: " << (total > 0 ? diff / total : 0.0);
+    return false;
+  }
 
  public:
   explicit GlobalApproxUpdater(Context const *ctx, ObjInfo const *task)
@@ -302,11 +345,16 @@ class GlobalApproxUpdater : public TreeUpdater {
     std::transform(s_gpair.begin(), s_gpair.end(), hess.begin(),
                    [](auto g) { return g.GetHess(); });
 
+    monitor_.Start("ShouldResketch");
+    auto resketch = this->ShouldResketch(m, hess);
+    monitor_.Stop("ShouldResketch");
     cached_ = m;
 
     std::size_t t_idx = 0;
     for (auto p_tree : trees) {
-      this->pimpl_->UpdateTree(m, s_gpair, hess, p_tree, &out_position[t_idx]);
+      // All trees in this update share the same hessian, sketch only once.
+      this->pimpl_->UpdateTree(m, s_gpair, hess, resketch && t_idx == 0, p_tree,
+                               &out_position[t_idx]);
       hist_param_.CheckTreesSynchronized(ctx_, p_tree);
       ++t_idx;
     }
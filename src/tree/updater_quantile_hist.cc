@@ -13,7 +13,7 @@
 #include <vector>     // for vector
 
 #include "../collective/aggregator.h"        // for GlobalSum
-#include "../collective/communicator-inl.h"  // for IsDistributed
+#include "../collective/communicator-inl.h"  // for IsDistributed, IsFederated, GetWorldSize
 #include "../common/hist_util.h"             // for HistogramCuts, GHistRow
 #include "../common/linalg_op.h"             // for begin, cbegin, cend
 #include "../common/random.h"                // for ColumnSampler
@@ -26,7 +26,7 @@
 #include "hist/evaluate_splits.h"            // for HistEvaluator, HistMultiEvaluator, UpdatePre...
 #include "hist/expand_entry.h"               // for MultiExpandEntry, CPUExpandEntry
 #include "hist/hist_cache.h"                 // for BoundedHistCollection
-#include "hist/histogram.h"                  // for MultiHistogramBuilder
+#include "hist/histogram.h"                  // for MultiHistogramBuilder, ShardFeatures
 #include "hist/hist_param.h"                 // for HistMakerTrainParam
 #include "hist/sampler.h"                    // for SampleGradient
 #include "param.h"                           // for TrainParam, GradStats
@@ -84,7 +84,7 @@ void UpdateTree(common::Monitor *monitor, linalg::MatrixView<GradientPair const>
       }
     }
 
-    updater->UpdatePosition(p_fmat, p_tree, applied);
+    updater->UpdatePosition(p_fmat, p_tree, applied, valid_candidates, gpair);
 
     std::vector<ExpandEntry> best_splits;
     if (!valid_candidates.empty()) {
@@ -132,7 +132,9 @@ class MultiTargetHistBuilder {
 
  public:
   void UpdatePosition(DMatrix *p_fmat, RegTree const *p_tree,
-                      std::vector<MultiExpandEntry> const &applied) {
+                      std::vector<MultiExpandEntry> const &applied,
+                      std::vector<MultiExpandEntry> const & /*valid_candidates*/,
+                      linalg::MatrixView<GradientPair const> /*gpair*/) {
     monitor_->Start(__func__);
     std::size_t page_id{0};
     for (auto const &page : p_fmat->GetBatches<GHistIndexMatrix>(ctx_, HistBatch(this->param_))) {
@@ -311,6 +313,8 @@ class HistUpdater {
   ObjInfo const *task_{nullptr};
   // Context for number of threads
   Context const *ctx_{nullptr};
+  // Whether the histogram has been built by the last `UpdatePosition`.
+  bool hist_is_fused_{false};
 
  public:
   explicit HistUpdater(Context const *ctx, std::shared_ptr<common::ColumnSampler> column_sampler,
@@ -347,9 +351,18 @@ class HistUpdater {
     monitor_->Start(__func__);
     bst_bin_t n_total_bins{0};
     size_t page_idx = 0;
+    bool shard = hist_param_->shard_hist_sync && collective::IsDistributed() &&
+                 !fmat->Info().IsColumnSplit() && !collective::IsFederated();
+    std::vector<bst_feature_t> shards;
+    std::vector<std::uint32_t> cut_ptrs;
     for (auto const &page : fmat->GetBatches<GHistIndexMatrix>(ctx_, HistBatch(param_))) {
       if (n_total_bins == 0) {
         n_total_bins = page.cut.TotalBins();
+        if (shard) {
+          // All pages share the same cuts.
+          shards = ShardFeatures(page.cut, collective::GetWorldSize());
+          cut_ptrs = page.cut.Ptrs();
+        }
       } else {
         CHECK_EQ(n_total_bins, page.cut.TotalBins());
       }
@@ -365,6 +378,10 @@ class HistUpdater {
     histogram_builder_->Reset(ctx_, n_total_bins, 1, HistBatch(param_), collective::IsDistributed(),
                               fmat->Info().IsColumnSplit(), hist_param_);
     evaluator_ = std::make_unique<HistEvaluator>(ctx_, this->param_, fmat->Info(), col_sampler_);
+    if (shard && !cut_ptrs.empty()) {
+      histogram_builder_->ShardHistogram(cut_ptrs, shards);
+      evaluator_->SetFeatureShards(std::move(shards));
+    }
     p_last_tree_ = p_tree;
     monitor_->Stop(__func__);
   }
@@ -446,17 +463,45 @@ class HistUpdater {
                       std::vector<CPUExpandEntry> const &valid_candidates,
                       linalg::MatrixView<GradientPair const> gpair) {
     monitor_->Start(__func__);
-    this->histogram_builder_->BuildHistLeftRight(ctx_, p_fmat, p_tree, partitioner_,
-                                                 valid_candidates, gpair, HistBatch(param_));
+    if (hist_is_fused_) {
+      // The smaller children have been built during partitioning.
+      this->histogram_builder_->SyncFusedHist(ctx_, p_tree);
+      hist_is_fused_ = false;
+    } else {
+      this->histogram_builder_->BuildHistLeftRight(ctx_, p_fmat, p_tree, partitioner_,
+                                                   valid_candidates, gpair, HistBatch(param_));
+    }
     monitor_->Stop(__func__);
   }
 
   void UpdatePosition(DMatrix *p_fmat, RegTree const *p_tree,
-                      std::vector<CPUExpandEntry> const &applied) {
+                      std::vector<CPUExpandEntry> const &applied,
+                      std::vector<CPUExpandEntry> const &valid_candidates,
+                      linalg::MatrixView<GradientPair const> gpair) {
     monitor_->Start(__func__);
+    // The fused build requires the partitioner nodes to be the same as the histogram
+    // nodes, which is true unless some of the children are not going to be expanded.
+    bool fuse = hist_param_->fuse_partition_hist && partitioner_.size() == 1 &&
+                applied.size() == valid_candidates.size();
     std::size_t page_id{0};
     for (auto const &page : p_fmat->GetBatches<GHistIndexMatrix>(ctx_, HistBatch(param_))) {
-      this->partitioner_.at(page_id).UpdatePosition(this->ctx_, page, applied, p_tree);
+      auto &partitioner = this->partitioner_.at(page_id);
+      if (fuse) {
+        hist_is_fused_ = this->histogram_builder_->PrepareFusedHist(
+            p_tree, valid_candidates, partitioner.PartitionSpace(applied));
+      }
+      if (hist_is_fused_) {
+        partitioner.UpdatePosition(
+            this->ctx_, page, applied, p_tree,
+            [&](std::size_t node_in_set, common::Span<bst_idx_t const> left,
+                common::Span<bst_idx_t const> right) {
+              this->histogram_builder_->BuildFusedHist(node_in_set, p_tree,
+                                                       applied[node_in_set].nid, page, left,
+                                                       right, gpair);
+            });
+      } else {
+        partitioner.UpdatePosition(this->ctx_, page, applied, p_tree);
+      }
       page_id++;
     }
     monitor_->Stop(__func__);
@@ -3,11 +3,17 @@
  */
 #include <gtest/gtest.h>
 
+#include <cstring>  // for memcpy
+#include <future>   // for future
+#include <memory>   // for make_shared
 #include <numeric>  // for iota
+#include <string>   // for string
 
 #include "../../../src/collective/allreduce.h"
-#include "../../../src/collective/coll.h"  // for Coll
-#include "../../../src/common/type.h"  // for EraseType
+#include "../../../src/collective/coll.h"                // for Coll, AllreduceAlgo
+#include "../../../src/collective/hierarchical.h"        // for HierarchicalAllreduce
+#include "../../../src/collective/in_memory_handler.h"  // for InMemoryHandler
+#include "../../../src/common/type.h"                    // for EraseType
 #include "test_worker.h"               // for WorkerForTest, TestDistributed
 
 namespace xgboost::collective {
@@ -80,6 +86,87 @@ class AllreduceWorker : public WorkerForTest {
       ASSERT_EQ(v, ~std::uint32_t{0});
     }
   }
+
+  // Compare the result of an allreduce algorithm with the in-memory handler.
+  void Algo(InMemoryHandler* handler, AllreduceAlgo algo, std::size_t* seq) {
+    auto world = static_cast<std::size_t>(comm_.World());
+    auto rank = comm_.Rank();
+    Coll coll{algo};
+    std::vector<std::size_t> sizes{1, 3, world, world * 2 + 1, 4099};
+    for (auto n : sizes) {
+      for (auto op : {Op::kSum, Op::kMax}) {
+        std::vector<std::int64_t> data(n);
+        for (std::size_t i = 0; i < n; ++i) {
+          data[i] = static_cast<std::int64_t>((i * 7 + rank * 13) % 31) - rank;
+        }
+        std::string expected;
+        auto s_data = common::Span{data.data(), data.size()};
+        handler->Allreduce(reinterpret_cast<char const*>(data.data()), s_data.size_bytes(),
+                           &expected, (*seq)++, rank, ArrayInterfaceHandler::kI8, op);
+        ASSERT_EQ(expected.size(), s_data.size_bytes());
+        std::vector<std::int64_t> h_expected(n);
+        std::memcpy(h_expected.data(), expected.data(), expected.size());
+
+        auto rc = coll.Allreduce(comm_, common::EraseType(s_data), ArrayInterfaceHandler::kI8, op);
+        SafeColl(rc);
+        ASSERT_EQ(data, h_expected) << "n:" << n << " algo:" << static_cast<std::int32_t>(algo);
+      }
+    }
+  }
+
+  void Streams(std::int32_t n_streams) {
+    auto world = comm_.World();
+    for (std::int32_t r = 0; r < world; ++r) {
+      if (r != comm_.Rank()) {
+        ASSERT_EQ(comm_.Chan(r)->NumStreams(), n_streams);
+      }
+    }
+    // Large enough for each segment of the ring to be striped across all streams.
+    std::size_t n = Channel::MinStripeBytes() * n_streams * world / sizeof(std::int64_t) + 7;
+    std::vector<std::int64_t> data(n);
+    std::iota(data.begin(), data.end(), comm_.Rank());
+    auto rc = Allreduce(comm_, common::Span{data.data(), data.size()}, [](auto lhs, auto rhs) {
+      for (std::size_t i = 0; i < rhs.size(); ++i) {
+        rhs[i] += lhs[i];
+      }
+    });
+    SafeColl(rc);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto expected = static_cast<std::int64_t>(i) * world + world * (world - 1) / 2;
+      ASSERT_EQ(data[i], expected) << i;
+    }
+  }
+
+  // Simulate multiple hosts by assigning fake host names.
+  void Hierarchical(std::int32_t n_per_host) {
+    auto rank = comm_.Rank();
+    auto world = comm_.World();
+    // Use a small slot to test chunking.
+    cpu_impl::HierarchicalAllreduce hier{256};
+    SafeColl(hier.Init(comm_, "host-" + std::to_string(rank / n_per_host)));
+    ASSERT_TRUE(hier.Enabled());
+    ASSERT_EQ(hier.IsLeader(), rank % n_per_host == 0);
+
+    auto op = [](common::Span<std::int8_t const> lhs, common::Span<std::int8_t> out) {
+      auto lhs_t = common::RestoreType<std::int64_t const>(lhs);
+      auto out_t = common::RestoreType<std::int64_t>(out);
+      for (std::size_t i = 0; i < out_t.size(); ++i) {
+        out_t[i] += lhs_t[i];
+      }
+    };
+    for (std::size_t n : {1ul, 32ul, 33ul, 1027ul}) {
+      std::vector<std::int64_t> data(n);
+      std::iota(data.begin(), data.end(), rank);
+      auto rc = hier.Allreduce(common::EraseType(common::Span{data.data(), data.size()}), op,
+                               ArrayInterfaceHandler::kI8, AllreduceAlgo::kAuto);
+      SafeColl(rc);
+      for (std::size_t i = 0; i < n; ++i) {
+        // sum_r (i + r)
+        auto expected = static_cast<std::int64_t>(i) * world + world * (world - 1) / 2;
+        ASSERT_EQ(data[i], expected) << "n:" << n << " i:" << i;
+      }
+    }
+  }
 };
 
 class AllreduceTest : public SocketTest {};
@@ -124,6 +211,65 @@ TEST_F(AllreduceTest, Restricted) {
       timeout);
 }
 
+TEST_F(AllreduceTest, Algorithms) {
+  for (std::int32_t n_workers : {2, 3, 4, 5, 7}) {
+    auto handler = std::make_shared<InMemoryHandler>(n_workers);
+    TestDistributed(n_workers, [=](std::string host, std::int32_t port,
+                                   std::chrono::seconds timeout, std::int32_t r) {
+      AllreduceWorker worker{host, port, timeout, n_workers, r};
+      std::size_t seq = 0;
+      for (auto algo : {AllreduceAlgo::kRing, AllreduceAlgo::kRecursiveDoubling,
+                        AllreduceAlgo::kRabenseifner, AllreduceAlgo::kAuto}) {
+        worker.Algo(handler.get(), algo, &seq);
+      }
+    });
+  }
+}
+
+TEST_F(AllreduceTest, Hierarchical) {
+  std::int32_t n_workers = std::min(7u, std::thread::hardware_concurrency());
+  if (n_workers < 2) {
+    GTEST_SKIP_("Requires at least two workers.");
+  }
+  for (std::int32_t n_per_host : {2, 3}) {
+    TestDistributed(n_workers, [=](std::string host, std::int32_t port,
+                                   std::chrono::seconds timeout, std::int32_t r) {
+      AllreduceWorker worker{host, port, timeout, n_workers, r};
+      worker.Hierarchical(n_per_host);
+    });
+  }
+}
+
+TEST_F(AllreduceTest, Streams) {
+  std::int32_t n_workers = std::min(4u, std::thread::hardware_concurrency());
+  std::int32_t n_streams = 3;
+  auto handler = std::make_shared<InMemoryHandler>(n_workers);
+  TestDistributed(
+      n_workers,
+      [=](std::string host, std::int32_t port, std::chrono::seconds timeout, std::int32_t r) {
+        AllreduceWorker worker{host, port, timeout, n_workers, r};
+        worker.Basic();
+        worker.Acc();
+        std::size_t seq = 0;
+        for (auto algo : {AllreduceAlgo::kRing, AllreduceAlgo::kRecursiveDoubling,
+                          AllreduceAlgo::kRabenseifner}) {
+          worker.Algo(handler.get(), algo, &seq);
+        }
+        worker.Streams(n_streams);
+      },
+      std::chrono::seconds{3}, n_streams);
+}
+
+TEST(Allreduce, SelectAlgo) {
+  ASSERT_EQ(cpu_impl::SelectAllreduceAlgo(8, 1, 2), AllreduceAlgo::kRing);
+  ASSERT_EQ(cpu_impl::SelectAllreduceAlgo(8, 1, 5), AllreduceAlgo::kRecursiveDoubling);
+  ASSERT_EQ(cpu_impl::SelectAllreduceAlgo(64 * 1024, 16 * 1024, 5), AllreduceAlgo::kRabenseifner);
+  ASSERT_EQ(cpu_impl::SelectAllreduceAlgo(64ul << 20, 16ul << 20, 5), AllreduceAlgo::kRing);
+
+  ASSERT_EQ(ParseAllreduceAlgo("rabenseifner"), AllreduceAlgo::kRabenseifner);
+  ASSERT_THROW({ [[maybe_unused]] auto algo = ParseAllreduceAlgo("tree"); }, dmlc::Error);
+}
+
 TEST(AllreduceGlobal, Basic) {
   auto n_workers = 3;
   TestDistributedGlobal(n_workers, [&]() {
@@ -144,6 +290,53 @@ TEST(AllreduceGlobal, Basic) {
   });
 }
 
+TEST(AllreduceGlobal, Async) {
+  auto n_workers = 3;
+  TestDistributedGlobal(n_workers, [&]() {
+    Context ctx;
+    std::vector<std::vector<double>> values(4);
+    std::vector<std::future<Result>> futures;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i].resize(17 * (i + 1), static_cast<double>(GetRank() + i));
+      futures.emplace_back(AllreduceAsync(
+          &ctx, linalg::MakeVec(values[i].data(), values[i].size()), collective::Op::kSum));
+    }
+    for (auto& fut : futures) {
+      SafeColl(fut.get());
+    }
+    // A synchronous collective after all pending ones are finished.
+    std::uint64_t n{1};
+    SafeColl(Allreduce(&ctx, linalg::MakeVec(&n, 1), collective::Op::kSum));
+    ASSERT_EQ(n, n_workers);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      // sum_r (r + i)
+      auto expected = static_cast<double>(n_workers * (n_workers - 1) / 2 + n_workers * i);
+      for (auto v : values[i]) {
+        ASSERT_EQ(v, expected);
+      }
+    }
+  });
+}
+
+TEST(AllreduceGlobal, AsyncError) {
+  auto n_workers = 2;
+  TestDistributedGlobal(n_workers, [&]() {
+    auto const& comm = *GlobalCommGroup();
+    auto fut = comm.Async([]() -> Result {
+      LOG(FATAL) << "Failed in the background.";
+      return Success();
+    });
+    auto rc = fut.get();
+    ASSERT_FALSE(rc.OK());
+    ASSERT_NE(rc.Report().find("Failed in the background."), std::string::npos);
+    // The background thread is still usable.
+    Context ctx;
+    std::int32_t n{1};
+    SafeColl(AllreduceAsync(&ctx, linalg::MakeVec(&n, 1), collective::Op::kSum).get());
+    ASSERT_EQ(n, n_workers);
+  });
+}
+
 TEST(AllreduceGlobal, Small) {
   // Test when the data is not large enougth to be divided by the number of workers
   auto n_workers = 8;
@@ -3,6 +3,8 @@
  */
 #include <gtest/gtest.h>
 
+#include <numeric>  // for iota
+
 #include "../../../src/collective/comm.h"
 #include "../../../src/common/type.h"  // for EraseType
 #include "test_worker.h"               // for TrackerTest
@@ -49,4 +51,51 @@ TEST_F(CommTest, Channel) {
 
   SafeColl(fut.get());
 }
+
+TEST_F(CommTest, Streams) {
+  auto n_workers = 2;
+  std::int32_t n_streams = 3;
+  RabitTracker tracker{MakeTrackerConfig(host, n_workers, timeout, n_streams)};
+  auto fut = tracker.Run();
+
+  std::vector<std::thread> workers;
+  std::int32_t port = tracker.Port();
+
+  for (std::int32_t i = 0; i < n_workers; ++i) {
+    workers.emplace_back([=] {
+      WorkerForTest worker{host, port, timeout, n_workers, i};
+      auto p_chan = worker.Comm().Chan(1 - i);
+      ASSERT_EQ(p_chan->NumStreams(), n_streams);
+      auto min_bytes = Channel::MinStripeBytes();
+      // From a single stream to all streams with uneven parts.
+      for (std::size_t n : {std::size_t{1}, min_bytes * 2 - 1, min_bytes * 2,
+                            min_bytes * n_streams + 5, min_bytes * 7 + 3}) {
+        std::vector<std::int8_t> data(n);
+        if (i == 0) {
+          std::iota(data.begin(), data.end(), 0);
+        }
+        auto rc = Success() << [&] {
+          if (i == 0) {
+            return p_chan->SendAll(common::Span<std::int8_t const>{data.data(), data.size()});
+          }
+          return p_chan->RecvAll(common::Span<std::int8_t>{data.data(), data.size()});
+        } << [&] {
+          return p_chan->Block();
+        };
+        SafeColl(rc);
+        if (i == 1) {
+          for (std::size_t j = 0; j < n; ++j) {
+            ASSERT_EQ(data[j], static_cast<std::int8_t>(j)) << "n:" << n;
+          }
+        }
+      }
+    });
+  }
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  SafeColl(fut.get());
+}
 }  // namespace xgboost::collective
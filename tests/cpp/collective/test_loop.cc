@@ -1,18 +1,24 @@
 /**
  * Copyright 2023-2024, XGBoost Contributors
  */
+#include <gmock/gmock.h>                // for ASSERT_THAT
 #include <gtest/gtest.h>                // for ASSERT_TRUE, ASSERT_EQ
 #include <xgboost/collective/socket.h>  // for TCPSocket, Connect, SocketFinalize, SocketStartup
 #include <xgboost/string_view.h>        // for StringView
 
-#include <chrono>        // for seconds
-#include <cstdint>       // for int8_t
+#include <algorithm>     // for fill
+#include <chrono>        // for seconds, microseconds
+#include <cstddef>       // for size_t
+#include <cstdint>       // for int8_t, int32_t, int64_t
 #include <memory>        // for make_shared, shared_ptr
+#include <numeric>       // for iota
 #include <system_error>  // for make_error_code, errc
+#include <tuple>         // for ignore
 #include <utility>       // for pair
 #include <vector>        // for vector
 
-#include "../../../src/collective/loop.h"  // for Loop
+#include "../../../src/collective/loop.h"  // for Loop, LoopBackend, ParseLoopBackend
+#include "../helpers.h"                    // for GMockThrow
 
 namespace xgboost::collective {
 namespace {
@@ -22,8 +28,7 @@ class LoopTest : public ::testing::Test {
   std::shared_ptr<Loop> loop_;
 
  protected:
-  void SetUp() override {
-    system::SocketStartup();
+  void MakePair() {
     std::chrono::seconds timeout{1};
 
     auto domain = SockDomain::kV4;
@@ -45,8 +50,12 @@ class LoopTest : public ::testing::Test {
     pair_.first = pair_.first.Accept();
     rc = pair_.first.NonBlocking(true);
     SafeColl(rc);
+  }
 
-    loop_ = std::shared_ptr<Loop>{new Loop{timeout}};
+  void SetUp() override {
+    system::SocketStartup();
+    this->MakePair();
+    loop_ = std::shared_ptr<Loop>{new Loop{std::chrono::seconds{1}}};
   }
 
   void TearDown() override {
@@ -84,6 +93,67 @@ TEST_F(LoopTest, Op) {
   ASSERT_EQ(rbuf[0], wbuf[0]);
 }
 
+TEST_F(LoopTest, Backends) {
+  TCPSocket& send = pair_.first;
+  TCPSocket& recv = pair_.second;
+  std::vector<LoopBackend> backends{LoopBackend::kPoll};
+#if defined(__linux__)
+  backends.push_back(LoopBackend::kEpoll);
+#endif  // defined(__linux__)
+
+  for (auto backend : backends) {
+    for (std::int64_t busy_poll : {0, 100}) {
+      loop_ = std::make_shared<Loop>(std::chrono::seconds{1}, backend,
+                                     std::chrono::microseconds{busy_poll});
+      // Large enough to require multiple rounds.
+      std::size_t n = 1 << 22;
+      std::vector<std::int8_t> wbuf(n);
+      std::iota(wbuf.begin(), wbuf.end(), 0);
+      std::vector<std::int8_t> rbuf(n, 0);
+      for (std::int32_t i = 0; i < 2; ++i) {
+        std::fill(rbuf.begin(), rbuf.end(), 0);
+        loop_->Submit(Loop::Op{Loop::Op::kWrite, 0, wbuf.data(), wbuf.size(), &send, 0});
+        loop_->Submit(Loop::Op{Loop::Op::kRead, 0, rbuf.data(), rbuf.size(), &recv, 0});
+        SafeColl(loop_->Block());
+        ASSERT_EQ(rbuf, wbuf);
+      }
+
+      // The read interest from the previous operations doesn't affect the timeout.
+      std::vector<std::int8_t> data(1);
+      loop_->Submit(Loop::Op{Loop::Op::kRead, 0, data.data(), data.size(), &recv, 0});
+      auto rc = loop_->Block();
+      ASSERT_FALSE(rc.OK());
+      ASSERT_EQ(rc.Code(), std::make_error_code(std::errc::timed_out)) << rc.Report();
+    }
+  }
+}
+
+#if defined(__linux__)
+TEST_F(LoopTest, EpollReuseSocket) {
+  loop_ = std::make_shared<Loop>(std::chrono::seconds{1}, LoopBackend::kEpoll);
+  for (std::int32_t i = 0; i < 3; ++i) {
+    // Close the sockets and create new ones in place, the fds are likely to be reused.
+    pair_ = decltype(pair_){};
+    this->MakePair();
+
+    std::vector<std::int8_t> wbuf(16, static_cast<std::int8_t>(i + 1));
+    std::vector<std::int8_t> rbuf(wbuf.size(), 0);
+    loop_->Submit(Loop::Op{Loop::Op::kWrite, 0, wbuf.data(), wbuf.size(), &pair_.first, 0});
+    loop_->Submit(Loop::Op{Loop::Op::kRead, 0, rbuf.data(), rbuf.size(), &pair_.second, 0});
+    SafeColl(loop_->Block());
+    ASSERT_EQ(rbuf, wbuf);
+  }
+}
+#endif  // defined(__linux__)
+
+TEST(Loop, ParseBackend) {
+  ASSERT_EQ(ParseLoopBackend("auto"), LoopBackend::kAuto);
+  ASSERT_EQ(ParseLoopBackend("poll"), LoopBackend::kPoll);
+  ASSERT_EQ(ParseLoopBackend("epoll"), LoopBackend::kEpoll);
+  ASSERT_THAT([] { std::ignore = ParseLoopBackend("select"); },
+              GMockThrow("Invalid event loop backend"));
+}
+
 TEST_F(LoopTest, Block) {
   // We need to ensure that a blocking call doesn't go unanswered.
   auto op = Loop::Op::Sleep(2);
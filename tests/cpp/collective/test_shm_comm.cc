@@ -0,0 +1,84 @@
+/**
+ * Copyright 2025, XGBoost Contributors
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>  // for fill_n, min
+#include <cstdint>    // for int32_t, int64_t
+#include <numeric>    // for iota
+#include <string>     // for string, to_string
+#include <thread>     // for thread
+#include <vector>     // for vector
+
+#include "../../../src/collective/allgather.h"  // for RingAllgather
+#include "../../../src/collective/allreduce.h"  // for Allreduce
+#include "../../../src/collective/broadcast.h"  // for Broadcast
+#include "../../../src/collective/coll.h"       // for Coll, AllreduceAlgo
+#include "../../../src/collective/shm_comm.h"   // for ShmComm
+#include "../../../src/common/type.h"           // for EraseType
+#include "test_worker.h"                        // for SocketTest, TestDistributed
+
+namespace xgboost::collective {
+namespace {
+class ShmCommTest : public SocketTest {};
+
+void TestShmComm(ShmComm const& comm) {
+  auto world = comm.World();
+  auto rank = comm.Rank();
+  for (std::size_t n : {std::size_t{1}, std::size_t{3}, std::size_t{4099}}) {
+    std::vector<std::int64_t> data(n);
+    std::iota(data.begin(), data.end(), rank);
+    auto rc = Allreduce(comm, common::Span{data.data(), data.size()}, [](auto lhs, auto rhs) {
+      for (std::size_t i = 0; i < rhs.size(); ++i) {
+        rhs[i] += lhs[i];
+      }
+    });
+    SafeColl(rc);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto expected = static_cast<std::int64_t>(i) * world + world * (world - 1) / 2;
+      ASSERT_EQ(data[i], expected) << "n:" << n;
+    }
+  }
+  {
+    Coll coll{AllreduceAlgo::kRecursiveDoubling};
+    std::vector<std::int32_t> data(1027, rank);
+    auto rc = coll.Allreduce(comm, common::EraseType(common::Span{data.data(), data.size()}),
+                             ArrayInterfaceHandler::kI4, Op::kMax);
+    SafeColl(rc);
+    for (auto v : data) {
+      ASSERT_EQ(v, world - 1);
+    }
+  }
+  {
+    std::vector<std::int32_t> data(world * 2048, -1);
+    std::fill_n(data.begin() + rank * 2048, 2048, rank);
+    auto rc = RingAllgather(comm, common::Span{data.data(), data.size()});
+    SafeColl(rc);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      ASSERT_EQ(data[i], static_cast<std::int32_t>(i / 2048));
+    }
+  }
+  {
+    std::vector<std::int32_t> data(5000, rank);
+    auto rc = Broadcast(comm, common::Span{data.data(), data.size()}, 1);
+    SafeColl(rc);
+    ASSERT_EQ(data, std::vector<std::int32_t>(5000, 1));
+  }
+}
+}  // namespace
+
+TEST_F(ShmCommTest, Basic) {
+  std::int32_t n_workers = std::min(4u, std::thread::hardware_concurrency());
+  if (n_workers < 2) {
+    GTEST_SKIP_("Requires at least two workers.");
+  }
+  TestDistributed(n_workers, [=](std::string host, std::int32_t port, std::chrono::seconds timeout,
+                                 std::int32_t r) {
+    // Use a small ring to test wrapping around.
+    ShmComm comm{host, port, timeout, 1, "t:" + std::to_string(r), DefaultNcclName(), 256};
+    ASSERT_EQ(comm.World(), n_workers);
+    TestShmComm(comm);
+    SafeColl(comm.Shutdown());
+  });
+}
+}  // namespace xgboost::collective
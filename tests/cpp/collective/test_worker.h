@@ -50,10 +50,13 @@ class WorkerForTest {
 
   void LimitSockBuf(std::int32_t n_bytes) {
     for (std::int32_t i = 0; i < comm_.World(); ++i) {
-      if (i != comm_.Rank()) {
-        ASSERT_TRUE(comm_.Chan(i)->Socket()->NonBlocking());
-        SafeColl(comm_.Chan(i)->Socket()->SetBufSize(n_bytes));
-        SafeColl(comm_.Chan(i)->Socket()->SetNoDelay());
+      if (i == comm_.Rank()) {
+        continue;
+      }
+      for (auto const& sock : comm_.Chan(i)->Sockets()) {
+        ASSERT_TRUE(sock->NonBlocking());
+        SafeColl(sock->SetBufSize(n_bytes));
+        SafeColl(sock->SetNoDelay());
       }
     }
   }
@@ -101,24 +104,26 @@ class TrackerTest : public SocketTest {
 };
 
 inline Json MakeTrackerConfig(std::string host, std::int32_t n_workers,
-                              std::chrono::seconds timeout) {
+                              std::chrono::seconds timeout, std::int32_t n_streams = 1) {
   Json config{Object{}};
   config["host"] = host;
   config["port"] = Integer{0};
   config["n_workers"] = Integer{n_workers};
   config["sortby"] = Integer{static_cast<std::int32_t>(Tracker::SortBy::kHost)};
   config["timeout"] = static_cast<std::int64_t>(timeout.count());
+  config["n_streams"] = Integer{n_streams};
   return config;
 }
 
 template <typename WorkerFn>
 void TestDistributed(std::int32_t n_workers, WorkerFn worker_fn,
-                     std::chrono::seconds timeout = std::chrono::seconds{3}) {
+                     std::chrono::seconds timeout = std::chrono::seconds{3},
+                     std::int32_t n_streams = 1) {
   std::string host;
   auto rc = GetHostAddress(&host);
   SafeColl(rc);
   LOG(INFO) << "Using " << n_workers << " workers for test.";
-  RabitTracker tracker{MakeTrackerConfig(host, n_workers, timeout)};
+  RabitTracker tracker{MakeTrackerConfig(host, n_workers, timeout, n_streams)};
   auto fut = tracker.Run();
 
   std::vector<std::thread> workers;
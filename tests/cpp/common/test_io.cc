@@ -228,6 +228,8 @@ TEST_F(TestFileStream, PrivateMmapStream) { this->Run<PrivateMmapConstStream>();
 
 TEST_F(TestFileStream, MemBufFileReadStream) { this->Run<MemBufFileReadStream>(); }
 
+TEST_F(TestFileStream, PreadFileReadStream) { this->Run<PreadFileReadStream>(); }
+
 TEST(IO, CmdOutput) {
   // Use a simple command that works in cmd.exe
   std::string output = CmdOutput("echo HelloWorld");
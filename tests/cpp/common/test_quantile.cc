@@ -5,7 +5,13 @@
 
 #include <gtest/gtest.h>
 
-#include <cstdint>  // for int64_t
+#include <xgboost/global_config.h>  // for GlobalConfigThreadLocalStore
+
+#include <algorithm>  // for sort, upper_bound
+#include <cmath>      // for round
+#include <cstdint>    // for int64_t
+#include <random>     // for mt19937, normal_distribution
+#include <tuple>      // for ignore
 
 #include "../../../src/collective/allreduce.h"
 #include "../../../src/common/hist_util.h"
@@ -165,6 +171,77 @@ TEST(Quantile, Distributed) {
   TestDistributedQuantile<false>(kRows, kCols);
 }
 
+TEST(Quantile, DistributedFewFeatures) {
+  // Less features than workers, some workers don't own any feature during the merge.
+  constexpr size_t kRows = 1000, kCols = 3;
+  TestDistributedQuantile<false>(kRows, kCols);
+}
+
+namespace {
+void DoTestDistributedMergeAccuracy(bst_idx_t rows, bst_feature_t cols) {
+  Context ctx;
+  auto const world = collective::GetWorldSize();
+  bst_bin_t n_bins = 64;
+  auto make = [&](std::int32_t rank) {
+    return RandomDataGenerator{rows, cols, 0.0f}
+        .Seed(rank)
+        .Lower(.0f)
+        .Upper(1.0f)
+        .GenerateDMatrix();
+  };
+  auto m = make(collective::GetRank());
+  std::vector<float> hessian(rows, 1.0);
+
+  auto make_cuts = [&](bool gather) {
+    HostSketchContainer sketch{&ctx, n_bins, {}, std::vector<bst_idx_t>(cols, rows), false};
+    sketch.SetGatherMerge(gather);
+    for (auto const& page : m->GetBatches<SparsePage>(&ctx)) {
+      sketch.PushRowPage(page, m->Info(), Span<float const>{hessian});
+    }
+    HistogramCuts cuts;
+    sketch.MakeCuts(&ctx, m->Info(), &cuts);
+    return cuts;
+  };
+  auto scatter_cuts = make_cuts(false);
+  auto gather_cuts = make_cuts(true);
+
+  // The largest fraction of the global data in a single bin, the ideal value is 1/n_bins.
+  auto max_bin_fraction = [&](HistogramCuts const& cuts) {
+    std::vector<std::vector<bst_idx_t>> counts(cols);
+    for (bst_feature_t f = 0; f < cols; ++f) {
+      counts[f].resize(cuts.Ptrs()[f + 1] - cuts.Ptrs()[f], 0);
+    }
+    for (std::int32_t r = 0; r < world; ++r) {
+      auto p_fmat = make(r);
+      for (auto const& page : p_fmat->GetBatches<SparsePage>(&ctx)) {
+        auto h_page = page.GetView();
+        for (std::size_t i = 0; i < h_page.Size(); ++i) {
+          for (auto const& e : h_page[i]) {
+            counts[e.index][cuts.SearchBin(e) - cuts.Ptrs()[e.index]]++;
+          }
+        }
+      }
+    }
+    double result = 0.0;
+    for (auto const& c : counts) {
+      auto n_max = *std::max_element(c.cbegin(), c.cend());
+      result = std::max(result, static_cast<double>(n_max) / (rows * world));
+    }
+    return result;
+  };
+  auto scatter_err = max_bin_fraction(scatter_cuts);
+  auto gather_err = max_bin_fraction(gather_cuts);
+  ASSERT_LE(scatter_err, gather_err + 0.25 / n_bins);
+}
+}  // anonymous namespace
+
+TEST(Quantile, DistributedMergeAccuracy) {
+  // Compare the cuts from the reduce-scatter merge with the ones from the gather merge.
+  constexpr bst_idx_t kRows = 8000;
+  constexpr bst_feature_t kCols = 4;
+  collective::TestDistributedGlobal(4, [=] { DoTestDistributedMergeAccuracy(kRows, kCols); });
+}
+
 TEST(Quantile, SortedDistributedBasic) {
   constexpr size_t kRows = 10, kCols = 10;
   TestDistributedQuantile<true>(kRows, kCols);
@@ -387,6 +464,94 @@ void TestSameOnAllWorkers() {
 }
 }  // anonymous namespace
 
+TEST(Quantile, RadixSort) {
+  std::mt19937 rng{3};
+  std::normal_distribution<float> dist{0.0f, 8.0f};
+  for (std::size_t n : {16ul, 1024ul, 4097ul}) {
+    std::vector<detail::SketchQEntry> entries(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      // Duplicated values and signed zeros.
+      auto v = i % 7 == 0 ? std::round(dist(rng)) : dist(rng);
+      entries[i] = detail::SketchQEntry{i % 11 == 0 ? -0.0f : v, static_cast<float>(i)};
+    }
+    auto sorted = entries;
+    std::stable_sort(sorted.begin(), sorted.end());
+    std::vector<detail::SketchQEntry> scratch;
+    detail::RadixSort(Span{entries}, &scratch);
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(entries[i].value, sorted[i].value);
+    }
+  }
+}
+
+TEST(Quantile, SortSketch) {
+  constexpr bst_idx_t kRows = 8192;
+  constexpr bst_feature_t kCols = 8;
+  constexpr bst_bin_t kBins = 64;
+  Context ctx;
+  std::vector<FeatureType> ft(kCols, FeatureType::kNumerical);
+  ft.back() = FeatureType::kCategorical;
+  auto m = RandomDataGenerator{kRows, kCols, 0.2}.Type(ft).MaxCategory(13).GenerateDMatrix();
+
+  auto& config = *GlobalConfigThreadLocalStore::Get();
+  auto cuts = SketchOnDMatrix(&ctx, m.get(), kBins);
+  config.sketch_method = "sort";
+  auto sort_cuts = SketchOnDMatrix(&ctx, m.get(), kBins);
+  config.sketch_method = "wq";
+  ASSERT_EQ(cuts.Ptrs().back(), sort_cuts.Ptrs().back());
+
+  // Compare the cuts in the rank space.
+  std::vector<std::vector<float>> columns(kCols);
+  for (auto const& page : m->GetBatches<SparsePage>()) {
+    auto h_page = page.GetView();
+    for (std::size_t i = 0; i < h_page.Size(); ++i) {
+      for (auto const& e : h_page[i]) {
+        columns[e.index].push_back(e.fvalue);
+      }
+    }
+  }
+  for (bst_feature_t f = 0; f < kCols; ++f) {
+    auto& column = columns[f];
+    std::sort(column.begin(), column.end());
+    auto ecdf = [&](float v) {
+      auto n = std::upper_bound(column.cbegin(), column.cend(), v) - column.cbegin();
+      return static_cast<double>(n) / column.size();
+    };
+    ASSERT_EQ(cuts.Ptrs()[f + 1], sort_cuts.Ptrs()[f + 1]);
+    for (auto i = cuts.Ptrs()[f]; i < cuts.Ptrs()[f + 1]; ++i) {
+      if (IsCat(ft, f)) {
+        ASSERT_EQ(cuts.Values()[i], sort_cuts.Values()[i]);
+      } else {
+        ASSERT_NEAR(ecdf(cuts.Values()[i]), ecdf(sort_cuts.Values()[i]), 2.0 / kBins);
+      }
+    }
+  }
+
+  // Invalid parameter.
+  config.sketch_method = "foo";
+  ASSERT_THAT([&] { std::ignore = SketchOnDMatrix(&ctx, m.get(), kBins); },
+              GMockThrow("sketch_method"));
+  config.sketch_method = "wq";
+}
+
+TEST(Quantile, SortSketchRankError) {
+  constexpr bst_idx_t kRows = 16384;
+  constexpr bst_feature_t kCols = 4;
+  constexpr bst_bin_t kBins = 32;
+  Context ctx;
+  auto m = RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix();
+  std::vector<bst_idx_t> columns_size(kCols, kRows);
+  SortSketchContainer container{&ctx, kBins, m->Info().feature_types.ConstHostSpan(),
+                                columns_size, false};
+  for (auto const& page : m->GetBatches<SparsePage>()) {
+    container.PushRowPage(page, m->Info());
+  }
+  HistogramCuts cuts;
+  container.MakeCuts(&ctx, m->Info(), &cuts);
+  ASSERT_GT(container.RankError(), 0.0);
+  ASSERT_LE(container.RankError(), 1.0 / kBins);
+}
+
 TEST(Quantile, SameOnAllWorkers) {
   auto constexpr kWorkers = 4;
   collective::TestDistributedGlobal(kWorkers, [] { TestSameOnAllWorkers(); });
@@ -0,0 +1,331 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ */
+#include <gtest/gtest.h>
+#include <xgboost/c_api.h>
+
+#include <cstdint>  // for int32_t, int64_t, uint8_t
+#include <cstring>  // for memcpy
+#include <fstream>  // for ofstream
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "../../../src/data/arrow_ipc.h"
+#include "../filesystem.h"  // for TemporaryDirectory
+
+namespace xgboost::data {
+namespace {
+/**
+ * @brief A forward-only flatbuffers writer. Each field of a table occupies 8 bytes and
+ *        children are always written after their parents.
+ */
+class FbBuilder {
+  std::vector<std::uint8_t> buf_ = std::vector<std::uint8_t>(8, 0);
+
+  void Align(std::size_t n) { buf_.resize((buf_.size() + n - 1) / n * n, 0); }
+  template <typename T>
+  void Put(std::size_t pos, T v) {
+    std::memcpy(buf_.data() + pos, &v, sizeof(T));
+  }
+  template <typename T>
+  void Push(T v) {
+    buf_.resize(buf_.size() + sizeof(T));
+    this->Put(buf_.size() - sizeof(T), v);
+  }
+  std::size_t Slot(std::size_t table, std::int32_t i) {
+    std::int32_t soff;
+    std::memcpy(&soff, buf_.data() + table, sizeof(soff));
+    auto slot = table + 8 + 8 * i;
+    this->Put<std::uint16_t>(table - soff + 4 + 2 * i, slot - table);
+    return slot;
+  }
+
+ public:
+  std::size_t Table(std::int32_t n_fields) {
+    Align(2);
+    auto vtable = buf_.size();
+    this->Push<std::uint16_t>(4 + 2 * n_fields);
+    this->Push<std::uint16_t>(8 + 8 * n_fields);
+    for (std::int32_t i = 0; i < n_fields; ++i) {
+      this->Push<std::uint16_t>(0);
+    }
+    Align(8);
+    auto table = buf_.size();
+    buf_.resize(buf_.size() + 8 + 8 * n_fields, 0);
+    this->Put<std::int32_t>(table, table - vtable);
+    return table;
+  }
+  template <typename T>
+  void Set(std::size_t table, std::int32_t i, T v) {
+    this->Put(this->Slot(table, i), v);
+  }
+  void SetRef(std::size_t table, std::int32_t i, std::size_t target) {
+    auto slot = this->Slot(table, i);
+    this->Put<std::uint32_t>(slot, target - slot);
+  }
+  std::size_t String(std::string const& str) {
+    Align(4);
+    auto pos = buf_.size();
+    this->Push<std::uint32_t>(str.size());
+    buf_.insert(buf_.end(), str.cbegin(), str.cend());
+    buf_.push_back(0);
+    return pos;
+  }
+  template <typename T>
+  std::size_t Structs(std::vector<T> const& values) {
+    Align(8);
+    this->Push<std::uint32_t>(0);
+    auto pos = buf_.size();
+    this->Push<std::uint32_t>(values.size());
+    for (auto const& v : values) {
+      this->Push(v);
+    }
+    return pos;
+  }
+  std::size_t Tables(std::size_t n) {
+    Align(4);
+    auto pos = buf_.size();
+    this->Push<std::uint32_t>(n);
+    buf_.resize(buf_.size() + 4 * n, 0);
+    return pos;
+  }
+  void SetElem(std::size_t vec, std::size_t j, std::size_t target) {
+    auto slot = vec + 4 + 4 * j;
+    this->Put<std::uint32_t>(slot, target - slot);
+  }
+  void Root(std::size_t table) { this->Put<std::uint32_t>(0, table); }
+  auto const& Data() {
+    Align(8);
+    return buf_;
+  }
+};
+
+struct FieldNode {
+  std::int64_t length;
+  std::int64_t null_count;
+};
+
+struct BufferSpec {
+  std::int64_t offset;
+  std::int64_t length;
+};
+
+struct Body {
+  std::vector<FieldNode> nodes;
+  std::vector<BufferSpec> buffers;
+  std::vector<std::uint8_t> data;
+
+  template <typename T>
+  void Add(std::vector<T> const& values) {
+    data.resize((data.size() + 7) / 8 * 8, 0);
+    buffers.push_back({static_cast<std::int64_t>(data.size()),
+                       static_cast<std::int64_t>(values.size() * sizeof(T))});
+    auto beg = reinterpret_cast<std::uint8_t const*>(values.data());
+    data.insert(data.end(), beg, beg + values.size() * sizeof(T));
+  }
+  template <typename T>
+  void Column(std::vector<T> const& values, std::vector<std::uint8_t> const& valid = {}) {
+    std::int64_t n_nulls{0};
+    for (std::size_t i = 0; !valid.empty() && i < values.size(); ++i) {
+      n_nulls += !((valid[i / 8] >> (i % 8)) & 1);
+    }
+    nodes.push_back({static_cast<std::int64_t>(values.size()), n_nulls});
+    this->Add(valid);
+    this->Add(values);
+  }
+};
+
+// Write a record batch or a dictionary batch message, returns the block in the footer.
+ArrowIPCReader::Block WriteMessage(Body body, std::int64_t n_rows, std::int64_t dict_id,
+                                   std::vector<std::uint8_t>* p_file) {
+  FbBuilder fb;
+  auto msg = fb.Table(5);
+  fb.Root(msg);
+  fb.Set<std::int16_t>(msg, 0, 4);
+  fb.Set<std::uint8_t>(msg, 1, dict_id >= 0 ? 2 : 3);
+  body.data.resize((body.data.size() + 7) / 8 * 8, 0);
+  fb.Set<std::int64_t>(msg, 3, body.data.size());
+  auto batch = fb.Table(5);
+  if (dict_id >= 0) {
+    auto dict = batch;
+    fb.SetRef(msg, 2, dict);
+    fb.Set<std::int64_t>(dict, 0, dict_id);
+    batch = fb.Table(5);
+    fb.SetRef(dict, 1, batch);
+  } else {
+    fb.SetRef(msg, 2, batch);
+  }
+  fb.Set<std::int64_t>(batch, 0, n_rows);
+  fb.SetRef(batch, 1, fb.Structs(body.nodes));
+  fb.SetRef(batch, 2, fb.Structs(body.buffers));
+
+  auto& file = *p_file;
+  auto const& meta = fb.Data();
+  ArrowIPCReader::Block block{static_cast<std::int64_t>(file.size()),
+                              static_cast<std::int32_t>(meta.size() + 8), 0,
+                              static_cast<std::int64_t>(body.data.size())};
+  std::int32_t prefix[2] = {-1, static_cast<std::int32_t>(meta.size())};
+  auto p_prefix = reinterpret_cast<std::uint8_t const*>(prefix);
+  file.insert(file.end(), p_prefix, p_prefix + sizeof(prefix));
+  file.insert(file.end(), meta.cbegin(), meta.cend());
+  file.insert(file.end(), body.data.cbegin(), body.data.cend());
+  return block;
+}
+
+// Write the schema: f0: float32, f1: int64, cat: dictionary<int32, utf8>, y: float64.
+std::size_t WriteSchema(FbBuilder* p_fb) {
+  auto& fb = *p_fb;
+  auto schema = fb.Table(4);
+  auto fields = fb.Tables(4);
+  fb.SetRef(schema, 1, fields);
+  auto field = [&](std::size_t j, std::string const& name, std::uint8_t type_id) {
+    auto f = fb.Table(7);
+    fb.SetElem(fields, j, f);
+    fb.SetRef(f, 0, fb.String(name));
+    fb.Set<std::uint8_t>(f, 1, 1);
+    fb.Set<std::uint8_t>(f, 2, type_id);
+    return f;
+  };
+  auto floating = [&](std::size_t f, std::int16_t precision) {
+    auto type = fb.Table(1);
+    fb.SetRef(f, 3, type);
+    fb.Set<std::int16_t>(type, 0, precision);
+  };
+  auto integer = [&](std::size_t parent, std::int32_t i, std::int32_t bits) {
+    auto type = fb.Table(2);
+    fb.SetRef(parent, i, type);
+    fb.Set<std::int32_t>(type, 0, bits);
+    fb.Set<std::uint8_t>(type, 1, 1);
+  };
+  floating(field(0, "f0", 3), 1);
+  integer(field(1, "f1", 2), 3, 64);
+  auto cat = field(2, "cat", 5);
+  fb.SetRef(cat, 3, fb.Table(0));
+  auto dict = fb.Table(4);
+  fb.SetRef(cat, 4, dict);
+  fb.Set<std::int64_t>(dict, 0, 0);
+  integer(dict, 1, 32);
+  floating(field(3, "y", 3), 2);
+  return schema;
+}
+
+void WriteTestFile(std::string const& path) {
+  std::vector<std::uint8_t> file{'A', 'R', 'R', 'O', 'W', '1', 0, 0};
+  Body dict;
+  dict.nodes.push_back({2, 0});
+  dict.Add(std::vector<std::uint8_t>{});
+  dict.Add(std::vector<std::int32_t>{0, 1, 2});
+  dict.Add(std::vector<char>{'a', 'b'});
+  std::vector<ArrowIPCReader::Block> dicts{WriteMessage(dict, 2, 0, &file)};
+
+  std::vector<ArrowIPCReader::Block> batches;
+  {
+    Body body;
+    body.Column(std::vector<float>{1.0f, 2.0f, 3.0f}, {0b101});
+    body.Column(std::vector<std::int64_t>{10, 20, 30});
+    body.Column(std::vector<std::int32_t>{0, 1, 0});
+    body.Column(std::vector<double>{0.0, 1.0, 0.0});
+    batches.push_back(WriteMessage(body, 3, -1, &file));
+  }
+  {
+    Body body;
+    body.Column(std::vector<float>{4.0f, 5.0f, 6.0f});
+    body.Column(std::vector<std::int64_t>{40, 50, 60});
+    body.Column(std::vector<std::int32_t>{1, 1, 0});
+    body.Column(std::vector<double>{1.0, 0.0, 1.0});
+    batches.push_back(WriteMessage(body, 3, -1, &file));
+  }
+
+  FbBuilder fb;
+  auto footer = fb.Table(5);
+  fb.Root(footer);
+  fb.Set<std::int16_t>(footer, 0, 4);
+  fb.SetRef(footer, 1, WriteSchema(&fb));
+  fb.SetRef(footer, 2, fb.Structs(dicts));
+  fb.SetRef(footer, 3, fb.Structs(batches));
+  auto const& meta = fb.Data();
+  file.insert(file.end(), meta.cbegin(), meta.cend());
+  std::int32_t footer_len = meta.size();
+  auto p_len = reinterpret_cast<std::uint8_t const*>(&footer_len);
+  file.insert(file.end(), p_len, p_len + sizeof(footer_len));
+  file.insert(file.end(), {'A', 'R', 'R', 'O', 'W', '1'});
+
+  std::ofstream fout{path, std::ios::binary};
+  fout.write(reinterpret_cast<char const*>(file.data()), file.size());
+}
+}  // anonymous namespace
+
+TEST(ArrowIPC, Reader) {
+  common::TemporaryDirectory tmpdir;
+  auto path = tmpdir.Str() + "/data.arrow";
+  WriteTestFile(path);
+
+  ArrowIPCReader reader{path};
+  auto const& fields = reader.Fields();
+  ASSERT_EQ(fields.size(), 4);
+  ASSERT_EQ(fields[0].typestr, "<f4");
+  ASSERT_EQ(fields[1].typestr, "<i8");
+  ASSERT_TRUE(fields[2].IsCategorical());
+  ASSERT_EQ(fields[2].typestr, "<i4");
+  ASSERT_EQ(fields[2].dict_typestr, "utf8");
+  ASSERT_EQ(fields[3].name, "y");
+  ASSERT_EQ(reader.NumBatches(), 2);
+
+  std::vector<Json> columns;
+  ASSERT_EQ(reader.ReadBatch(0, &columns), 3);
+  ASSERT_EQ(columns.size(), 4);
+  ASSERT_EQ(get<Object const>(columns[0]).count("mask"), 1);
+  ASSERT_EQ(get<Object const>(columns[1]).count("mask"), 0);
+  ASSERT_TRUE(IsA<Array>(columns[2]));
+  // Zero-copy, the buffer points into the mapped file.
+  auto p_f1 = reinterpret_cast<std::int64_t const*>(get<Integer const>(columns[1]["data"][0]));
+  ASSERT_EQ(p_f1[2], 30);
+
+  ASSERT_EQ(reader.ReadBatch(1, &columns), 3);
+  ASSERT_EQ(get<Object const>(columns[0]).count("mask"), 0);
+}
+
+TEST(ArrowIPC, QuantileDMatrix) {
+  common::TemporaryDirectory tmpdir;
+  auto path = tmpdir.Str() + "/data.arrow";
+  WriteTestFile(path);
+
+  auto check = [](DMatrixHandle handle) {
+    bst_ulong n{0};
+    ASSERT_EQ(XGDMatrixNumRow(handle, &n), 0);
+    ASSERT_EQ(n, 6);
+    ASSERT_EQ(XGDMatrixNumCol(handle, &n), 0);
+    ASSERT_EQ(n, 3);
+
+    float const* labels{nullptr};
+    ASSERT_EQ(XGDMatrixGetFloatInfo(handle, "label", &n, &labels), 0);
+    ASSERT_EQ(n, 6);
+    ASSERT_EQ(labels[1], 1.0f);
+    ASSERT_EQ(labels[5], 1.0f);
+
+    char const** types{nullptr};
+    ASSERT_EQ(XGDMatrixGetStrFeatureInfo(handle, "feature_type", &n, &types), 0);
+    ASSERT_EQ(n, 3);
+    ASSERT_EQ(std::string{types[2]}, "c");
+  };
+
+  DMatrixHandle handle;
+  ASSERT_EQ(XGQuantileDMatrixCreateFromArrowIPC(
+                path.c_str(), R"({"label": "y", "missing": NaN, "max_bin": 16})", &handle),
+            0)
+      << XGBGetLastError();
+  check(handle);
+  ASSERT_EQ(XGDMatrixFree(handle), 0);
+
+  auto config = R"({"label": "y", "missing": NaN, "cache_prefix": ")" + tmpdir.Str() +
+                R"(/cache"})";
+  ASSERT_EQ(XGQuantileDMatrixCreateFromArrowIPC(path.c_str(), config.c_str(), &handle), 0)
+      << XGBGetLastError();
+  check(handle);
+  ASSERT_EQ(XGDMatrixFree(handle), 0);
+
+  ASSERT_NE(XGQuantileDMatrixCreateFromArrowIPC(path.c_str(), R"({"label": "z", "missing": 0})",
+                                                &handle),
+            0);
+}
+}  // namespace xgboost::data
@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>  // for int32_t
+#include <vector>   // for vector
+
 #include "../encoder/df_mock.h"
 
 namespace xgboost {
@@ -24,4 +27,91 @@ TEST(CatContainer, Mixed) {
   Context ctx;
   TestCatContainerMixed<DfTest>(&ctx, eq_check);
 }
+
+TEST(CatContainer, RecodeCache) {
+  Context ctx;
+  auto orig = DfTest::Make(DfTest::MakeStrs("abc", "bcd", "cde", "ab"));
+  auto cats = CatContainer{orig.View(), false};
+  cats.Sort(&ctx);
+  ASSERT_EQ(cats.NumCachedMappings(), 0ul);
+
+  auto df = DfTest::Make(DfTest::MakeStrs("cde", "ab", "abc", "bcd"));
+  auto mapping = cats.HostMapping(&ctx, df.View());
+  ASSERT_EQ(*mapping, (std::vector<std::int32_t>{2, 3, 0, 1}));
+  ASSERT_EQ(cats.NumCachedMappings(), 1ul);
+
+  // Same categories in a different buffer.
+  auto same = DfTest::Make(DfTest::MakeStrs("cde", "ab", "abc", "bcd"));
+  auto cached = cats.HostMapping(&ctx, same.View());
+  ASSERT_EQ(cached.get(), mapping.get());
+  ASSERT_EQ(cats.NumCachedMappings(), 1ul);
+
+  // Different ordering.
+  auto other = DfTest::Make(DfTest::MakeStrs("ab", "abc", "bcd", "cde"));
+  auto other_mapping = cats.HostMapping(&ctx, other.View());
+  ASSERT_EQ(*other_mapping, (std::vector<std::int32_t>{3, 0, 1, 2}));
+  ASSERT_EQ(cats.NumCachedMappings(), 2ul);
+  ASSERT_NE(cpu_impl::Fingerprint(df.View()), cpu_impl::Fingerprint(other.View()));
+
+  // Invalidated by changes to the categories.
+  cats.Sort(&ctx);
+  ASSERT_EQ(cats.NumCachedMappings(), 0ul);
+}
+
+TEST(CatContainer, RecodeCacheSource) {
+  Context ctx;
+  auto orig = DfTest::Make(DfTest::MakeStrs("abc", "bcd", "cde", "ab"));
+  auto cats = CatContainer{orig.View(), false};
+  cats.Sort(&ctx);
+
+  // Container inputs are keyed by their identity.
+  auto df = DfTest::Make(DfTest::MakeStrs("cde", "ab", "abc", "bcd"));
+  auto input = CatContainer{df.View(), false};
+  auto mapping = cats.HostMapping(&ctx, input);
+  ASSERT_EQ(*mapping, (std::vector<std::int32_t>{2, 3, 0, 1}));
+  ASSERT_EQ(cats.HostMapping(&ctx, input).get(), mapping.get());
+  // A different container with the same categories hits the fingerprint.
+  auto copy = CatContainer{df.View(), false};
+  ASSERT_NE(copy.Source(), input.Source());
+  ASSERT_EQ(cats.HostMapping(&ctx, copy).get(), mapping.get());
+  // Modifying the input changes its identity.
+  auto source = input.Source();
+  input.Sort(&ctx);
+  ASSERT_NE(input.Source(), source);
+
+  // Registered views are keyed by the buffers.
+  auto other = DfTest::Make(DfTest::MakeStrs("ab", "abc", "bcd", "cde"));
+  auto view = other.View();
+  auto registered = cats.RegisterHostMapping(&ctx, view);
+  ASSERT_EQ(*registered, (std::vector<std::int32_t>{3, 0, 1, 2}));
+  ASSERT_EQ(cpu_impl::ViewSource(view), cpu_impl::ViewSource(other.View()));
+  ASSERT_EQ(cats.HostMapping(&ctx, view).get(), registered.get());
+
+  // Invalidated by changes to the categories.
+  cats.Sort(&ctx);
+  ASSERT_EQ(cats.NumCachedMappings(), 0ul);
+  ASSERT_NE(cats.HostMapping(&ctx, input).get(), mapping.get());
+}
+
+TEST(CatContainer, RecodeCacheRefill) {
+  Context ctx;
+  auto orig = DfTest::Make(DfTest::MakeInts(1, 2, 3, 4));
+  auto cats = CatContainer{orig.View(), false};
+  cats.Sort(&ctx);
+
+  std::vector<std::int32_t> buf{4, 1, 2, 3};
+  std::vector<enc::HostCatIndexView> columns{
+      enc::HostCatIndexView{common::Span<std::int32_t const>{buf.data(), buf.size()}}};
+  std::vector<std::int32_t> segments{0, static_cast<std::int32_t>(buf.size())};
+  auto view = enc::HostColumnsView{common::Span{columns}, common::Span{segments}, segments.back()};
+  auto registered = cats.RegisterHostMapping(&ctx, view);
+  ASSERT_EQ(*registered, (std::vector<std::int32_t>{3, 0, 1, 2}));
+  ASSERT_EQ(cats.HostMapping(&ctx, view).get(), registered.get());
+
+  // Same buffers, different categories.
+  buf = {2, 3, 4, 1};
+  auto mapping = cats.HostMapping(&ctx, view);
+  ASSERT_NE(mapping.get(), registered.get());
+  ASSERT_EQ(*mapping, (std::vector<std::int32_t>{1, 2, 3, 0}));
+}
 }  // namespace xgboost
@@ -6,6 +6,7 @@
 
 #include <cstddef>  // for size_t
 #include <memory>   // for unique_ptr
+#include <string>   // for string, to_string
 
 #include "../../../src/common/column_matrix.h"  // for common::ColumnMatrix
 #include "../../../src/common/io.h"             // for MmapResource, AlignedResourceReadStream...
@@ -61,6 +62,45 @@ TEST(GHistIndexPageRawFormat, IO) {
   }
 }
 
+TEST(GHistIndexPageRawFormat, Compressed) {
+  Context ctx;
+  common::TemporaryDirectory tmpdir;
+  // Small number of bins such that the index can be packed into less than a byte.
+  auto batch = BatchParam{16, 0.5};
+
+  for (float sparsity : {0.0f, 0.5f}) {
+    auto m = RandomDataGenerator{256, 14, sparsity}.GenerateDMatrix();
+    auto const &gidx = *m->GetBatches<GHistIndexMatrix>(&ctx, batch).begin();
+
+    auto write_read = [&](bool compress, GHistIndexMatrix *page) {
+      std::string path = tmpdir.Str() + "/ghistindex-" + std::to_string(compress) + ".page";
+      auto format = std::make_unique<GHistIndexRawFormat>(gidx.Cuts(), compress, 2);
+      std::size_t bytes{0};
+      {
+        auto fo = std::make_unique<common::AlignedFileWriteStream>(StringView{path}, "wb");
+        bytes = format->Write(gidx, fo.get());
+      }
+      std::unique_ptr<common::AlignedResourceReadStream> fi{
+          std::make_unique<common::PrivateMmapConstStream>(path, 0, bytes)};
+      EXPECT_TRUE(format->Read(page, fi.get()));
+      return bytes;
+    };
+
+    GHistIndexMatrix raw, packed;
+    auto n_raw_bytes = write_read(false, &raw);
+    auto n_packed_bytes = write_read(true, &packed);
+    ASSERT_LT(n_packed_bytes, n_raw_bytes);
+
+    ASSERT_EQ(raw.IsDense(), packed.IsDense());
+    ASSERT_EQ(raw.index.GetBinTypeSize(), packed.index.GetBinTypeSize());
+    ASSERT_EQ(raw.index.Size(), packed.index.Size());
+    ASSERT_TRUE(std::equal(gidx.index.begin(), gidx.index.end(), packed.index.begin()));
+    for (std::size_t i = 0; i < gidx.index.Size(); ++i) {
+      ASSERT_EQ(gidx.index[i], packed.index[i]);
+    }
+  }
+}
+
 TEST(GHistIndexPageRawFormat, File) {
   auto policy = MemBufFileReadFormatStreamPolicy<GHistIndexMatrix, GHistIndexFormatPolicy>{};
 
@@ -5,11 +5,17 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>   // for isnan
+#include <cstdint>  // for uint8_t
 #include <limits>  // for numeric_limits
 #include <memory>
+#include <vector>  // for vector
 
+#include "../../../src/common/io.h"  // for AlignedFileWriteStream
+#include "../../../src/data/buffered_iter.h"  // for BufferedDataIter
 #include "../../../src/data/gradient_index.h"
 #include "../../../src/data/iterative_dmatrix.h"
+#include "../filesystem.h"  // for TemporaryDirectory
 #include "../helpers.h"
 #include "xgboost/data.h"  // DMatrix
 
@@ -39,4 +45,207 @@ TEST(IterativeDMatrix, IsDense) {
   test(0.1);
   test(1.0);
 }
+
+TEST(IterativeDMatrix, IO) {
+  Context ctx;
+  bst_idx_t n_samples = 1024;
+  bst_feature_t n_features = 16;
+  for (auto sparsity : {0.0f, 0.4f}) {
+    auto p_fmat = RandomDataGenerator{n_samples, n_features, sparsity}
+                      .Bins(32)
+                      .GenerateQuantileDMatrix(true);
+    auto qdm = std::dynamic_pointer_cast<IterativeDMatrix>(p_fmat);
+    ASSERT_TRUE(qdm);
+
+    common::TemporaryDirectory tmpdir;
+    auto path = (tmpdir.Path() / "data.qdm").string();
+    {
+      auto fo = std::make_unique<common::AlignedFileWriteStream>(StringView{path}, "wb");
+      qdm->Save(fo.get());
+    }
+    // Loaded with mmap through the generic loader.
+    std::shared_ptr<DMatrix> loaded{DMatrix::Load(path)};
+    ASSERT_TRUE(std::dynamic_pointer_cast<IterativeDMatrix>(loaded));
+    ASSERT_EQ(loaded->Info().num_row_, n_samples);
+    ASSERT_EQ(loaded->Info().num_col_, n_features);
+    ASSERT_EQ(loaded->Info().num_nonzero_, p_fmat->Info().num_nonzero_);
+    ASSERT_EQ(loaded->Info().labels.Data()->ConstHostVector(),
+              p_fmat->Info().labels.Data()->ConstHostVector());
+    ASSERT_EQ(loaded->IsDense(), p_fmat->IsDense());
+
+    for (auto const& orig : p_fmat->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+      for (auto const& page : loaded->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+        ASSERT_EQ(orig.cut.Ptrs(), page.cut.Ptrs());
+        ASSERT_EQ(orig.cut.Values(), page.cut.Values());
+        ASSERT_EQ(orig.cut.MinValues(), page.cut.MinValues());
+        ASSERT_EQ(orig.Size(), page.Size());
+        ASSERT_EQ(page.row_ptr.Resource()->Type(), common::ResourceHandler::kMmap);
+        for (bst_idx_t ridx = 0; ridx < n_samples; ++ridx) {
+          for (bst_feature_t fidx = 0; fidx < n_features; ++fidx) {
+            ASSERT_EQ(orig.GetGindex(ridx, fidx), page.GetGindex(ridx, fidx));
+          }
+        }
+      }
+    }
+  }
+}
+
+namespace {
+class CountingIter : public NumpyArrayIterForTest {
+ public:
+  std::size_t n_calls{0};
+  using NumpyArrayIterForTest::NumpyArrayIterForTest;
+  int Next() override {
+    ++n_calls;
+    return NumpyArrayIterForTest::Next();
+  }
+};
+
+void CheckSinglePassEqual(IterativeDMatrix* expected, IterativeDMatrix* m) {
+  Context ctx;
+  ASSERT_EQ(m->Info().num_row_, expected->Info().num_row_);
+  ASSERT_EQ(m->Info().num_nonzero_, expected->Info().num_nonzero_);
+  for (auto const& lhs : expected->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+    for (auto const& rhs : m->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+      ASSERT_EQ(lhs.cut.Values(), rhs.cut.Values());
+      ASSERT_EQ(lhs.cut.Ptrs(), rhs.cut.Ptrs());
+      ASSERT_EQ(lhs.row_ptr.size(), rhs.row_ptr.size());
+      for (std::size_t i = 0; i < lhs.row_ptr.size(); ++i) {
+        ASSERT_EQ(lhs.row_ptr[i], rhs.row_ptr[i]);
+      }
+      for (std::size_t i = 0; i < lhs.index.Size(); ++i) {
+        ASSERT_EQ(lhs.index[i], rhs.index[i]);
+      }
+    }
+  }
+}
+}  // namespace
+
+TEST(IterativeDMatrix, SinglePass) {
+  bst_bin_t n_bins = 16;
+  std::size_t n_batches = 4;
+  auto missing = std::numeric_limits<float>::quiet_NaN();
+  auto max_blocks = std::numeric_limits<std::int64_t>::max();
+
+  // Sparse and dense batches.
+  for (auto sparsity : {0.4f, 0.0f}) {
+    CountingIter iter{sparsity, 256, 8, n_batches};
+    IterativeDMatrix expected{&iter, iter.Proxy(), nullptr, Reset, Next, missing, 0, n_bins,
+                              max_blocks};
+    ASSERT_GT(iter.n_calls, n_batches + 1);
+
+    iter.n_calls = 0;
+    BufferedDataIter buffered{&iter, iter.Proxy(), Reset, Next, missing, 0};
+    IterativeDMatrix m{&buffered, iter.Proxy(), nullptr, bufiter::Reset, bufiter::Next,
+                       missing, 0, n_bins, max_blocks};
+    // Each batch is fetched once, plus the call that ends the iteration.
+    ASSERT_EQ(iter.n_calls, n_batches + 1);
+    ASSERT_EQ(buffered.NumBatches(), n_batches);
+    ASSERT_FALSE(buffered.Passthrough());
+    CheckSinglePassEqual(&expected, &m);
+  }
+}
+
+TEST(IterativeDMatrix, SinglePassBudget) {
+  bst_bin_t n_bins = 16;
+  std::size_t n_batches = 4;
+  auto missing = std::numeric_limits<float>::quiet_NaN();
+  auto max_blocks = std::numeric_limits<std::int64_t>::max();
+
+  CountingIter iter{0.4f, 256, 8, n_batches};
+  IterativeDMatrix expected{&iter, iter.Proxy(), nullptr, Reset, Next, missing, 0, n_bins,
+                            max_blocks};
+  auto n_expected_calls = iter.n_calls;
+
+  iter.n_calls = 0;
+  // Each batch takes about 8KiB, the buffer is dropped at the second one.
+  BufferedDataIter buffered{&iter, iter.Proxy(), Reset, Next, missing, 0, 12 * 1024};
+  IterativeDMatrix m{&buffered, iter.Proxy(), nullptr, bufiter::Reset, bufiter::Next, missing, 0,
+                     n_bins, max_blocks};
+  ASSERT_TRUE(buffered.Passthrough());
+  ASSERT_EQ(buffered.NumBatches(), 0);
+  ASSERT_EQ(buffered.MemCostBytes(), 0);
+  // Falls back to the multi-pass construction.
+  ASSERT_EQ(iter.n_calls, n_expected_calls);
+  CheckSinglePassEqual(&expected, &m);
+}
+
+TEST(IterativeDMatrix, Slice) {
+  Context ctx;
+  bst_idx_t n_samples = 512;
+  bst_feature_t n_features = 8;
+  for (auto sparsity : {0.0f, 0.4f}) {
+    auto p_fmat = RandomDataGenerator{n_samples, n_features, sparsity}
+                      .Bins(16)
+                      .GenerateQuantileDMatrix(true);
+    std::vector<std::int32_t> ridxs;
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(n_samples); i += 3) {
+      ridxs.push_back(i);
+    }
+    std::shared_ptr<DMatrix> sliced{p_fmat->Slice(ridxs)};
+    ASSERT_TRUE(std::dynamic_pointer_cast<IterativeDMatrix>(sliced));
+    ASSERT_EQ(sliced->Info().num_row_, ridxs.size());
+    ASSERT_EQ(sliced->Info().num_col_, n_features);
+    ASSERT_EQ(sliced->IsDense(), p_fmat->IsDense());
+
+    auto const& h_labels = p_fmat->Info().labels.Data()->ConstHostVector();
+    auto const& h_sliced_labels = sliced->Info().labels.Data()->ConstHostVector();
+    for (std::size_t i = 0; i < ridxs.size(); ++i) {
+      ASSERT_EQ(h_sliced_labels[i], h_labels[ridxs[i]]);
+    }
+
+    for (auto const& orig : p_fmat->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+      for (auto const& page : sliced->GetBatches<GHistIndexMatrix>(&ctx, {})) {
+        ASSERT_EQ(orig.cut.Values(), page.cut.Values());
+        ASSERT_EQ(orig.index.GetBinTypeSize(), page.index.GetBinTypeSize());
+        ASSERT_EQ(page.row_ptr.back(), sliced->Info().num_nonzero_);
+        std::size_t n_hits = 0;
+        for (auto v : page.hit_count) {
+          n_hits += v;
+        }
+        ASSERT_EQ(n_hits, sliced->Info().num_nonzero_);
+        for (std::size_t i = 0; i < ridxs.size(); ++i) {
+          for (bst_feature_t fidx = 0; fidx < n_features; ++fidx) {
+            ASSERT_EQ(orig.GetGindex(ridxs[i], fidx), page.GetGindex(i, fidx));
+            auto v = page.GetFvalue(i, fidx, false);
+            auto expected = orig.GetFvalue(ridxs[i], fidx, false);
+            if (std::isnan(expected)) {
+              ASSERT_TRUE(std::isnan(v));
+            } else {
+              ASSERT_EQ(v, expected);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(IterativeDMatrix, SinglePassMemory) {
+  bst_feature_t n_features = 16;
+  std::size_t n_batches = 4;
+  auto missing = std::numeric_limits<float>::quiet_NaN();
+
+  NumpyArrayIterForTest iter{0.8f, 256, n_features, n_batches};
+  BufferedDataIter buffered{&iter, iter.Proxy(), Reset, Next, missing, 0};
+  IterativeDMatrix m{&buffered, iter.Proxy(), nullptr, bufiter::Reset, bufiter::Next, missing, 0,
+                     16, std::numeric_limits<std::int64_t>::max()};
+  // Only the valid elements are buffered, with one row pointer per row and batch. The column
+  // indices fit in a single byte.
+  auto n_samples = m.Info().num_row_;
+  auto nnz = m.Info().num_nonzero_;
+  ASSERT_LT(nnz, n_samples * n_features);
+  auto expected = nnz * (sizeof(float) + sizeof(std::uint8_t)) +
+                  (n_samples + n_batches) * sizeof(bst_idx_t);
+  ASSERT_EQ(buffered.MemCostBytes(), expected);
+  // Smaller than the dense input.
+  ASSERT_LT(buffered.MemCostBytes(), n_samples * n_features * sizeof(float));
+
+  // Dense input is stored without indices.
+  NumpyArrayIterForTest dense_iter{0.0f, 256, n_features, n_batches};
+  BufferedDataIter dense_buffered{&dense_iter, dense_iter.Proxy(), Reset, Next, missing, 0};
+  IterativeDMatrix dense{&dense_buffered, dense_iter.Proxy(), nullptr, bufiter::Reset,
+                         bufiter::Next, missing, 0, 16, std::numeric_limits<std::int64_t>::max()};
+  ASSERT_EQ(dense_buffered.MemCostBytes(), dense.Info().num_row_ * n_features * sizeof(float));
+}
 }  // namespace xgboost::data
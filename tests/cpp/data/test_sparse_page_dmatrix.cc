@@ -343,6 +343,137 @@ TEST(SparsePageDMatrix, ColAccessBatches) {
   }
 }
 
+TEST(SparsePageDMatrix, PreadBackend) {
+  common::TemporaryDirectory tmpdir;
+  auto prefix = (tmpdir.Path() / "temp").string();
+  bst_idx_t n_samples = 1024;
+  bst_feature_t n_features = 16;
+  NumpyArrayIterForTest iter{0.4f, n_samples, n_features, 8};
+  auto config = ExtMemConfig{prefix,
+                             false,
+                             ::xgboost::cuda_impl::AutoHostRatio(),
+                             cuda_impl::MatchingPageBytes(),
+                             std::numeric_limits<float>::quiet_NaN(),
+                             2}
+                    .SetIOBackend("pread");
+  std::shared_ptr<DMatrix> p_fmat{
+      DMatrix::Create(static_cast<DataIterHandle>(&iter), iter.Proxy(), Reset, Next, config)};
+
+  NumpyArrayIterForTest ref_iter{0.4f, n_samples, n_features, 8};
+  std::shared_ptr<DMatrix> p_ref{DMatrix::Create(static_cast<DataIterHandle>(&ref_iter),
+                                                 ref_iter.Proxy(), Reset, Next,
+                                                 config.SetIOBackend("mmap"))};
+
+  Context ctx;
+  // Run multiple iterations to read from the cache.
+  for (std::int32_t k = 0; k < 3; ++k) {
+    std::vector<Entry> data, ref_data;
+    for (auto const &page : p_fmat->GetBatches<SparsePage>(&ctx)) {
+      auto const &h_data = page.data.ConstHostVector();
+      data.insert(data.end(), h_data.cbegin(), h_data.cend());
+    }
+    for (auto const &page : p_ref->GetBatches<SparsePage>(&ctx)) {
+      auto const &h_data = page.data.ConstHostVector();
+      ref_data.insert(ref_data.end(), h_data.cbegin(), h_data.cend());
+    }
+    ASSERT_EQ(data, ref_data);
+  }
+  auto stats = dynamic_cast<data::SparsePageDMatrix *>(p_fmat.get())->SparsePageIOStats();
+  ASSERT_GT(stats.n_read_bytes, 0);
+  ASSERT_GE(stats.n_prefetches, 1);
+
+  ASSERT_THAT([&] { config.SetIOBackend("io"); }, GMockThrow("Invalid I/O backend"));
+}
+
+TEST(SparsePageDMatrix, ResidentCache) {
+  common::TemporaryDirectory tmpdir;
+  auto prefix = (tmpdir.Path() / "temp").string();
+  std::size_t n_batches = 8;
+  auto make = [&](std::int64_t budget, std::unique_ptr<NumpyArrayIterForTest> *p_iter) {
+    *p_iter = std::make_unique<NumpyArrayIterForTest>(0.4f, 1024, 16, n_batches);
+    auto config = ExtMemConfig{prefix,
+                               false,
+                               ::xgboost::cuda_impl::AutoHostRatio(),
+                               cuda_impl::MatchingPageBytes(),
+                               std::numeric_limits<float>::quiet_NaN(),
+                               2}
+                      .SetResidentCacheBytes(budget);
+    return std::shared_ptr<DMatrix>{DMatrix::Create(static_cast<DataIterHandle>(p_iter->get()),
+                                                    (*p_iter)->Proxy(), Reset, Next, config)};
+  };
+  std::unique_ptr<NumpyArrayIterForTest> ref_iter, iter;
+  auto p_ref = make(0, &ref_iter);
+  auto cache_name =
+      data::MakeId(prefix, dynamic_cast<data::SparsePageDMatrix *>(p_ref.get())) + ".row.page";
+  // Keep about half of the pages in memory.
+  auto budget = static_cast<std::int64_t>(std::filesystem::file_size(cache_name) / 2);
+  auto p_fmat = make(budget, &iter);
+
+  Context ctx;
+  std::int32_t n_iters = 3;
+  for (std::int32_t k = 0; k < n_iters; ++k) {
+    std::vector<Entry> data, ref_data;
+    for (auto const &page : p_fmat->GetBatches<SparsePage>(&ctx)) {
+      auto const &h_data = page.data.ConstHostVector();
+      data.insert(data.end(), h_data.cbegin(), h_data.cend());
+    }
+    for (auto const &page : p_ref->GetBatches<SparsePage>(&ctx)) {
+      auto const &h_data = page.data.ConstHostVector();
+      ref_data.insert(ref_data.end(), h_data.cbegin(), h_data.cend());
+    }
+    ASSERT_EQ(data, ref_data);
+  }
+
+  auto stats = dynamic_cast<data::SparsePageDMatrix *>(p_fmat.get())->SparsePageIOStats();
+  ASSERT_GT(stats.n_hits, 0);
+  ASSERT_GT(stats.n_misses, 0);
+  ASSERT_GT(stats.resident_bytes, 0);
+  ASSERT_LE(stats.resident_bytes, budget);
+
+  auto ref_stats = dynamic_cast<data::SparsePageDMatrix *>(p_ref.get())->SparsePageIOStats();
+  ASSERT_EQ(ref_stats.n_hits, 0);
+  ASSERT_EQ(ref_stats.resident_bytes, 0);
+}
+
+TEST(SparsePageDMatrix, ResidentCacheShared) {
+  common::TemporaryDirectory tmpdir;
+  auto prefix = (tmpdir.Path() / "temp").string();
+  std::size_t n_batches = 4;
+  auto iter = std::make_unique<NumpyArrayIterForTest>(0.4f, 1024, 16, n_batches);
+  // Room for less than the row pages and the column pages together.
+  std::int64_t budget = 64 * 1024;
+  auto config = ExtMemConfig{prefix,
+                             false,
+                             ::xgboost::cuda_impl::AutoHostRatio(),
+                             cuda_impl::MatchingPageBytes(),
+                             std::numeric_limits<float>::quiet_NaN(),
+                             2}
+                    .SetResidentCacheBytes(budget);
+  std::shared_ptr<DMatrix> p_fmat{DMatrix::Create(static_cast<DataIterHandle>(iter.get()),
+                                                  iter->Proxy(), Reset, Next, config)};
+  auto cache_name =
+      data::MakeId(prefix, dynamic_cast<data::SparsePageDMatrix *>(p_fmat.get())) + ".row.page";
+  ASSERT_GT(static_cast<std::int64_t>(std::filesystem::file_size(cache_name)), budget / 2);
+
+  Context ctx;
+  for (std::int32_t k = 0; k < 3; ++k) {
+    for (auto const &page : p_fmat->GetBatches<SparsePage>(&ctx)) {
+      ASSERT_GT(page.Size(), 0);
+    }
+    for (auto const &page : p_fmat->GetBatches<CSCPage>(&ctx)) {
+      ASSERT_GT(page.Size(), 0);
+    }
+    for (auto const &page : p_fmat->GetBatches<SortedCSCPage>(&ctx)) {
+      ASSERT_GT(page.Size(), 0);
+    }
+  }
+  auto p_sparse = dynamic_cast<data::SparsePageDMatrix *>(p_fmat.get());
+  // All sources draw from the same budget.
+  ASSERT_GT(p_sparse->ResidentBytes(), 0);
+  ASSERT_LE(p_sparse->ResidentBytes(), budget);
+  ASSERT_LE(p_sparse->SparsePageIOStats().resident_bytes, p_sparse->ResidentBytes());
+}
+
 auto TestSparsePageDMatrixDeterminism(std::int32_t n_threads) {
   std::vector<float> sparse_data;
   std::vector<size_t> sparse_rptr;
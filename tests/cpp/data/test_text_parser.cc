@@ -0,0 +1,139 @@
+/**
+ * Copyright 2025, XGBoost contributors
+ */
+#include <gtest/gtest.h>
+
+#include <cstddef>  // for size_t
+#include <fstream>  // for ofstream
+#include <string>   // for string
+
+#include "../../../src/data/text_parser.h"
+#include "../filesystem.h"  // for TemporaryDirectory
+#include "../helpers.h"
+
+namespace xgboost::data {
+namespace {
+// Parse the file and concatenate all blocks.
+TextBlock ParseAll(std::string const& path, Args const& args, std::uint32_t part_idx,
+                   std::uint32_t n_parts, std::int32_t n_threads, std::size_t chunk_bytes) {
+  TextParserParam param;
+  param.UpdateAllowUnknown(args);
+  TextParser parser{path, param, part_idx, n_parts, n_threads, chunk_bytes};
+  TextBlock out;
+  parser.BeforeFirst();
+  while (parser.Next()) {
+    auto const& batch = parser.Value();
+    for (std::size_t i = 0; i < batch.size; ++i) {
+      out.label.push_back(batch.label[i]);
+      if (batch.weight) {
+        out.weight.push_back(batch.weight[i]);
+      }
+      if (batch.qid) {
+        out.qid.push_back(batch.qid[i]);
+      }
+      for (auto j = batch.offset[i]; j < batch.offset[i + 1]; ++j) {
+        out.index.push_back(batch.index[j]);
+        out.value.push_back(batch.value[j]);
+      }
+      out.offset.push_back(out.index.size());
+    }
+  }
+  return out;
+}
+}  // anonymous namespace
+
+TEST(TextParser, LibSVM) {
+  common::TemporaryDirectory tmpdir;
+  std::size_t n_entries = 3 * 64;
+  for (bool zero_based : {true, false}) {
+    auto path = tmpdir.Str() + "/data.svm";
+    CreateBigTestData(path, n_entries, zero_based);
+    Args args{{"format", "libsvm"}, {"indexing_mode", zero_based ? "0" : "1"}};
+    std::size_t chunks[] = {7, 64, TextParser::DftThreadChunkBytes()};
+    for (std::int32_t n_threads : {1, 3}) {
+      for (auto chunk_bytes : chunks) {
+        auto block = ParseAll(path, args, 0, 1, n_threads, chunk_bytes);
+        ASSERT_EQ(block.Size(), 64);
+        ASSERT_TRUE(block.weight.empty());
+        ASSERT_TRUE(block.qid.empty());
+        for (std::size_t i = 0; i < block.Size(); ++i) {
+          ASSERT_EQ(block.label[i], static_cast<float>(i));
+          ASSERT_EQ(block.offset[i + 1] - block.offset[i], 3);
+          auto beg = block.offset[i];
+          ASSERT_EQ(block.index[beg], 0);
+          if (i % 2 == 0) {
+            ASSERT_EQ(block.index[beg + 1], 1);
+            ASSERT_EQ(block.value[beg + 2], 20.0f);
+          } else {
+            ASSERT_EQ(block.index[beg + 1], 3);
+            ASSERT_EQ(block.value[beg + 2], 40.0f);
+          }
+        }
+      }
+    }
+  }
+
+  {
+    // Weight, qid, comments, and implicit value.
+    auto path = tmpdir.Str() + "/extra.svm";
+    {
+      std::ofstream fout{path};
+      fout << "1:0.5 qid:3 0:1.5 2 # comment\r\n"
+           << "\n"
+           << "0:2 qid:4 1:+1e-3 3:0.12345678901\n";
+    }
+    auto block = ParseAll(path, Args{{"format", "libsvm"}}, 0, 1, 2, 16);
+    ASSERT_EQ(block.Size(), 2);
+    ASSERT_EQ(block.weight.size(), 2);
+    ASSERT_EQ(block.weight[0], 0.5f);
+    ASSERT_EQ(block.qid[1], 4);
+    ASSERT_EQ(block.index.size(), 4);
+    ASSERT_EQ(block.index[1], 2);
+    ASSERT_EQ(block.value[1], 1.0f);
+    ASSERT_EQ(block.value[2], 1e-3f);
+    ASSERT_NEAR(block.value[3], 0.12345678901f, kRtEps);
+  }
+}
+
+TEST(TextParser, CSV) {
+  common::TemporaryDirectory tmpdir;
+  auto path = tmpdir.Str() + "/data.csv";
+  std::size_t n_rows = 37, n_cols = 5;
+  CreateTestCSV(path, n_rows, n_cols);
+  Args args{{"format", "csv"}, {"label_column", "1"}, {"weight_column", "3"}};
+  for (std::int32_t n_parts : {1, 3}) {
+    std::size_t n_total{0};
+    for (std::int32_t part = 0; part < n_parts; ++part) {
+      auto block = ParseAll(path, args, part, n_parts, 4, 32);
+      for (std::size_t i = 0; i < block.Size(); ++i) {
+        auto r = n_total + i;
+        ASSERT_EQ(block.label[i], static_cast<float>(r * n_cols + 1));
+        ASSERT_EQ(block.weight[i], static_cast<float>(r * n_cols + 3));
+        ASSERT_EQ(block.offset[i + 1] - block.offset[i], n_cols - 2);
+        auto beg = block.offset[i];
+        ASSERT_EQ(block.index[beg + 2], 2);
+        ASSERT_EQ(block.value[beg + 2], static_cast<float>(r * n_cols + 4));
+      }
+      n_total += block.Size();
+    }
+    ASSERT_EQ(n_total, n_rows);
+  }
+
+  {
+    auto mpath = tmpdir.Str() + "/missing.csv";
+    {
+      std::ofstream fout{mpath};
+      fout << "1,,3\n4,5,\n";
+    }
+    // Same as the dmlc parser, empty fields are 0 and a trailing delimiter is ignored.
+    auto block = ParseAll(mpath, Args{{"format", "csv"}}, 0, 1, 1, 1024);
+    ASSERT_EQ(block.Size(), 2);
+    ASSERT_EQ(block.index.size(), 5);
+    ASSERT_EQ(block.offset[1], 3);
+    ASSERT_EQ(block.value[1], 0.0f);
+    ASSERT_EQ(block.value[2], 3.0f);
+    ASSERT_EQ(block.value[4], 5.0f);
+    ASSERT_EQ(block.label[0], 0.0f);
+  }
+}
+}  // namespace xgboost::data
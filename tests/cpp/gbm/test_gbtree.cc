@@ -12,7 +12,10 @@
 #include <optional>  // for optional
 #include <string>    // for string
 
-#include "../../../src/data/proxy_dmatrix.h"  // for DMatrixProxy
+#include "../../../src/common/hist_util.h"          // for HistogramCuts
+#include "../../../src/data/gradient_index.h"       // for GHistIndexMatrix
+#include "../../../src/data/iterative_dmatrix.h"    // for IterativeDMatrix
+#include "../../../src/data/proxy_dmatrix.h"        // for DMatrixProxy
 #include "../../../src/gbm/gbtree.h"
 #include "../filesystem.h"  // TemporaryDirectory
 #include "../helpers.h"
@@ -334,6 +337,63 @@ TEST(GBTree, JsonIO) {
   check_config(j_config_rt["updater"]);
 }
 
+TEST(GBTree, SaveCuts) {
+  bst_idx_t constexpr kRows = 256;
+  bst_feature_t constexpr kCols = 8;
+  bst_bin_t constexpr kMaxBin = 32;
+  Context ctx;
+
+  auto p_fmat = RandomDataGenerator{kRows, kCols, 0}.GenerateDMatrix(true);
+  std::unique_ptr<Learner> learner{Learner::Create({p_fmat})};
+  learner->SetParams(Args{{"tree_method", "hist"},
+                          {"save_cuts", "true"},
+                          {"max_bin", std::to_string(kMaxBin)}});
+  for (std::int32_t i = 0; i < 2; ++i) {
+    learner->UpdateOneIter(i, p_fmat);
+  }
+
+  auto check_cuts = [&](Learner const* bst) {
+    bst_bin_t max_bin{0};
+    auto const* p_cuts = bst->Cuts(&max_bin);
+    ASSERT_TRUE(p_cuts);
+    ASSERT_EQ(max_bin, kMaxBin);
+    for (auto const& page : p_fmat->GetBatches<GHistIndexMatrix>(&ctx, BatchParam{})) {
+      ASSERT_EQ(page.cut.Ptrs(), p_cuts->Ptrs());
+      ASSERT_EQ(page.cut.Values(), p_cuts->Values());
+      ASSERT_EQ(page.cut.MinValues(), p_cuts->MinValues());
+    }
+  };
+  check_cuts(learner.get());
+
+  Json model{Object{}};
+  learner->SaveModel(&model);
+  for (auto mode : {std::ios::out, std::ios::binary}) {
+    std::string str;
+    Json::Dump(model, &str, mode);
+    std::unique_ptr<Learner> loaded{Learner::Create({})};
+    loaded->LoadModel(Json::Load(StringView{str}, mode == std::ios::binary ? mode : std::ios::in));
+    check_cuts(loaded.get());
+
+    // Create a reference QDM from the loaded cuts.
+    bst_bin_t max_bin{0};
+    auto const* p_cuts = loaded->Cuts(&max_bin);
+    MetaInfo info;
+    info.num_col_ = kCols;
+    data::IterativeDMatrix ref{*p_cuts, info, max_bin};
+    ASSERT_EQ(ref.Info().num_row_, 0);
+    for (auto const& page : ref.GetBatches<GHistIndexMatrix>(&ctx, BatchParam{kMaxBin, 0.2})) {
+      ASSERT_EQ(page.cut.Values(), p_cuts->Values());
+    }
+  }
+
+  // Not saved by default.
+  learner.reset(Learner::Create({p_fmat}));
+  learner->SetParams(Args{{"tree_method", "hist"}});
+  learner->UpdateOneIter(0, p_fmat);
+  bst_bin_t max_bin{0};
+  ASSERT_FALSE(learner->Cuts(&max_bin));
+}
+
 TEST(Dart, JsonIO) {
   size_t constexpr kRows = 16, kCols = 16;
 
@@ -1,10 +1,18 @@
 /**
- * Copyright 2022-2023, XGBoost contributors
+ * Copyright 2022-2025, XGBoost contributors
  */
+#include <grpcpp/security/server_credentials.h>  // for InsecureServerCredentials
+#include <grpcpp/server_builder.h>                // for ServerBuilder
 #include <gtest/gtest.h>
-#include <xgboost/span.h>  // for Span
+#include <xgboost/span.h>                         // for Span
 
-#include <array>  // for array
+#include <array>    // for array
+#include <cstdint>  // for int8_t, int32_t, int64_t
+#include <memory>   // for unique_ptr
+#include <numeric>  // for iota
+#include <string>   // for string, to_string
+#include <thread>   // for thread
+#include <vector>   // for vector
 
 #include "../../../../src/common/type.h"   // for EraseType
 #include "../../collective/test_worker.h"  // for SocketTest
@@ -15,6 +23,44 @@
 namespace xgboost::collective {
 namespace {
 class FederatedCollTest : public SocketTest {};
+
+template <typename WorkerFn>
+void TestFederatedChunked(std::int32_t n_workers, std::int64_t chunk_bytes, WorkerFn&& fn) {
+  TestFederatedImpl(n_workers, [&](std::int32_t port, std::int32_t i) {
+    auto config = FederatedTestConfig(n_workers, port, i);
+    config["federated_chunk_bytes"] = Integer{chunk_bytes};
+    auto comm = std::make_shared<FederatedComm>(
+        DefaultRetry(), std::chrono::seconds{DefaultTimeoutSec()}, std::to_string(i), config);
+    ASSERT_EQ(comm->ChunkBytes(), static_cast<std::size_t>(chunk_bytes));
+    fn(comm, i);
+  });
+}
+
+// A server without the streaming RPCs, like the ones before they were added.
+class UnaryService : public federated::Federated::Service {
+  federated::FederatedService impl_;
+
+ public:
+  explicit UnaryService(std::int32_t world_size) : impl_{world_size} {}
+
+  grpc::Status Allgather(grpc::ServerContext* context, federated::AllgatherRequest const* request,
+                         federated::AllgatherReply* reply) override {
+    return impl_.Allgather(context, request, reply);
+  }
+  grpc::Status AllgatherV(grpc::ServerContext* context,
+                          federated::AllgatherVRequest const* request,
+                          federated::AllgatherVReply* reply) override {
+    return impl_.AllgatherV(context, request, reply);
+  }
+  grpc::Status Allreduce(grpc::ServerContext* context, federated::AllreduceRequest const* request,
+                         federated::AllreduceReply* reply) override {
+    return impl_.Allreduce(context, request, reply);
+  }
+  grpc::Status Broadcast(grpc::ServerContext* context, federated::BroadcastRequest const* request,
+                         federated::BroadcastReply* reply) override {
+    return impl_.Broadcast(context, request, reply);
+  }
+};
 }  // namespace
 
 TEST_F(FederatedCollTest, Allreduce) {
@@ -35,6 +81,120 @@ TEST_F(FederatedCollTest, Allreduce) {
   });
 }
 
+TEST_F(FederatedCollTest, AllreduceStream) {
+  std::int32_t n_workers = std::min(std::thread::hardware_concurrency(), 3u);
+  // Not a multiple of the element size, and the last chunk is partial.
+  TestFederatedChunked(n_workers, 30, [=](std::shared_ptr<FederatedComm> comm, std::int32_t r) {
+    FederatedColl coll{};
+    for (std::size_t n : {std::size_t{7}, std::size_t{8}, std::size_t{1027}}) {
+      std::vector<std::int64_t> data(n);
+      std::iota(data.begin(), data.end(), r);
+      auto rc = coll.Allreduce(*comm, common::EraseType(common::Span{data.data(), data.size()}),
+                               ArrayInterfaceHandler::kI8, Op::kSum);
+      SafeColl(rc);
+      for (std::size_t i = 0; i < n; ++i) {
+        auto expected = static_cast<std::int64_t>(i) * n_workers + n_workers * (n_workers - 1) / 2;
+        ASSERT_EQ(data[i], expected) << "n:" << n;
+      }
+    }
+    // Mixed with unary calls.
+    std::array<std::int32_t, 2> small{r, r};
+    auto rc = coll.Allreduce(*comm, common::EraseType(common::Span{small.data(), small.size()}),
+                             ArrayInterfaceHandler::kI4, Op::kMax);
+    SafeColl(rc);
+    ASSERT_EQ(small[0], n_workers - 1);
+    ASSERT_EQ(small[1], n_workers - 1);
+  });
+}
+
+TEST_F(FederatedCollTest, BroadcastStream) {
+  std::int32_t n_workers = std::min(std::thread::hardware_concurrency(), 3u);
+  TestFederatedChunked(n_workers, 64, [=](std::shared_ptr<FederatedComm> comm, std::int32_t r) {
+    FederatedColl coll{};
+    std::int32_t root = n_workers - 1;
+    std::vector<std::int8_t> data(1000, 0);
+    if (r == root) {
+      for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::int8_t>(i % 128);
+      }
+    }
+    auto rc = coll.Broadcast(*comm, common::Span{data.data(), data.size()}, root);
+    SafeColl(rc);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      ASSERT_EQ(data[i], static_cast<std::int8_t>(i % 128));
+    }
+  });
+}
+
+TEST_F(FederatedCollTest, StreamMixedChunkBytes) {
+  std::int32_t n_workers = std::min(std::thread::hardware_concurrency(), 3u);
+  TestFederatedImpl(n_workers, [=](std::int32_t port, std::int32_t r) {
+    auto config = FederatedTestConfig(n_workers, port, r);
+    // Different chunk sizes on each worker, the smallest one is used by all of them.
+    config["federated_chunk_bytes"] = Integer{16 + 8 * r};
+    FederatedComm comm{DefaultRetry(), std::chrono::seconds{DefaultTimeoutSec()},
+                       std::to_string(r), config};
+    FederatedColl coll{};
+    std::vector<std::int32_t> data(129, r);
+    auto rc = coll.Allreduce(comm, common::EraseType(common::Span{data.data(), data.size()}),
+                             ArrayInterfaceHandler::kI4, Op::kSum);
+    SafeColl(rc);
+    for (auto v : data) {
+      ASSERT_EQ(v, n_workers * (n_workers - 1) / 2);
+    }
+    std::int32_t root = 0;
+    std::vector<std::int8_t> bcast(100, static_cast<std::int8_t>(r));
+    rc = coll.Broadcast(comm, common::Span{bcast.data(), bcast.size()}, root);
+    SafeColl(rc);
+    for (auto v : bcast) {
+      ASSERT_EQ(v, root);
+    }
+  });
+}
+
+TEST_F(FederatedCollTest, StreamUnimplemented) {
+  std::int32_t n_workers = 2;
+  UnaryService service{n_workers};
+  std::int32_t port{0};
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort("0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(&service);
+  std::unique_ptr<grpc::Server> server{builder.BuildAndStart()};
+  ASSERT_NE(port, 0);
+
+  std::vector<std::thread> workers;
+  for (std::int32_t r = 0; r < n_workers; ++r) {
+    workers.emplace_back([=] {
+      auto config = FederatedTestConfig(n_workers, port, r);
+      config["federated_chunk_bytes"] = Integer{16};
+      FederatedComm comm{DefaultRetry(), std::chrono::seconds{DefaultTimeoutSec()},
+                         std::to_string(r), config};
+      FederatedColl coll{};
+      // Run twice to check the sequence number after falling back to the unary RPCs.
+      for (std::int32_t k = 0; k < 2; ++k) {
+        std::vector<std::int32_t> data(64, r + k);
+        auto rc = coll.Allreduce(comm, common::EraseType(common::Span{data.data(), data.size()}),
+                                 ArrayInterfaceHandler::kI4, Op::kSum);
+        SafeColl(rc);
+        for (auto v : data) {
+          ASSERT_EQ(v, 2 * k + 1);
+        }
+
+        std::vector<std::int8_t> bcast(100, static_cast<std::int8_t>(r == 0 ? k + 1 : 0));
+        rc = coll.Broadcast(comm, common::Span{bcast.data(), bcast.size()}, 0);
+        SafeColl(rc);
+        for (auto v : bcast) {
+          ASSERT_EQ(v, k + 1);
+        }
+      }
+    });
+  }
+  for (auto& t : workers) {
+    t.join();
+  }
+  server->Shutdown();
+}
+
 TEST_F(FederatedCollTest, Broadcast) {
   std::int32_t n_workers = std::min(std::thread::hardware_concurrency(), 3u);
   TestFederated(n_workers, [=](std::shared_ptr<FederatedComm> comm, std::int32_t) {
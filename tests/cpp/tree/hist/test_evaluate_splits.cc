@@ -10,10 +10,12 @@
 #include <xgboost/logging.h>     // for CHECK_EQ
 #include <xgboost/tree_model.h>  // for RegTree, RTreeNodeStat
 
+#include <cstdint>  // for uint32_t
 #include <memory>   // for make_shared, shared_ptr, addressof
 #include <numeric>  // for iota
 #include <tuple>    // for make_tuple
 
+#include "../../../../src/common/categorical.h"         // for KCatBitField
 #include "../../../../src/common/hist_util.h"           // for HistCollection, HistogramCuts
 #include "../../../../src/common/random.h"              // for ColumnSampler
 #include "../../../../src/common/row_set.h"             // for RowSetCollection
@@ -334,6 +336,65 @@ TEST(HistEvaluator, Categorical) {
   ASSERT_EQ(with_onehot.split.loss_chg, with_part.split.loss_chg);
 }
 
+TEST(HistEvaluator, CategoricalTopK) {
+  Context ctx;
+  bst_cat_t constexpr kCats = 64, kTopK = 4;
+  std::vector<float> values(kCats);
+  std::iota(values.begin(), values.end(), 0.0f);
+  auto cuts = MakeCutsForTest(values, {0, kCats}, {0.0}, DeviceOrd::CPU());
+  cuts.SetCategorical(true, kCats - 1);
+
+  TrainParam param;
+  param.UpdateAllowUnknown(Args{{"min_child_weight", "0"},
+                                {"reg_lambda", "0"},
+                                {"max_cat_to_onehot", "1"},
+                                {"max_cat_per_node", std::to_string(kTopK)}});
+
+  BoundedHistCollection hist;
+  HistMakerTrainParam hist_param;
+  hist.Reset(cuts.TotalBins(), hist_param.MaxCachedHistNodes(ctx.Device()));
+  hist.AllocateHistograms({0});
+  auto node_hist = hist[0];
+  GradientPairPrecise total;
+  for (bst_cat_t c = 0; c < kCats; ++c) {
+    if (c < kTopK) {
+      // A few heavy categories.
+      node_hist[c] = {c % 2 == 0 ? -8.0 : 8.0, 10.0};
+    } else if (c < kCats * 3 / 4) {
+      // The long tail.
+      node_hist[c] = {0.1 * (c % 3 - 1.0), 0.05};
+    }  // The rest are empty.
+    total += node_hist[c];
+  }
+
+  MetaInfo info;
+  info.num_col_ = 1;
+  info.feature_types = {FeatureType::kCategorical};
+  auto sampler = std::make_shared<common::ColumnSampler>(1u);
+  auto evaluator = HistEvaluator{&ctx, &param, info, sampler};
+  evaluator.InitRoot(GradStats{total});
+  std::vector<CPUExpandEntry> entries(1);
+  RegTree tree;
+  evaluator.EvaluateSplits(hist, cuts, info.feature_types.ConstHostSpan(), tree, &entries);
+  auto const &split = entries.front().split;
+  ASSERT_TRUE(split.is_cat);
+  ASSERT_GT(split.loss_chg, 0.0f);
+  // The bit field covers only the kept categories.
+  ASSERT_EQ(split.cat_bits.size(), common::CatBitField::ComputeStorageSize(kTopK));
+
+  // Only the kept categories go to the right, the tail resides on the left.
+  common::KCatBitField cat_bits{common::Span<std::uint32_t const>{split.cat_bits}};
+  GradientPairPrecise right;
+  for (bst_cat_t c = 0; c < kTopK; ++c) {
+    if (cat_bits.Check(c)) {
+      right += node_hist[c];
+    }
+  }
+  ASSERT_NEAR(split.right_sum.GetGrad(), right.GetGrad(), kRtEps);
+  ASSERT_NEAR(split.right_sum.GetHess(), right.GetHess(), kRtEps);
+  ASSERT_NEAR(split.left_sum.GetHess() + split.right_sum.GetHess(), total.GetHess(), kRtEps);
+}
+
 TEST_F(TestCategoricalSplitWithMissing, HistEvaluator) {
   Context ctx;
   BoundedHistCollection hist;
@@ -11,7 +11,8 @@
 #include <xgboost/span.h>                // for Span, operator!=
 #include <xgboost/tree_model.h>          // for RegTree
 
-#include <algorithm>   // for max
+#include <algorithm>   // for max, is_sorted
+#include <cmath>       // for abs
 #include <cstddef>     // for size_t
 #include <cstdint>     // for int32_t, uint32_t
 #include <iterator>    // for back_inserter
@@ -20,6 +21,7 @@
 #include <numeric>     // for iota, accumulate
 #include <vector>      // for vector
 
+#include "../../../../src/collective/comm_group.h"       // for GlobalCommGroup
 #include "../../../../src/collective/communicator-inl.h"  // for GetRank, GetWorldSize
 #include "../../../../src/common/hist_util.h"             // for GHistRow, HistogramCuts, Sketch...
 #include "../../../../src/common/ref_resource_view.h"     // for RefResourceView
@@ -298,6 +300,145 @@ TEST(CPUHistogram, BuildHist) {
   TestBuildHistogram(&ctx, false, true, false);
 }
 
+TEST(CPUHistogram, HistEncoding) {
+  std::size_t n_bins = 1024;
+  std::vector<std::size_t> strides{1, 3, 97, n_bins * 2};
+  for (auto stride : strides) {
+    std::vector<GradientPairPrecise> hist(n_bins);
+    for (std::size_t i = 0; i < n_bins; i += stride) {
+      hist[i] = GradientPairPrecise{static_cast<double>(i) - 100.5, 0.25 * i + 1.0};
+    }
+    double max_abs = 0.0;
+    for (auto const &g : hist) {
+      max_abs = std::max({max_abs, std::abs(g.GetGrad()), std::abs(g.GetHess())});
+    }
+    for (double max_error : {0.0, 1e-7, 1e-4}) {
+      std::vector<std::int8_t> encoded;
+      EncodeHist(common::Span{hist.data(), hist.size()}, max_error, &encoded);
+      if (stride > 3) {
+        ASSERT_LT(encoded.size(), n_bins * sizeof(GradientPairPrecise));
+      }
+      std::vector<GradientPairPrecise> decoded(n_bins);
+      DecodeHistAdd(common::Span{encoded.data(), encoded.size()},
+                    common::Span{decoded.data(), decoded.size()});
+      for (std::size_t i = 0; i < n_bins; ++i) {
+        if (max_error == 0.0) {
+          ASSERT_EQ(decoded[i].GetGrad(), hist[i].GetGrad());
+          ASSERT_EQ(decoded[i].GetHess(), hist[i].GetHess());
+        } else {
+          ASSERT_NEAR(decoded[i].GetGrad(), hist[i].GetGrad(), max_abs * max_error);
+          ASSERT_NEAR(decoded[i].GetHess(), hist[i].GetHess(), max_abs * max_error);
+        }
+      }
+    }
+  }
+}
+
+TEST(CPUHistogram, SparseHistAllreduce) {
+  auto constexpr kWorkers = 3;
+  collective::TestDistributedGlobal(kWorkers, [&] {
+    Context ctx;
+    auto rank = collective::GetRank();
+    std::size_t n_bins = 4096;
+    for (std::size_t stride : {1ul, 64ul}) {
+      std::vector<GradientPairPrecise> hist(n_bins);
+      for (std::size_t i = rank; i < n_bins; i += stride) {
+        hist[i] = GradientPairPrecise{1.0, 2.0};
+      }
+      HistSyncStats stats;
+      auto rc = SparseHistAllreduce(&ctx, *collective::GlobalCommGroup(),
+                                    common::Span{hist.data(), hist.size()}, 0.0, &stats);
+      SafeColl(rc);
+      for (std::size_t i = 0; i < n_bins; ++i) {
+        double n = 0;
+        for (std::int32_t r = 0; r < kWorkers; ++r) {
+          n += (i >= static_cast<std::size_t>(r) && (i - r) % stride == 0) ? 1.0 : 0.0;
+        }
+        ASSERT_EQ(hist[i].GetGrad(), n);
+        ASSERT_EQ(hist[i].GetHess(), n * 2.0);
+      }
+      if (stride == 1) {
+        // Dense fallback.
+        ASSERT_EQ(stats.n_bytes, stats.n_dense_bytes);
+      } else {
+        ASSERT_LT(stats.n_bytes * 4, stats.n_dense_bytes);
+      }
+    }
+  });
+}
+
+TEST(CPUHistogram, SparseHistAllreduceMixedDensity) {
+  auto constexpr kWorkers = 3;
+  collective::TestDistributedGlobal(kWorkers, [&] {
+    Context ctx;
+    auto rank = collective::GetRank();
+    std::size_t n_bins = 4096;
+    // Two dense workers and a sparse one. The sparse worker receives more bytes than the
+    // dense allreduce would send, while the dense workers receive fewer.
+    std::size_t stride = rank == kWorkers - 1 ? n_bins : 1;
+    std::vector<GradientPairPrecise> hist(n_bins);
+    for (std::size_t i = 0; i < n_bins; i += stride) {
+      hist[i] = GradientPairPrecise{1.0, 2.0};
+    }
+    HistSyncStats stats;
+    auto rc = SparseHistAllreduce(&ctx, *collective::GlobalCommGroup(),
+                                  common::Span{hist.data(), hist.size()}, 0.0, &stats);
+    SafeColl(rc);
+    for (std::size_t i = 0; i < n_bins; ++i) {
+      double n = (i == 0) ? 3.0 : 2.0;
+      ASSERT_EQ(hist[i].GetGrad(), n);
+      ASSERT_EQ(hist[i].GetHess(), n * 2.0);
+    }
+    // All workers use the dense fallback.
+    ASSERT_EQ(stats.n_bytes, stats.n_dense_bytes);
+  });
+}
+
+TEST(CPUHistogram, ShardHist) {
+  common::HistogramCuts cuts;
+  // Features with 4, 1, 3, 8 and 2 bins.
+  cuts.cut_ptrs_.HostVector() = {0, 4, 5, 8, 16, 18};
+  cuts.cut_values_.HostVector().resize(18);
+  ASSERT_EQ(ShardFeatures(cuts, 1), (std::vector<bst_feature_t>{0, 5}));
+  ASSERT_EQ(ShardFeatures(cuts, 2), (std::vector<bst_feature_t>{0, 3, 5}));
+  ASSERT_EQ(ShardFeatures(cuts, 3), (std::vector<bst_feature_t>{0, 2, 4, 5}));
+  // More shards than features.
+  auto shards = ShardFeatures(cuts, 8);
+  ASSERT_EQ(shards.size(), 9);
+  ASSERT_EQ(shards.back(), 5);
+  ASSERT_TRUE(std::is_sorted(shards.cbegin(), shards.cend()));
+
+  auto constexpr kWorkers = 3;
+  collective::TestDistributedGlobal(kWorkers, [&] {
+    Context ctx;
+    auto rank = collective::GetRank();
+    auto feat_shards = ShardFeatures(cuts, kWorkers);
+    std::vector<bst_bin_t> bin_shards;
+    for (auto fidx : feat_shards) {
+      bin_shards.push_back(cuts.Ptrs()[fidx]);
+    }
+    auto n_bins = static_cast<std::size_t>(cuts.TotalBins());
+    std::size_t n_nodes = 2;
+    std::vector<GradientPairPrecise> hist(n_bins * n_nodes);
+    for (std::size_t i = 0; i < hist.size(); ++i) {
+      hist[i] = GradientPairPrecise{static_cast<double>(i + rank), 1.0};
+    }
+    HistSyncStats stats;
+    auto rc = ReduceScatterHist(&ctx, *collective::GlobalCommGroup(),
+                                common::Span{bin_shards.data(), bin_shards.size()},
+                                common::Span{hist.data(), hist.size()}, &stats);
+    SafeColl(rc);
+    for (std::size_t nidx_in_set = 0; nidx_in_set < n_nodes; ++nidx_in_set) {
+      for (auto j = bin_shards[rank]; j < bin_shards[rank + 1]; ++j) {
+        auto i = nidx_in_set * n_bins + j;
+        ASSERT_EQ(hist[i].GetGrad(), static_cast<double>(i * kWorkers + 0 + 1 + 2));
+        ASSERT_EQ(hist[i].GetHess(), static_cast<double>(kWorkers));
+      }
+    }
+    ASSERT_LT(stats.n_bytes, stats.n_dense_bytes);
+  });
+}
+
 TEST(CPUHistogram, BuildHistColumnSplit) {
   auto constexpr kWorkers = 4;
   Context ctx;
@@ -615,4 +756,70 @@ auto MakeParamsForTest() {
 TEST_P(OverflowTest, Overflow) { this->RunTest(); }
 
 INSTANTIATE_TEST_SUITE_P(CPUHistogram, OverflowTest, ::testing::ValuesIn(MakeParamsForTest()));
+
+TEST(CPUHistogram, FusedPartitionHist) {
+  bst_bin_t constexpr kBins = 64;
+  Context ctx;
+  ctx.UpdateAllowUnknown(Args{{"nthread", "4"}});
+  HistMakerTrainParam hist_param;
+  hist_param.Init(Args{});
+
+  bst_idx_t n_samples = 10000;
+  auto Xy = RandomDataGenerator{n_samples, 8, 0.3}.Bins(kBins).GenerateQuantileDMatrix(true);
+  auto batch = BatchParam{kBins, TrainParam::DftSparseThreshold()};
+  auto const &page = *Xy->GetBatches<GHistIndexMatrix>(&ctx, batch).begin();
+  auto gpair = GenerateRandomGradients(n_samples, 0.0, 1.0);
+  auto h_gpair = linalg::MakeTensorView(&ctx, gpair.ConstHostSpan(), gpair.Size(), 1);
+
+  CPUExpandEntry best;
+  best.split.Update(1.0f, 1, page.cut.Values()[page.cut.Ptrs()[1] + kBins / 4], false, false,
+                    GradStats{1.0, 1.0}, GradStats{2.0, 2.0});
+  std::vector<CPUExpandEntry> candidates{best};
+
+  auto build = [&](bool fuse) {
+    RegTree tree;
+    MultiHistogramBuilder hist_builder;
+    hist_builder.Reset(&ctx, page.cut.TotalBins(), tree.NumTargets(), batch, false, false,
+                       &hist_param);
+    std::vector<CommonRowPartitioner> partitioners;
+    partitioners.emplace_back(&ctx, n_samples, /*base_rowid=*/0, false);
+    hist_builder.BuildRootHist(Xy.get(), &tree, partitioners, h_gpair, best, batch);
+
+    tree.ExpandNode(best.nid, best.split.SplitIndex(), best.split.split_value, false,
+                    /*base_weight=*/2.0f, /*left_leaf_weight=*/1.0f,
+                    /*right_leaf_weight=*/1.0f, best.GetLossChange(), /*sum_hess=*/3.0f,
+                    best.split.left_sum.GetHess(), best.split.right_sum.GetHess());
+    auto &partitioner = partitioners.front();
+    if (fuse) {
+      CHECK(hist_builder.PrepareFusedHist(&tree, candidates,
+                                          partitioner.PartitionSpace(candidates)));
+      partitioner.UpdatePosition(&ctx, page, candidates, &tree,
+                                 [&](std::size_t node_in_set, common::Span<bst_idx_t const> left,
+                                     common::Span<bst_idx_t const> right) {
+                                   hist_builder.BuildFusedHist(node_in_set, &tree,
+                                                               candidates[node_in_set].nid, page,
+                                                               left, right, h_gpair);
+                                 });
+      hist_builder.SyncFusedHist(&ctx, &tree);
+    } else {
+      partitioner.UpdatePosition(&ctx, page, candidates, &tree);
+      hist_builder.BuildHistLeftRight(&ctx, Xy.get(), &tree, partitioners, candidates, h_gpair,
+                                      batch);
+    }
+    std::vector<GradientPairPrecise> result;
+    for (auto nidx : {tree.LeftChild(best.nid), tree.RightChild(best.nid)}) {
+      auto hist = hist_builder.Histogram(0)[nidx];
+      std::copy(hist.cbegin(), hist.cend(), std::back_inserter(result));
+    }
+    return result;
+  };
+
+  auto expected = build(false);
+  auto got = build(true);
+  ASSERT_EQ(expected.size(), got.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_NEAR(expected[i].GetGrad(), got[i].GetGrad(), kRtEps);
+    ASSERT_NEAR(expected[i].GetHess(), got[i].GetHess(), kRtEps);
+  }
+}
 }  // namespace xgboost::tree
@@ -5,7 +5,10 @@
 #include <xgboost/tree_updater.h>  // for TreeUpdater
 
 #include <algorithm>  // for transform
-#include <memory>     // for unique_ptr
+#include <cstdint>    // for int32_t
+#include <memory>     // for unique_ptr, shared_ptr
+#include <random>     // for mt19937, uniform_real_distribution
+#include <string>     // for to_string
 #include <vector>     // for vector
 
 #include "../../../src/tree/common_row_partitioner.h"
@@ -130,6 +133,93 @@ TEST(Approx, InteractionConstraint) {
   }
 }
 
+namespace {
+// Gradients that differ between updates, the hessian is one if `const_hess` is true.
+linalg::Matrix<GradientPair> MakeGradients(Context const *ctx, bst_idx_t n_samples,
+                                           std::int32_t iter, bool const_hess) {
+  std::mt19937 rng{static_cast<std::uint32_t>(iter)};
+  std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+  std::vector<GradientPair> h_gpair(n_samples);
+  for (auto &g : h_gpair) {
+    auto grad = dist(rng) - 0.5f;
+    g = GradientPair{grad, const_hess ? 1.0f : dist(rng)};
+  }
+  linalg::Matrix<GradientPair> gpair({n_samples}, ctx->Device());
+  gpair.Data()->Copy(h_gpair);
+  return gpair;
+}
+}  // anonymous namespace
+
+TEST(Approx, SketchInterval) {
+  bst_idx_t constexpr kRows = 256;
+  bst_feature_t constexpr kCols = 8;
+  Context ctx;
+  ObjInfo task{ObjInfo::kRegression};
+  TrainParam param;
+  // Use a small number of bins such that the cuts depend on the hessian.
+  param.Init(Args{{"max_bin", "16"}});
+
+  auto make_updater = [&](std::int32_t interval) {
+    std::unique_ptr<TreeUpdater> updater{TreeUpdater::Create("grow_histmaker", &ctx, &task)};
+    updater->Configure(Args{{"approx_sketch_interval", std::to_string(interval)}});
+    return updater;
+  };
+  auto get_gidx = [&](DMatrix *p_fmat) {
+    // Don't request a new sketch, return the existing gradient index. The returned pointer
+    // keeps the page alive, a regenerated page can't have the same address.
+    auto hess = GenerateHess(kRows);
+    auto batches = p_fmat->GetBatches<GHistIndexMatrix>(&ctx, {param.max_bin, hess, false});
+    return batches.begin().Page();
+  };
+  auto update = [&](TreeUpdater *updater, DMatrix *p_fmat, std::int32_t iter, bool const_hess) {
+    auto gpair = MakeGradients(&ctx, kRows, iter, const_hess);
+    RegTree tree{1u, kCols};
+    std::vector<HostDeviceVector<bst_node_t>> position(1);
+    updater->Update(&param, &gpair, p_fmat, position, {&tree});
+    EXPECT_GT(tree.NumExtraNodes(), 0);
+    return tree;
+  };
+
+  {
+    // The hessian changes between updates, the sketch is reused in the second update.
+    auto p_dmat = RandomDataGenerator{kRows, kCols, 0.0f}.GenerateDMatrix();
+    auto updater = make_updater(2);
+    std::vector<std::shared_ptr<GHistIndexMatrix const>> gidx;
+    for (std::int32_t i = 0; i < 3; ++i) {
+      update(updater.get(), p_dmat.get(), i, false);
+      gidx.push_back(get_gidx(p_dmat.get()));
+    }
+    ASSERT_EQ(gidx[0], gidx[1]);
+    ASSERT_EQ(gidx[0]->cut.Values(), gidx[1]->cut.Values());
+    // Sketched again with a different hessian in the third update.
+    ASSERT_NE(gidx[1], gidx[2]);
+    ASSERT_NE(gidx[1]->cut.Values(), gidx[2]->cut.Values());
+  }
+  {
+    // With a constant hessian, the reused sketch must produce the same trees as sketching
+    // in every update.
+    auto p_dmat = RandomDataGenerator{kRows, kCols, 0.0f}.GenerateDMatrix();
+    auto p_ref = RandomDataGenerator{kRows, kCols, 0.0f}.GenerateDMatrix();
+    auto updater = make_updater(3);
+    auto ref_updater = make_updater(1);
+    std::shared_ptr<GHistIndexMatrix const> first;
+    for (std::int32_t i = 0; i < 3; ++i) {
+      auto tree = update(updater.get(), p_dmat.get(), i, true);
+      auto ref_tree = update(ref_updater.get(), p_ref.get(), i, true);
+      ASSERT_TRUE(tree == ref_tree) << "iteration: " << i;
+
+      auto gidx = get_gidx(p_dmat.get());
+      auto ref_gidx = get_gidx(p_ref.get());
+      if (i == 0) {
+        first = gidx;
+      }
+      ASSERT_EQ(gidx, first);
+      ASSERT_EQ(gidx->cut.Values(), ref_gidx->cut.Values());
+      ASSERT_EQ(gidx->cut.Ptrs(), ref_gidx->cut.Ptrs());
+    }
+  }
+}
+
 namespace {
 void TestColumnSplitPartitioner(size_t n_samples, size_t base_rowid, std::shared_ptr<DMatrix> Xy,
                                 std::vector<float>* hess, float min_value, float mid_value,
@@ -231,4 +321,19 @@ INSTANTIATE_TEST_SUITE_P(ColumnSplit, TestApproxColumnSplit, ::testing::ValuesIn
                            }
                            return params;
                          }()));
+
+namespace {
+class TestApproxShardSync : public ::testing::TestWithParam<std::tuple<bool, float>> {
+ public:
+  void Run() {
+    auto [categorical, sparsity] = GetParam();
+    TestShardHistSync(categorical, "grow_histmaker", sparsity);
+  }
+};
+}  // namespace
+
+TEST_P(TestApproxShardSync, Basic) { this->Run(); }
+
+INSTANTIATE_TEST_SUITE_P(ShardHistSync, TestApproxShardSync,
+                         ::testing::Combine(::testing::Bool(), ::testing::Values(0.0f, 0.6f)));
 }  // namespace xgboost::tree
@@ -7,7 +7,10 @@
 #include <xgboost/tree_model.h>    // for RegTree
 #include <xgboost/tree_updater.h>  // for TreeUpdater
 
-#include <vector>  // for vector
+#include <cstdint>  // for int32_t
+#include <numeric>  // for iota
+#include <utility>  // for pair
+#include <vector>   // for vector
 
 #include "../../../src/tree/param.h"    // for TrainParam
 #include "../collective/test_worker.h"  // for TestDistributedGlobal
@@ -62,4 +65,51 @@ void TestColumnSplit(bst_target_t n_targets, bool categorical, std::string name,
 
   collective::TestDistributedGlobal(kWorldSize, [&] { verify(); });
 }
+
+void TestShardHistSync(bool categorical, std::string name, float sparsity) {
+  auto constexpr kRows = 256;
+  auto constexpr kCols = 16;
+  auto constexpr kWorldSize = 2;
+
+  auto verify = [&] {
+    Context ctx;
+    collective::GetWorkerLocalThreads(kWorldSize, &ctx);
+
+    // Each worker gets a contiguous block of rows.
+    auto p_full = GenerateCatDMatrix(kRows, kCols, sparsity, categorical);
+    std::int32_t n_local = kRows / kWorldSize;
+    std::vector<std::int32_t> ridxs(n_local);
+    std::iota(ridxs.begin(), ridxs.end(), collective::GetRank() * n_local);
+    std::shared_ptr<DMatrix> p_dmat{p_full->Slice(ridxs)};
+    auto n_samples = p_dmat->Info().num_row_;
+    auto gpair = GenerateRandomGradients(&ctx, n_samples, 1);
+
+    auto train = [&](bool shard) {
+      ObjInfo task{ObjInfo::kRegression};
+      std::unique_ptr<TreeUpdater> updater{TreeUpdater::Create(name, &ctx, &task)};
+      std::vector<HostDeviceVector<bst_node_t>> position(1);
+
+      RegTree tree{1u, static_cast<bst_feature_t>(kCols)};
+      TrainParam param;
+      param.Init(Args{{"max_depth", "4"}});
+      updater->Configure(Args{{"shard_hist_sync", shard ? "true" : "false"}});
+      updater->Update(&param, &gpair, p_dmat.get(), position, {&tree});
+
+      linalg::Matrix<float> out_preds({n_samples, static_cast<bst_idx_t>(1)}, ctx.Device());
+      out_preds.Data()->Fill(0.0f);
+      EXPECT_TRUE(updater->UpdatePredictionCache(p_dmat.get(), out_preds.HostView()));
+
+      Json json{Object{}};
+      tree.SaveModel(&json);
+      return std::pair{json, out_preds.Data()->ConstHostVector()};
+    };
+
+    auto [expected_tree, expected_preds] = train(false);
+    auto [tree, preds] = train(true);
+    ASSERT_EQ(tree, expected_tree);
+    ASSERT_EQ(preds, expected_preds);
+  };
+
+  collective::TestDistributedGlobal(kWorldSize, [&] { verify(); });
+}
 }  // namespace xgboost::tree
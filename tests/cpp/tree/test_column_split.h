@@ -30,4 +30,10 @@ inline std::shared_ptr<DMatrix> GenerateCatDMatrix(std::size_t rows, std::size_t
 }
 
 void TestColumnSplit(bst_target_t n_targets, bool categorical, std::string name, float sparsity);
+
+/**
+ * @brief Train with row-split data and check that the sharded histogram synchronization
+ *        produces the same tree and prediction cache as the default allreduce.
+ */
+void TestShardHistSync(bool categorical, std::string name, float sparsity);
 }  // namespace xgboost::tree
@@ -230,4 +230,19 @@ INSTANTIATE_TEST_SUITE_P(ColumnSplit, TestHistColumnSplit, ::testing::ValuesIn([
                            }
                            return params;
                          }()));
+
+namespace {
+class TestHistShardSync : public ::testing::TestWithParam<std::tuple<bool, float>> {
+ public:
+  void Run() {
+    auto [categorical, sparsity] = GetParam();
+    TestShardHistSync(categorical, "grow_quantile_histmaker", sparsity);
+  }
+};
+}  // anonymous namespace
+
+TEST_P(TestHistShardSync, Basic) { this->Run(); }
+
+INSTANTIATE_TEST_SUITE_P(ShardHistSync, TestHistShardSync,
+                         ::testing::Combine(::testing::Bool(), ::testing::Values(0.0f, 0.6f)));
 }  // namespace xgboost::tree